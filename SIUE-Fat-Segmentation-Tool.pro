@@ -4,10 +4,16 @@
 #
 #-------------------------------------------------
 
-QT       += core gui opengl xml network
+QT       += core gui opengl xml network concurrent
 
 greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
 
+# Expired tracing commands are dropped from the undo history with QUndoCommand::setObsolete (Qt 5.9) and warnings from worker
+# threads are queued to the GUI thread with QMetaObject::invokeMethod on a functor (Qt 5.10)
+lessThan(QT_MAJOR_VERSION, 5) | if(equals(QT_MAJOR_VERSION, 5):lessThan(QT_MINOR_VERSION, 10)) {
+    error("Qt 5.10 or later is required to build the SIUE Fat Segmentation Tool")
+}
+
 CONFIG += c++11
 !macx: CONFIG -= app_bundle
 
@@ -33,7 +39,23 @@ SOURCES += main.cpp\
     view_axialcoronalhires.cpp \
     view_axialcoronallores.cpp \
     tracing.cpp \
-    stacktrace.cpp
+    stacktrace.cpp \
+    slicescheduler.cpp \
+    glresources.cpp \
+    tiledtexture.cpp \
+    slicebufferpool.cpp \
+    logger.cpp \
+    subjectcache.cpp \
+    worklist.cpp \
+    tracingagreement.cpp \
+    labelvolume.cpp \
+    depotstatistics.cpp \
+    depotstatisticspanel.cpp \
+    tracingmorphology.cpp \
+    morphologydialog.cpp \
+    connectedcomponents.cpp \
+    layerqapanel.cpp \
+    livewire.cpp
 
 HEADERS  += mainwindow.h \
     application.h \
@@ -51,7 +73,24 @@ HEADERS  += mainwindow.h \
     view_axialcoronalhires.h \
     view_axialcoronallores.h \
     tracing.h \
-    stacktrace.h
+    stacktrace.h \
+    slicescheduler.h \
+    glresources.h \
+    colormaps.h \
+    tiledtexture.h \
+    slicebufferpool.h \
+    logger.h \
+    subjectcache.h \
+    worklist.h \
+    tracingagreement.h \
+    labelvolume.h \
+    depotstatistics.h \
+    depotstatisticspanel.h \
+    tracingmorphology.h \
+    morphologydialog.h \
+    connectedcomponents.h \
+    layerqapanel.h \
+    livewire.h
 
 FORMS    += mainwindow.ui \
     view_axialcoronalhires.ui \
@@ -3,11 +3,15 @@
 
 #include <QApplication>
 #include <QtGui>
+#include <QElapsedTimer>
 
 #include <opencv2/opencv.hpp>
 
 #include "exception.h"
 
+// Started at the beginning of main and used to log how long it takes until the first frame is drawn
+extern QElapsedTimer startupTimer;
+
 class Application : public QApplication
 {
 
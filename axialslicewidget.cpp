@@ -4,14 +4,26 @@
 AxialSliceWidget::AxialSliceWidget(QWidget *parent) : QOpenGLWidget(parent),
     displayType(SliceDisplayType::FatOnly), fatImage(NULL), waterImage(NULL), tracingData(NULL),
     tracingLayerColors({ Qt::blue, Qt::darkCyan, Qt::cyan, Qt::magenta, Qt::yellow, Qt::green }), mouseCommand(NULL),
-    slicePrimTexture(0), sliceSecdTexture(0),
+    dirty(0), quadVertexObject(0), slicePrimTexture(NULL), sliceSecdTexture(NULL), levelBias(0), sliceSecdVisible(false), sceneFBO(NULL), sliceScheduler(new SliceScheduler(this)),
     location(0, 0, 0, 0), locationLabel(NULL), primColorMap(ColorMap::Gray), primOpacity(1.0f), secdColorMap(ColorMap::Gray), secdOpacity(1.0f),
-    brightness(0.0f), brightnessThreshold(0.0f), contrast(1.0f), tracingLayer(TracingLayer::EAT), drawMode(DrawMode::Points), eraserBrushWidth(1),
-    startDraw(false), startPan(false), moveID(CommandID::AxialMove),
-    frameCount(0), fps(0.0f)
+    brightness(0.0f), brightnessThreshold(0.0f), contrast(1.0f), windowMode(WindowMode::PerSlice), tracingLayer(TracingLayer::EAT), drawMode(DrawMode::Points),
+    drawBrushWidth(1), drawBrushShape(BrushShape::Square), eraserBrushWidth(1), eraserBrushShape(BrushShape::Square),
+    liveWireStarted(false), liveWireSearching(false),
+    startDraw(false), startPan(false), startZoom(false), zoomGestureStartScaling(1.0f), zoomGestureTimer(new QTimer(this)),
+    recordViewHistory(true), frameCount(0), fps(0.0f), firstFrame(true), tracingHistory(NULL)
 {
     this->tracingLayerVisible.fill(true);
-    this->traceTextureInit.fill(false);
+    this->traceTextures.fill(NULL);
+
+    // Each wheel event restarts the timer, the zoom gesture is finished when it times out
+    zoomGestureTimer->setSingleShot(true);
+    zoomGestureTimer->setInterval(500);
+    connect(zoomGestureTimer, SIGNAL(timeout()), this, SLOT(finishZoomGesture()));
+
+    // Draw again when a slice is ready so it is uploaded on the next frame
+    connect(sliceScheduler, SIGNAL(resultAvailable()), this, SLOT(update()));
+
+    connect(&liveWireWatcher, SIGNAL(finished()), this, SLOT(liveWireWatcher_finished()));
 }
 
 void AxialSliceWidget::setup(NIFTImage *fat, NIFTImage *water, TracingData *tracing)
@@ -26,6 +38,8 @@ void AxialSliceWidget::setup(NIFTImage *fat, NIFTImage *water, TracingData *trac
     waterImage = water;
     tracingData = tracing;
 
+    liveWireCostCache.setup(fat, water);
+
     location = QVector4D(0, 0, 0, 0);
 }
 
@@ -36,9 +50,17 @@ bool AxialSliceWidget::isLoaded() const
 
 void AxialSliceWidget::imageLoaded()
 {
-    sliceTexturePrimInit = false;
-    sliceTextureSecdInit = false;
-    this->traceTextureInit.fill(false);
+    // Any slice that is in progress is from the old image
+    sliceScheduler->cancel();
+
+    // The buffers for the slices are allocated once here and reused for every slice of the image
+    bufferPool.reserve(fatImage->getYDim(), fatImage->getXDim());
+
+    // The cost maps and the anchor of the live-wire are from the old image
+    liveWireCostCache.clear();
+    resetLiveWire();
+    if (drawMode == DrawMode::LiveWire)
+        liveWireCostCache.prefetch(location.z());
 
     dirty |= Dirty::Slice | Dirty::TracesAll;
     update();
@@ -50,6 +72,7 @@ void AxialSliceWidget::readSettings(QSettings &settings)
     brightness = settings.value("brightness", 0.0f).toFloat();
     brightnessThreshold = settings.value("brightnessThreshold", 0.0f).toFloat();
     contrast = settings.value("contrast", 1.0f).toFloat();
+    windowMode = (WindowMode)settings.value("windowMode", (int)WindowMode::PerSlice).toInt();
 
     primColorMap = (ColorMap)settings.value("primColorMap", (int)ColorMap::Gray).toInt();
     primOpacity = settings.value("primOpacity", 1.0f).toFloat();
@@ -68,7 +91,14 @@ void AxialSliceWidget::readSettings(QSettings &settings)
     settings.endArray();
 
     drawMode = (DrawMode)settings.value("drawMode", (int)DrawMode::Points).toInt();
+    liveWireCostCache.setImage((LiveWireImage)settings.value("liveWireImage", (int)LiveWireImage::Fat).toInt());
+    drawBrushWidth = settings.value("drawBrushWidth", 1).toInt();
+    drawBrushShape = (BrushShape)settings.value("drawBrushShape", (int)BrushShape::Square).toInt();
     eraserBrushWidth = settings.value("eraserBrushWidth", 1).toInt();
+    eraserBrushShape = (BrushShape)settings.value("eraserBrushShape", (int)BrushShape::Square).toInt();
+
+    // Memory budget for the undo records of tracing commands in megabytes
+    TracingHistory::setMemoryBudget((size_t)settings.value("undoMemoryBudget", 256).toULongLong() * 1024 * 1024);
 
     settings.endGroup();
 }
@@ -80,6 +110,7 @@ void AxialSliceWidget::writeSettings(QSettings &settings)
     settings.setValue("brightness", brightness);
     settings.setValue("brightnessThreshold", brightnessThreshold);
     settings.setValue("contrast", contrast);
+    settings.setValue("windowMode", (int)windowMode);
 
     settings.setValue("primColorMap", (int)primColorMap);
     settings.setValue("primOpacity", primOpacity);
@@ -98,7 +129,13 @@ void AxialSliceWidget::writeSettings(QSettings &settings)
     settings.endArray();
 
     settings.setValue("drawMode", (int)drawMode);
+    settings.setValue("liveWireImage", (int)liveWireCostCache.getImage());
+    settings.setValue("drawBrushWidth", drawBrushWidth);
+    settings.setValue("drawBrushShape", (int)drawBrushShape);
     settings.setValue("eraserBrushWidth", eraserBrushWidth);
+    settings.setValue("eraserBrushShape", (int)eraserBrushShape);
+
+    settings.setValue("undoMemoryBudget", (qulonglong)(TracingHistory::getMemoryBudget() / (1024 * 1024)));
 
     settings.endGroup();
 }
@@ -116,7 +153,20 @@ void AxialSliceWidget::setLocation(QVector4D location)
 
     // If Z value changed, then update the texture
     if (delta.z())
+    {
         dirty |= (Dirty::Slice | Dirty::TracesAll);
+        emit axialSliceChanged((int)this->location.z());
+
+        // The anchor of the live-wire is on the old slice. The cost map of the new slice is started now so it is likely
+        // ready by the time the first anchor is placed
+        resetLiveWire();
+        if (drawMode == DrawMode::LiveWire)
+            liveWireCostCache.prefetch(this->location.z());
+    }
+
+    // The crosshair line is part of the cached scene so it must be rendered again if the Y value changed
+    if (delta.y())
+        dirty |= Dirty::Scene;
 
     // Update location label
     if (locationLabel)
@@ -184,6 +234,7 @@ void AxialSliceWidget::setPrimColorMap(ColorMap map)
     }
 
     primColorMap = map;
+    dirty |= Dirty::Scene;
 
     // Redraw the screen because the screen colormap has changed
     update();
@@ -203,6 +254,7 @@ void AxialSliceWidget::setPrimOpacity(float opacity)
     }
 
     primOpacity = opacity;
+    dirty |= Dirty::Scene;
 
     // Redraw the screen because the opacity of one of the objects changed
     update();
@@ -223,6 +275,7 @@ void AxialSliceWidget::setSecdColorMap(ColorMap map)
     }
 
     secdColorMap = map;
+    dirty |= Dirty::Scene;
 
     // Redraw the screen because the screen colormap has changed
     update();
@@ -242,6 +295,7 @@ void AxialSliceWidget::setSecdOpacity(float opacity)
     }
 
     secdOpacity = opacity;
+    dirty |= Dirty::Scene;
 
     // Redraw the screen because the opacity of one of the objects changed
     update();
@@ -310,6 +364,58 @@ void AxialSliceWidget::setContrast(float contrast)
     update();
 }
 
+WindowMode AxialSliceWidget::getWindowMode() const
+{
+    return windowMode;
+}
+
+void AxialSliceWidget::setWindowMode(WindowMode mode)
+{
+    // If the window mode is out of the acceptable range, then do nothing
+    if (mode < WindowMode::PerSlice || mode > WindowMode::AutoPercentile)
+    {
+        qWarning() << "Invalid window mode was specified for AxialSliceWidget: " << (int)mode;
+        return;
+    }
+
+    // Nothing to do if the window mode is unchanged, this prevents the slice from being prepared and uploaded again
+    if (mode == windowMode)
+        return;
+
+    windowMode = mode;
+
+    // Redraw the screen because the window that is mapped to the color map has changed
+    dirty |= Dirty::Slice;
+    update();
+}
+
+int AxialSliceWidget::getLevelBias() const
+{
+    return levelBias;
+}
+
+void AxialSliceWidget::setLevelBias(int bias)
+{
+    if (bias < 0)
+    {
+        qWarning() << "Invalid level bias was specified for AxialSliceWidget: " << bias;
+        return;
+    }
+
+    levelBias = bias;
+
+    // The textures are created once the widget is initialized, the bias is applied to them then
+    if (slicePrimTexture)
+    {
+        slicePrimTexture->setLevelBias(levelBias);
+        sliceSecdTexture->setLevelBias(levelBias);
+    }
+
+    // Only the level that is drawn changes, the slice does not need to be prepared again
+    dirty |= Dirty::Scene;
+    update();
+}
+
 DrawMode AxialSliceWidget::getDrawMode() const
 {
     return drawMode;
@@ -319,9 +425,45 @@ void AxialSliceWidget::setDrawMode(DrawMode mode)
 {
     drawMode = mode;
 
+    resetLiveWire();
+    if (drawMode == DrawMode::LiveWire && isLoaded())
+        liveWireCostCache.prefetch(location.z());
+
     update();
 }
 
+int AxialSliceWidget::getDrawBrushWidth() const
+{
+    return drawBrushWidth;
+}
+
+void AxialSliceWidget::setDrawBrushWidth(int width)
+{
+    if (width < 1)
+    {
+        qWarning() << "Invalid draw brush width was specified for AxialSliceWidget: " << width;
+        return;
+    }
+
+    drawBrushWidth = width;
+}
+
+BrushShape AxialSliceWidget::getDrawBrushShape() const
+{
+    return drawBrushShape;
+}
+
+void AxialSliceWidget::setDrawBrushShape(BrushShape shape)
+{
+    if (shape < BrushShape::Square || shape > BrushShape::Round)
+    {
+        qWarning() << "Invalid draw brush shape was specified for AxialSliceWidget: " << (int)shape;
+        return;
+    }
+
+    drawBrushShape = shape;
+}
+
 int AxialSliceWidget::getEraserBrushWidth() const
 {
     return eraserBrushWidth;
@@ -334,6 +476,46 @@ void AxialSliceWidget::setEraserBrushWidth(int width)
     update();
 }
 
+BrushShape AxialSliceWidget::getEraserBrushShape() const
+{
+    return eraserBrushShape;
+}
+
+void AxialSliceWidget::setEraserBrushShape(BrushShape shape)
+{
+    if (shape < BrushShape::Square || shape > BrushShape::Round)
+    {
+        qWarning() << "Invalid eraser brush shape was specified for AxialSliceWidget: " << (int)shape;
+        return;
+    }
+
+    eraserBrushShape = shape;
+
+    // Redraw the screen to update the brush preview
+    update();
+}
+
+LiveWireImage AxialSliceWidget::getLiveWireImage() const
+{
+    return liveWireCostCache.getImage();
+}
+
+void AxialSliceWidget::setLiveWireImage(LiveWireImage image)
+{
+    // If the image is out of the acceptable range, then do nothing
+    if (image < LiveWireImage::Fat || image > LiveWireImage::FatFraction)
+    {
+        qWarning() << "Invalid live-wire image was specified for AxialSliceWidget: " << (int)image;
+        return;
+    }
+
+    // The edges of the new image are different, so the cached cost maps and the current wire are thrown away
+    liveWireCostCache.setImage(image);
+    resetLiveWire();
+    if (drawMode == DrawMode::LiveWire && isLoaded())
+        liveWireCostCache.prefetch(location.z());
+}
+
 TracingLayer AxialSliceWidget::getTracingLayer() const
 {
     return tracingLayer;
@@ -348,6 +530,10 @@ void AxialSliceWidget::setTracingLayer(TracingLayer layer)
         return;
     }
 
+    // The segments of the wire are added to the current layer, so a new wire is started on the new layer
+    if (layer != tracingLayer)
+        resetLiveWire();
+
     tracingLayer = layer;
 }
 
@@ -373,6 +559,9 @@ void AxialSliceWidget::setTracingLayerVisible(TracingLayer layer, bool value)
     }
 
     tracingLayerVisible[(int)layer] = value;
+    dirty |= Dirty::Scene;
+
+    emit tracingLayerVisibleChanged((int)layer, value);
 }
 
 TracingLayerData &AxialSliceWidget::getTraceSlices(TracingLayer layer)
@@ -385,92 +574,22 @@ TracingLayerData &AxialSliceWidget::getTraceSlices(TracingLayer layer)
 
 float &AxialSliceWidget::rscaling()
 {
+    // The reference returned is used to change the view so the cached scene will need to be rendered again
+    dirty |= Dirty::Scene;
     return scaling;
 }
 
 QVector3D &AxialSliceWidget::rtranslation()
 {
+    // The reference returned is used to change the view so the cached scene will need to be rendered again
+    dirty |= Dirty::Scene;
     return translation;
 }
 
 bool AxialSliceWidget::saveTracingData(QuaZip *zip)
 {
-    const QString layerFilename[(int)TracingLayer::Count] = {"EAT.txt", "IMAT.txt", "PAAT.txt", "PAT.txt", "SCAT.txt", "VAT.txt"};
-    const QString timeDir = "times";
-    QString layerTimePath[(int)TracingLayer::Count];
-
-    // Prepend timeDir to the layer filename to store the times
-    for (int i = 0; i < (int)TracingLayer::Count; ++i)
-        layerTimePath[i] = QDir(timeDir).filePath(layerFilename[i]);
-
-    for (int i = 0; i < (int)TracingLayer::Count; ++i)
-    {
-        // Begin by saving trace points
-        QuaZipFile sliceFile(zip);
-        if (!sliceFile.open(QIODevice::WriteOnly | QIODevice::Truncate, QuaZipNewInfo(layerFilename[i])))
-        {
-            qWarning() << "Error while creating tracing data file for " << layerFilename[i];
-            continue;
-        }
-
-        QTextStream sliceStream(&sliceFile);
-        sliceStream << fatImage->getZDim() << endl;
-
-        const int zDim = fatImage->getZDim();
-        for (int z = 0; z < zDim; ++z)
-        {
-            auto &traceLayer = (*tracingData)[i];
-            cv::Mat slice = traceLayer.getAxialSlice(z);
-
-            cv::Mat points;
-            opencv::findNonZero(slice, points);
-
-            // Only sort if there are points to sort
-            if (points.total() > 0)
-            {
-                // Sort based on Z, then Y, then X value.
-                std::sort(points.begin<cv::Vec2i>(), points.end<cv::Vec2i>(), [](const cv::Vec2i &a, const cv::Vec2i &b) {
-                    return !((a[0] >= b[0]) && (a[0] != b[0] || a[1] >= b[1]));
-                });
-            }
-
-            sliceStream << "#" << z << endl;
-            sliceStream << points.total() << endl;
-
-            for (size_t i = 0; i < points.total(); ++i)
-            {
-                const cv::Vec2i point = points.at<cv::Vec2i>((int)i);
-                sliceStream << forcepoint << (float)point[1] << " " << (float)point[0] << " " << (float)z << endl;
-            }
-        }
-
-        // Close slice file now that we are done with it
-        // Note: YOU CANNNOT HAVE TWO ZIP FILES OPENED AT ONCE SO BE CAREFUL
-        sliceFile.close();
-
-        // Save tracing time data next
-        QuaZipFile timeFile(zip);
-        if (!timeFile.open(QIODevice::WriteOnly | QIODevice::Truncate, QuaZipNewInfo(layerTimePath[i])))
-        {
-            qWarning() << "Error opening file to save time tracing data. Skipping layer: " << layerTimePath[i];
-            continue;
-        }
-
-        QTextStream timeStream(&timeFile);
-        timeStream << fatImage->getZDim() << endl;
-
-        for (int z = 0; z < zDim; ++z)
-        {
-            auto &traceLayer = (*tracingData)[i];
-
-            auto time = traceLayer.time[z];
-            auto h = std::chrono::duration_cast<std::chrono::hours>(time);
-            auto m = std::chrono::duration_cast<std::chrono::minutes>(time -= h);
-            auto s = std::chrono::duration_cast<std::chrono::seconds>(time -= m);
-            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(time -= s);
-            timeStream << "#" << z << " " << h.count() << "h " << m.count() << "m " << s.count() << "s " << ms.count() << "ms" << endl;
-        }
-    }
+    if (!tracingData->save(zip))
+        return false;
 
     // Set stack to clean to notify the application that no unsaved changes are present
     undoStack->setClean();
@@ -486,6 +605,25 @@ bool AxialSliceWidget::loadTracingData(QuaZip *zip)
         return false;
     }
 
+    if (!confirmReplaceTracingData())
+        return false;
+
+    if (!tracingData->load(zip))
+        return false;
+
+    tracingDataReplaced();
+    return true;
+}
+
+/* confirmReplaceTracingData asks the user whether the current tracing data should be discarded if there is data in the
+ * fat layers and it has been changed since it was last saved.
+ *
+ * Returns:
+ *      true - The tracing data can be replaced
+ *      false - The user chose to keep the current tracing data
+ */
+bool AxialSliceWidget::confirmReplaceTracingData()
+{
     bool hasData = false;
     for (auto &layer : this->tracingData->layers)
     {
@@ -505,107 +643,12 @@ bool AxialSliceWidget::loadTracingData(QuaZip *zip)
             return false;
     }
 
-    const QString layerFilename[(int)TracingLayer::Count] = {"EAT.txt", "IMAT.txt", "PAAT.txt", "PAT.txt", "SCAT.txt", "VAT.txt"};
-    const QString timeDir = "times";
-    QString layerTimePath[(int)TracingLayer::Count];
-
-    // Prepend timeDir to the layer filename to store the times
-    for (int i = 0; i < (int)TracingLayer::Count; ++i)
-        layerTimePath[i] = QDir(timeDir).filePath(layerFilename[i]);
-
-    for (int i = 0; i < (int)TracingLayer::Count; ++i)
-    {
-        // Set current file to the current layer to load
-        zip->setCurrentFile(layerFilename[i]);
-
-        // Begin by loading trace points
-        QuaZipFile sliceFile(zip);
-        if (!sliceFile.open(QIODevice::ReadOnly))
-        {
-            qWarning() << "Error while creating tracing data file for " << layerFilename[i];
-            continue;
-        }
-
-        QTextStream sliceStream(&sliceFile);
-        int zDim;
-        sliceStream >> zDim;
-
-        if (zDim != fatImage->getZDim())
-        {
-            qWarning() << "Number of axial slices in the data does not match the NIFTI image loaded.";
-            return false; // Note: Return false because the other layers should be mismatched as well
-        }
-
-        auto &layer = (*tracingData)[i];
-
-        // Discard previous data by setting everything to 0
-        layer.data.setTo(0);
-
-        for (int z = 0; z < zDim; ++z)
-        {
-            // Skip the #Z where Z is the axial slice
-            sliceStream.skipWhiteSpace();
-            sliceStream.readLine();
-
-            // Get the number of points on the slices
-            int numPoints = 0;
-            sliceStream >> numPoints;
-
-            float x, y, z_;
-            for (int ii = 0; ii < numPoints; ++ii)
-            {
-                sliceStream >> x >> y >> z_;
-
-                if ((z < 0 || z >= fatImage->getZDim()) || (y < 0 || y >= fatImage->getYDim()) || (x < 0 || x >= fatImage->getXDim()))
-                {
-                    qWarning() << "A point specified was outside the boundary of the current NIFTI image: (" << z << "," << y << "," << x << ")";
-                    return false;
-                }
-
-                layer.set(x, y, z);
-            }
-        }
-
-        // Close slice file now that we are done with it
-        // Note: YOU CANNOT HAVE TWO ZIP FILES OPENED AT ONCE SO BE CAREFUL
-        sliceFile.close();
-
-        // Load tracing time data next
-        // Set current file to the current time layer to load
-        zip->setCurrentFile(layerTimePath[i]);
-
-        QuaZipFile timeFile(zip);
-        if (!timeFile.open(QIODevice::ReadOnly))
-        {
-            qWarning() << "Error opening file to save time tracing data. Skipping layer: " << layerTimePath[i];
-            continue;
-        }
-
-        QTextStream timeStream(&timeFile);
-
-        timeStream >> zDim;
-
-        if (zDim != fatImage->getZDim())
-        {
-            qWarning() << "Number of axial slices in the time data does not match the NIFTI image loaded.";
-            return false; // Note: Return false because the other layers should be mismatched as well
-        }
-
-        for (int z = 0; z < zDim; ++z)
-        {
-            // Skip the #Z where Z is the axial slice
-            timeStream.skipWhiteSpace();
-
-            // Read timing
-            char dummy;
-            int z__;
-            QString str;
-            unsigned int h, m, s, ms;
-            timeStream >> dummy >> z__ >> ws >> h >> str >> ws >> m >> str >> ws >> s >> str >> ws >> ms >> str >> ws;
-            layer.time[z] = (std::chrono::hours(h) + std::chrono::minutes(m) + std::chrono::seconds(s) + std::chrono::milliseconds(ms));
-        }
-    }
+    return true;
+}
 
+// Called after the layers of the tracing data were replaced outside of the undo stack
+void AxialSliceWidget::tracingDataReplaced()
+{
     // Clear the undoStack so that all of the tracing commands are deleted from beforehand
     // This may cause unwanted commands to be deleted but it is okay
     undoStack->clear();
@@ -613,8 +656,7 @@ bool AxialSliceWidget::loadTracingData(QuaZip *zip)
     // Update all traces textures and update screen
     dirty |= Dirty::TracesAll;
     update();
-
-    return true;
+    emit tracesReset();
 }
 
 QMatrix4x4 AxialSliceWidget::getMVPMatrix() const
@@ -662,11 +704,31 @@ QMatrix4x4 AxialSliceWidget::getNIFTIToOpenGLMatrix(bool includeMVP, bool flipY)
 }
 
 
+float AxialSliceWidget::getFPS() const
+{
+    return fps;
+}
+
+const SliceBufferPool &AxialSliceWidget::getBufferPool() const
+{
+    return bufferPool;
+}
+
 void AxialSliceWidget::setUndoStack(QUndoStack *stack)
 {
     undoStack = stack;
 }
 
+TracingHistory *AxialSliceWidget::getTracingHistory() const
+{
+    return tracingHistory;
+}
+
+void AxialSliceWidget::setTracingHistory(TracingHistory *history)
+{
+    tracingHistory = history;
+}
+
 void AxialSliceWidget::setDirty(int bit)
 {
     dirty |= bit;
@@ -679,9 +741,49 @@ void AxialSliceWidget::resetView()
     scaling = 1.0f;
 
     // Update the screen
+    dirty |= Dirty::Scene;
     update();
 }
 
+bool AxialSliceWidget::getRecordViewHistory() const
+{
+    return recordViewHistory;
+}
+
+void AxialSliceWidget::setRecordViewHistory(bool record)
+{
+    recordViewHistory = record;
+}
+
+void AxialSliceWidget::finishPanGesture()
+{
+    if (!startPan)
+        return;
+
+    // Apply the panning that is still queued for the next frame
+    processInputQueue();
+    startPan = false;
+
+    // The view was already moved, the command is only pushed so the entire pan can be undone
+    if (recordViewHistory && !panGestureDelta.isNull())
+        undoStack->push(new AxialMoveCommand(panGestureDelta, this));
+
+    panGestureDelta = QPointF();
+}
+
+void AxialSliceWidget::finishZoomGesture()
+{
+    if (!startZoom)
+        return;
+
+    zoomGestureTimer->stop();
+    startZoom = false;
+
+    // The view was already scaled, the command is only pushed so the entire zoom can be undone
+    if (recordViewHistory && scaling != zoomGestureStartScaling)
+        undoStack->push(new AxialScaleCommand(zoomGestureStartScaling, scaling, this));
+}
+
 void AxialSliceWidget::initializeGL()
 {
     if (!initializeOpenGLFunctions())
@@ -698,32 +800,12 @@ void AxialSliceWidget::initializeGL()
     scaling = 1.0f;
     translation = QVector3D(0.0f, 0.0f, 0.0f);
 
-    sliceProgram = new QOpenGLShaderProgram();
-    sliceProgram->addShaderFromSourceFile(QOpenGLShader::Vertex, ":/shaders/axialslice.vert");
-    sliceProgram->addShaderFromSourceFile(QOpenGLShader::Fragment, ":/shaders/axialslice.frag");
-    sliceProgram->link();
-    sliceProgram->bind();
-    if (!sliceProgram->log().isEmpty())
-        qDebug() << "Slice Program Log: " << sliceProgram->log();
-    glCheckError();
-
-    sliceProgram->setUniformValue("tex", 0);
-    sliceProgram->setUniformValue("mappingTexture", 1);
-
-    traceProgram = new QOpenGLShaderProgram();
-    traceProgram->addShaderFromSourceFile(QOpenGLShader::Vertex, ":/shaders/fattraces.vert");
-    traceProgram->addShaderFromSourceFile(QOpenGLShader::Fragment, ":/shaders/fattraces.frag");
-    traceProgram->link();
-    traceProgram->bind();
-    if (!traceProgram->log().isEmpty())
-        qDebug() << "Trace Program Log: " << traceProgram->log();
-    glCheckError();
-
-    traceProgram->setUniformValue("tex", 0);
+    // Shader programs, quad buffers and color maps are created by the first slice widget and shared with the others
+    resources = GLResources::acquire();
+    quadVertexObject = resources->createQuadVertexArray();
 
     initializeSliceView();
     initializeTracing();
-    initializeColorMaps();
 
     fpsTimer.start();
     frameCount = 0;
@@ -742,379 +824,162 @@ void AxialSliceWidget::initializeSliceView()
     qDebug() << "                    GLSL VERSION: " << (const char*)glGetString(GL_SHADING_LANGUAGE_VERSION);
     qDebug() << "";
 
-    sliceTexturePrimInit = false;
-    sliceTextureSecdInit = false;
-
-    // Setup the axial slice vertices
-    sliceVertices.clear();
-    sliceVertices.append(VertexPT(QVector3D(-1.0f, -1.0f, 0.0f), QVector2D(0.0f, 0.0f)));
-    sliceVertices.append(VertexPT(QVector3D(-1.0f, 1.0f, 0.0f), QVector2D(0.0f, 1.0f)));
-    sliceVertices.append(VertexPT(QVector3D(1.0f, -1.0f, 0.0f), QVector2D(1.0f, 0.0f)));
-    sliceVertices.append(VertexPT(QVector3D(1.0f, 1.0f, 0.0f), QVector2D(1.0f, 1.0f)));
-
-    // Setup the axial slice indices
-    sliceIndices.clear();
-    sliceIndices.append({ 0, 1, 2, 3});
-
-    // Generate vertex buffer for the axial slice. The sliceVertices data is uploaded to the VBO
-    glGenBuffers(1, &sliceVertexBuf);
-    glBindBuffer(GL_ARRAY_BUFFER, sliceVertexBuf);
-    glBufferData(GL_ARRAY_BUFFER, sliceVertices.size() * sizeof(VertexPT), sliceVertices.constData(), GL_STATIC_DRAW);
-    glCheckError();
-
-    // Generate index buffer for the axial slice. The sliceIndices data is uploaded to the IBO
-    glGenBuffers(1, &sliceIndexBuf);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, sliceIndexBuf);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sliceIndices.size() * sizeof(GLushort), sliceIndices.constData(), GL_STATIC_DRAW);
-    glCheckError();
-
-    // Generate VAO for the axial slice vertices uploaded. Location 0 is the position and location 1 is the texture position
-    glGenVertexArrays(1, &sliceVertexObject);
-    glBindVertexArray(sliceVertexObject);
-    glEnableVertexAttribArray(0);
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(0, VertexPT::PosTupleSize, GL_FLOAT, true, VertexPT::stride(), static_cast<const char *>(0) + VertexPT::posOffset());
-    glVertexAttribPointer(1, VertexPT::TexPosTupleSize, GL_FLOAT, true, VertexPT::stride(), static_cast<const char *>(0) + VertexPT::texPosOffset());
-    glCheckError();
-
-    // Generate a blank texture for the axial slice
-    glGenTextures(1, &this->slicePrimTexture);
-    glGenTextures(1, &this->sliceSecdTexture);
-    glCheckError();
-
-    // Release (unbind) all
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+    // The slices are linearly interpolated when stretching or shrinking to the screen which smooths out the pixel values
+    // instead of making them look blocky. The internal format is 32 bit floats with one channel for red
+    slicePrimTexture = new TiledTexture(GL_R32F, GL_LINEAR);
+    sliceSecdTexture = new TiledTexture(GL_R32F, GL_LINEAR);
+    slicePrimTexture->setLevelBias(levelBias);
+    sliceSecdTexture->setLevelBias(levelBias);
 }
 
 void AxialSliceWidget::initializeTracing()
 {
-    this->traceTextureInit.fill(false);
-
-    // Setup the trace vertices
-    traceVertices.clear();
-    traceVertices.append(VertexPT(QVector3D(-1.0f, -1.0f, 0.0f), QVector2D(0.0f, 0.0f)));
-    traceVertices.append(VertexPT(QVector3D(-1.0f, 1.0f, 0.0f), QVector2D(0.0f, 1.0f)));
-    traceVertices.append(VertexPT(QVector3D(1.0f, -1.0f, 0.0f), QVector2D(1.0f, 0.0f)));
-    traceVertices.append(VertexPT(QVector3D(1.0f, 1.0f, 0.0f), QVector2D(1.0f, 1.0f)));
-
-    // Setup the trace indices
-    traceIndices.clear();
-    traceIndices.append({ 0, 1, 2, 3});
-
-    // Generate vertex buffer for the axial slice. The sliceVertices data is uploaded to the VBO
-    glGenBuffers(1, &traceVertexBuf);
-    glBindBuffer(GL_ARRAY_BUFFER, traceVertexBuf);
-    glBufferData(GL_ARRAY_BUFFER, traceVertices.size() * sizeof(VertexPT), traceVertices.constData(), GL_STATIC_DRAW);
-    glCheckError();
-
-    // Generate index buffer for the axial slice. The sliceIndices data is uploaded to the IBO
-    glGenBuffers(1, &traceIndexBuf);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, traceIndexBuf);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, traceIndices.size() * sizeof(GLushort), traceIndices.constData(), GL_STATIC_DRAW);
-    glCheckError();
-
-    // Generate VAO for the axial slice vertices uploaded. Location 0 is the position and location 1 is the texture position
-    glGenVertexArrays(1, &traceVertexObject);
-    glBindVertexArray(traceVertexObject);
-    glEnableVertexAttribArray(0);
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(0, VertexPT::PosTupleSize, GL_FLOAT, true, VertexPT::stride(), static_cast<const char *>(0) + VertexPT::posOffset());
-    glVertexAttribPointer(1, VertexPT::TexPosTupleSize, GL_FLOAT, true, VertexPT::stride(), static_cast<const char *>(0) + VertexPT::texPosOffset());
-    glCheckError();
-
-    // Generate a blank texture for the axial slice
-    glGenTextures((int)TracingLayer::Count, &this->traceTextures[0]);
-    glCheckError();
-
-    // Release (unbind) all
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+    // The traces use the nearest pixel value so each traced pixel is a sharp square. The internal format is an 8 bit char
+    // with one channel for red
+    for (auto &texture : traceTextures)
+        texture = new TiledTexture(GL_R8, GL_NEAREST);
 }
 
-void AxialSliceWidget::initializeColorMaps()
+SliceResult AxialSliceWidget::prepareSlice(cv::Mat fatVolume, cv::Mat waterVolume, IntensityWindow fatWindow, IntensityWindow waterWindow,
+                                           int z, SliceDisplayType type, float brightness, float brightnessThreshold, float contrast,
+                                           SliceBuffers buffers)
 {
-    // Internal format is how the data will be stored in the GPU. Format/type is how the data is represented
-    const GLint internalFormat = GL_RGBA32F;
-    const GLenum format = GL_RGBA;
-    const GLenum type = GL_UNSIGNED_BYTE;
+    SliceResult result;
+    result.slice = z;
 
-    // Create textures for each of the color maps
-    glGenTextures((GLsizei)ColorMap::Count, &this->colorMapTexture[0]);
-    glCheckError();
-
-    for (int i = 0; i < (int)ColorMap::Count; ++i)
+    if (z < 0 || z >= fatVolume.size[0] || z >= waterVolume.size[0])
     {
-        QPixmap pixmap;
-
-        if (!pixmap.load(colorMapImageName[i]))
-        {
-            qWarning() << "Unable to load color map number " << i << " located at " << colorMapImageName[i];
-            continue;
-        }
-
-        // For simplicity, just convert the image to a 32-bit value. That way we know what the format is
-        QImage image = pixmap.toImage().convertToFormat(QImage::Format_RGBA8888);
-
-        if (image.height() != 1)
-        {
-            qWarning() << "Height must be 1 for color map number " << i << " located at " << colorMapImageName[i] << ": " << image.height();
-            continue;
-        }
-
-        // This is a formula to determine if a number is a power of two easily. If equal to zero, it is a power of two
-        if ((image.width() & (image.width() - 1)) != 0)
-        {
-            qWarning() << "Width must be power of two for color map number " << i << " located at " << colorMapImageName[i] << ": " << image.width();
-            continue;
-        }
-
-        // Bind the texture and setup the parameters for it
-        glBindTexture(GL_TEXTURE_1D, colorMapTexture[i]);
-        // These parameters say that the color value for a pixel will be chosen based on the nearest pixel value. This creates a more blocky effect
-        // since it will not be linearly interpolated like GL_LINEAR
-        glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-        // This parameter will clamp points to [0.0, 1.0]. This means that anything above 1.0 will become 1.0
-        // and anything below 0.0 will become 0.0
-        //glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_WRAP_S, GL_CLAMP);
-        glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glCheckError();
-
-        glTexImage1D(GL_TEXTURE_1D, 0, internalFormat, image.width(), 0, format, type, image.bits());
-        glCheckError();
+        qWarning() << "Unable to retrieve axial slice " << z << " from the fat or water image. Slice is out of range.";
+        return result;
     }
-}
 
-void AxialSliceWidget::updateTexture()
-{
-    cv::Mat primMatrix;
-    cv::Mat secdMatrix;
-    switch (displayType)
+    // Converts the slice to a 32-bit float where the window is mapped to 0.0f to 1.0f. The window is looked up from the
+    // statistics of the image so this is a single pass over the slice. The output is one of the buffers from the pool so
+    // this does not affect the original 3D matrix. The slice is reshaped to 2D first, otherwise convertTo would allocate
+    // a 3D output instead of writing to the buffer
+    auto getSlice = [z](const cv::Mat &volume, const IntensityWindow &window, cv::Mat &slice)
     {
-        case SliceDisplayType::FatOnly:
-        {
-            // Get the slice for the fat image. If the result is empty then there was an error retrieving the slice
-            primMatrix = fatImage->getAxialSlice(location.z(), true);
-            if (primMatrix.empty())
-            {
-                qWarning() << "Unable to retrieve axial slice " << location.z() << " from the fat image. Matrix returned empty.";
-                return;
-            }
+        const cv::Range region[] = { cv::Range(z, z + 1), cv::Range::all(), cv::Range::all() };
+        int dims[] = { volume.size[1], volume.size[2] };
 
-            // The normalize function does quite a bit here. It converts the matrix to a 32-bit float and normalizes it
-            // between 0.0f to 1.0f based on the min/max value. This does not affect the original 3D matrix in fatImage
-            cv::normalize(primMatrix.clone(), primMatrix, 0.0f, 1.0f, cv::NORM_MINMAX, CV_32FC1);
-        }
-        break;
+        const double alpha = (window.max > window.min) ? 1.0 / (window.max - window.min) : 0.0;
+        cv::Mat(volume, region).reshape(0, 2, dims).convertTo(slice, CV_32FC1, alpha, -window.min * alpha);
+    };
 
-        case SliceDisplayType::WaterOnly:
-        {
-            // Get the slice for the water image. If the result is empty then there was an error retrieving the slice
-            primMatrix = waterImage->getAxialSlice(location.z(), true);
-            if (primMatrix.empty())
-            {
-                qWarning() << "Unable to retrieve axial slice " << location.z() << " from the water image. Matrix returned empty.";
-                return;
-            }
+    bool hasSecondary = false;
 
-            // The normalize function does quite a bit here. It converts the matrix to a 32-bit float and normalizes it
-            // between 0.0f to 1.0f based on the min/max value. This does not affect the original 3D matrix in waterImage
-            cv::normalize(primMatrix.clone(), primMatrix, 0.0f, 1.0f, cv::NORM_MINMAX, CV_32FC1);
-        }
-        break;
+    // The fractions are computed with the output functions of OpenCV instead of matrix expressions, which would allocate
+    // a temporary for each operation
+    switch (type)
+    {
+        case SliceDisplayType::FatOnly: getSlice(fatVolume, fatWindow, buffers.primMatrix); break;
+        case SliceDisplayType::WaterOnly: getSlice(waterVolume, waterWindow, buffers.primMatrix); break;
 
         case SliceDisplayType::FatFraction:
-        {
-            // Get the slice for the fat/water image. If the result is empty then there was an error retrieving the slice
-            cv::Mat fatTemp = fatImage->getAxialSlice(location.z(), true);
-            cv::Mat waterTemp = waterImage->getAxialSlice(location.z(), true);
-            if (fatTemp.empty() || waterTemp.empty())
-            {
-                qWarning() << "Unable to retrieve axial slice " << location.z() << " from the fat or water image. Matrix returned empty.";
-                return;
-            }
-
-            // The normalize function does quite a bit here. It converts the matrix to a 32-bit float and normalizes it
-            // between 0.0f to 1.0f based on the min/max value. This does not affect the original 3D matrix in fatImage/waterImage
-            cv::normalize(fatTemp.clone(), fatTemp, 0.0f, 1.0f, cv::NORM_MINMAX, CV_32FC1);
-            cv::normalize(waterTemp.clone(), waterTemp, 0.0f, 1.0f, cv::NORM_MINMAX, CV_32FC1);
-
-            primMatrix = fatTemp / (fatTemp + waterTemp);
-        }
-        break;
+            getSlice(fatVolume, fatWindow, buffers.fatTemp);
+            getSlice(waterVolume, waterWindow, buffers.waterTemp);
+            cv::add(buffers.fatTemp, buffers.waterTemp, buffers.primMatrix);
+            cv::divide(buffers.fatTemp, buffers.primMatrix, buffers.primMatrix);
+            break;
 
         case SliceDisplayType::WaterFraction:
-        {
-            // Get the slice for the fat/water image. If the result is empty then there was an error retrieving the slice
-            cv::Mat fatTemp = fatImage->getAxialSlice(location.z(), true);
-            cv::Mat waterTemp = waterImage->getAxialSlice(location.z(), true);
-            if (fatTemp.empty() || waterTemp.empty())
-            {
-                qWarning() << "Unable to retrieve axial slice " << location.z() << " from the fat or water image. Matrix returned empty.";
-                return;
-            }
-
-            // The normalize function does quite a bit here. It converts the matrix to a 32-bit float and normalizes it
-            // between 0.0f to 1.0f based on the min/max value. This does not affect the original 3D matrix in fatImage/waterImage
-            cv::normalize(fatTemp.clone(), fatTemp, 0.0f, 1.0f, cv::NORM_MINMAX, CV_32FC1);
-            cv::normalize(waterTemp.clone(), waterTemp, 0.0f, 1.0f, cv::NORM_MINMAX, CV_32FC1);
-
-            primMatrix = waterTemp / (fatTemp + waterTemp);
-        }
-        break;
+            getSlice(fatVolume, fatWindow, buffers.fatTemp);
+            getSlice(waterVolume, waterWindow, buffers.waterTemp);
+            cv::add(buffers.fatTemp, buffers.waterTemp, buffers.primMatrix);
+            cv::divide(buffers.waterTemp, buffers.primMatrix, buffers.primMatrix);
+            break;
 
+        // The secondary matrix is drawn on top of the primary matrix
         case SliceDisplayType::FatWater:
-        {
-            // Get the slice for the fat image. If the result is empty then there was an error retrieving the slice
-            primMatrix = fatImage->getAxialSlice(location.z(), true);
-            if (primMatrix.empty())
-            {
-                qWarning() << "Unable to retrieve axial slice " << location.z() << " from the fat image. Matrix returned empty.";
-                return;
-            }
-
-            // The normalize function does quite a bit here. It converts the matrix to a 32-bit float and normalizes it
-            // between 0.0f to 1.0f based on the min/max value. This does not affect the original 3D matrix in fatImage
-            cv::normalize(primMatrix.clone(), primMatrix, 0.0f, 1.0f, cv::NORM_MINMAX, CV_32FC1);
-
-            // Get the slice for the water image. If the result is empty then there was an error retrieving the slice
-            // The secondary matrix is the water image in this case
-            secdMatrix = waterImage->getAxialSlice(location.z(), true);
-            if (secdMatrix.empty())
-            {
-                qWarning() << "Unable to retrieve axial slice " << location.z() << " from the water image. Matrix returned empty.";
-                return;
-            }
-
-            // The normalize function does quite a bit here. It converts the matrix to a 32-bit float and normalizes it
-            // between 0.0f to 1.0f based on the min/max value. This does not affect the original 3D matrix in waterImage
-            cv::normalize(secdMatrix.clone(), secdMatrix, 0.0f, 1.0f, cv::NORM_MINMAX, CV_32FC1);
-        }
-        break;
+            getSlice(fatVolume, fatWindow, buffers.primMatrix);
+            getSlice(waterVolume, waterWindow, buffers.secdMatrix);
+            hasSecondary = true;
+            break;
 
         case SliceDisplayType::WaterFat:
-        {
-            // Get the slice for the fat image. If the result is empty then there was an error retrieving the slice
-            primMatrix = waterImage->getAxialSlice(location.z(), true);
-            if (primMatrix.empty())
-            {
-                qWarning() << "Unable to retrieve axial slice " << location.z() << " from the water image. Matrix returned empty.";
-                return;
-            }
-
-            // The normalize function does quite a bit here. It converts the matrix to a 32-bit float and normalizes it
-            // between 0.0f to 1.0f based on the min/max value. This does not affect the original 3D matrix in fatImage
-            cv::normalize(primMatrix.clone(), primMatrix, 0.0f, 1.0f, cv::NORM_MINMAX, CV_32FC1);
-
-            // Get the slice for the water image. If the result is empty then there was an error retrieving the slice
-            // The secondary matrix is the water image in this case
-            secdMatrix = fatImage->getAxialSlice(location.z(), true);
-            if (secdMatrix.empty())
-            {
-                qWarning() << "Unable to retrieve axial slice " << location.z() << " from the fat image. Matrix returned empty.";
-                return;
-            }
-
-            // The normalize function does quite a bit here. It converts the matrix to a 32-bit float and normalizes it
-            // between 0.0f to 1.0f based on the min/max value. This does not affect the original 3D matrix in waterImage
-            cv::normalize(secdMatrix.clone(), secdMatrix, 0.0f, 1.0f, cv::NORM_MINMAX, CV_32FC1);
-        }
-        break;
+            getSlice(waterVolume, waterWindow, buffers.primMatrix);
+            getSlice(fatVolume, fatWindow, buffers.secdMatrix);
+            hasSecondary = true;
+            break;
     }
 
-    // Apply brightness and contrast to primary matrix
-    auto mask = (primMatrix >= brightnessThreshold);
-    cv::add(primMatrix, brightness, primMatrix, mask);
+    result.primMatrix = buffers.primMatrix;
+    if (hasSecondary)
+        result.secdMatrix = buffers.secdMatrix;
 
-    primMatrix *= contrast;
+    // Apply brightness and contrast to the primary and secondary matrix
+    for (cv::Mat *matrix : { &result.primMatrix, &result.secdMatrix })
+    {
+        if (matrix->empty())
+            continue;
 
-    // Bind the texture and setup the parameters for it
-    glBindTexture(GL_TEXTURE_2D, slicePrimTexture);
-    // These parameters basically say the pixel value is equal to the average of the nearby pixel values when magnifying or minifying the values
-    // Essentially, when stretching or shrinking the texture to the screen, it will smooth out the pixel values instead of making it look blocky
-    // like GL_NEAREST would.
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glCheckError();
+        cv::compare(*matrix, brightnessThreshold, buffers.mask, cv::CMP_GE);
+        cv::add(*matrix, brightness, *matrix, buffers.mask);
 
-    // Get the OpenGL datatype of the matrix
-    auto dataType = NumericType::OpenCV(primMatrix.type());
-    // Upload the texture data from the matrix to the texture. The internal format is 32 bit floats with one channel for red
-    // If it hasnt been initialized yet or needs to be reinitialized to a different size, use glTexImage2D, otherwise use
-    // the quicker method glTexSubImage2D which just overwrites old data
-    if (!sliceTexturePrimInit)
-    {
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_R32F, fatImage->getXDim(), fatImage->getYDim(), 0, dataType->openGLFormat, dataType->openGLType, primMatrix.data);
-        sliceTexturePrimInit = true;
+        *matrix *= contrast;
     }
-    else
-        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, fatImage->getXDim(), fatImage->getYDim(), dataType->openGLFormat, dataType->openGLType, primMatrix.data);
 
-    glCheckError();
+    // The smaller levels are built here as well so the GUI thread only has to upload the level that is visible
+    TiledTexture::buildPyramid(result.primMatrix, buffers.primPyramid);
+    result.primPyramid = buffers.primPyramid;
 
-    // Repeat the process if the second matrix is available
-    if (!secdMatrix.empty())
+    if (hasSecondary)
     {
-        // Apply brightness and contrast to secondary matrix
-        auto mask = (secdMatrix >= brightnessThreshold);
-        cv::add(secdMatrix, brightness, secdMatrix, mask);
-
-        secdMatrix *= contrast;
-
-        glBindTexture(GL_TEXTURE_2D, sliceSecdTexture);
-
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glCheckError();
-
-        dataType = NumericType::OpenCV(primMatrix.type());
+        TiledTexture::buildPyramid(result.secdMatrix, buffers.secdPyramid);
+        result.secdPyramid = buffers.secdPyramid;
+    }
 
-        // If it hasnt been initialized yet or needs to be reinitialized to a different size, use glTexImage2D, otherwise use
-        // the quicker method glTexSubImage2D which just overwrites old data
-        if (!sliceTextureSecdInit)
-        {
-            glTexImage2D(GL_TEXTURE_2D, 0, GL_R32F, fatImage->getXDim(), fatImage->getYDim(), 0, dataType->openGLFormat, dataType->openGLType, secdMatrix.data);
-            sliceTextureSecdInit = true;
-        }
-        else
-            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, fatImage->getXDim(), fatImage->getYDim(), dataType->openGLFormat, dataType->openGLType, secdMatrix.data);
+    return result;
+}
 
-        glCheckError();
-    }
+void AxialSliceWidget::requestSlice()
+{
+    // Everything the job needs is copied since it runs on another thread. The volumes are shallow copies which keeps the data
+    // alive if a new image is loaded while the job is running
+    const std::vector<cv::Range> all = { cv::Range::all(), cv::Range::all(), cv::Range::all() };
+    const cv::Mat fatVolume = fatImage->getRegion(all);
+    const cv::Mat waterVolume = waterImage->getRegion(all);
+    const int z = location.z();
+    const IntensityWindow fatWindow = fatImage->getAxialWindow(z, windowMode);
+    const IntensityWindow waterWindow = waterImage->getAxialWindow(z, windowMode);
+    const SliceDisplayType type = displayType;
+    const float brightness = this->brightness;
+    const float brightnessThreshold = this->brightnessThreshold;
+    const float contrast = this->contrast;
+    // The job keeps the buffers in use until its result is no longer displayed
+    const SliceBuffers buffers = bufferPool.acquire();
+
+    sliceScheduler->request([=]()
+    {
+        return prepareSlice(fatVolume, waterVolume, fatWindow, waterWindow, z, type, brightness, brightnessThreshold, contrast, buffers);
+    });
 
     dirty &= ~Dirty::Slice;
 }
 
-void AxialSliceWidget::updateTrace(TracingLayer layer)
+void AxialSliceWidget::updateTexture(const SliceResult &result)
 {
-    // Bind the texture and setup the parameters for it
-    glBindTexture(GL_TEXTURE_2D, traceTextures[(int)layer]);
-    // Set pixel parameters
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-    glCheckError();
+    // An empty result means there was an error preparing the slice, the warning is shown in prepareSlice
+    if (result.primMatrix.empty())
+        return;
 
-    // Grab current slice of the tracing data matrix at given layer
-    cv::Mat matrix = (*tracingData)[layer].getAxialSlice(location.z());
+    // The tiles are uploaded from the matrix the next time they are drawn and visible
+    slicePrimTexture->setImage(result.primPyramid);
 
-    // Get the OpenGL datatype of the matrix
-    auto dataType = NumericType::OpenCV(matrix.type());
+    // Repeat the process if the second matrix is available
+    sliceSecdVisible = !result.secdMatrix.empty();
+    if (sliceSecdVisible)
+        sliceSecdTexture->setImage(result.secdPyramid);
 
-    // Upload the texture data from the matrix to the texture. The internal format is an 8 bit char with one channel for red
-    // If it hasnt been initialized yet or needs to be reinitialized to a different size, use glTexImage2D, otherwise use
-    // the quicker method glTexSubImage2D which just overwrites old data
-    if (!traceTextureInit[(int)layer])
-    {
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, fatImage->getXDim(), fatImage->getYDim(), 0, dataType->openGLFormat, dataType->openGLType, matrix.data);
-        traceTextureInit[(int)layer] = true;
-    }
-    else
-        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, fatImage->getXDim(), fatImage->getYDim(), dataType->openGLFormat, dataType->openGLType, matrix.data);
+    // The new slice needs to be drawn in the cached scene
+    dirty |= Dirty::Scene;
+}
 
-    glCheckError();
+void AxialSliceWidget::updateTrace(TracingLayer layer)
+{
+    // Grab current slice of the tracing data matrix at given layer. The tiles are uploaded from it the next time they are
+    // drawn and visible
+    traceTextures[(int)layer]->setImage((*tracingData)[layer].getAxialSlice(location.z()));
 
     dirty &= ~Dirty::Trace(layer);
 }
@@ -1139,22 +1004,115 @@ void AxialSliceWidget::paintGL()
     {
         fps = frameCount / (fpsTimer.restart() / 1000.0f);
         frameCount = 0;
+        emit frameStatsUpdated();
+    }
+
+    if (firstFrame)
+    {
+        firstFrame = false;
+        emit firstFrameRendered();
     }
 
     // Do nothing if fat/water images are not loaded
     if (!isLoaded())
         return;
 
-    // Update relevant OpenGL objects if dirty
+    // Rasterize the strokes and apply the panning that occurred since the last frame
+    processInputQueue();
+
+    // A change in the trace textures changes the cached scene as well
+    if (dirty & Dirty::TracesAll)
+        dirty |= Dirty::Scene;
+
+    // The slice is prepared on a worker thread when it changes. The texture is updated on the frame after it is ready and
+    // older requests that were not started are dropped, so the display catches up to the latest slice without lagging behind
     if (dirty & Dirty::Slice)
-        updateTexture();
+        requestSlice();
+
+    SliceResult sliceResult;
+    if (sliceScheduler->takeResult(sliceResult))
+        updateTexture(sliceResult);
 
     for (int i = 0; i < (int)TracingLayer::Count; ++i)
         if (dirty & Dirty::Trace((TracingLayer)i))
             updateTrace((TracingLayer)i);
 
-    // After updating, begin rendering
-    QPainter painter(this);
+    // (Re)create the scene FBO when the size of the widget changes, this will render the scene again
+    const QSize sceneSize = size() * devicePixelRatioF();
+    if (!sceneFBO || sceneFBO->size() != sceneSize)
+    {
+        delete sceneFBO;
+        sceneFBO = new QOpenGLFramebufferObject(sceneSize);
+        dirty |= Dirty::Scene;
+    }
+
+    // Only render the slices and traces when something has changed, otherwise the cached scene is reused
+    if (dirty & Dirty::Scene)
+        renderScene();
+
+    // Copy the cached scene to the framebuffer of the widget
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, sceneFBO->handle());
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, defaultFramebufferObject());
+    glBlitFramebuffer(0, 0, sceneSize.width(), sceneSize.height(), 0, 0, sceneSize.width(), sceneSize.height(), GL_COLOR_BUFFER_BIT, GL_NEAREST);
+    glBindFramebuffer(GL_FRAMEBUFFER, defaultFramebufferObject());
+    glCheckError();
+
+    // If we are in erasing mode and the mouse is hovering over this widget, we draw a transparent square or circle
+    // the size of the eraser brush width to show what will be erased.
+    if (drawMode == DrawMode::Erase && underMouse())
+    {
+        QRectF brushRect(-std::ceil(eraserBrushWidth / 2), -std::ceil(eraserBrushWidth / 2), eraserBrushWidth, eraserBrushWidth);
+
+        brushRect.translate(-0.5f, -0.5f); // Shift because fill rectangle is shifted by default
+        // Translate to where the mouse is in NIFTI coordinates
+        const QMatrix4x4 windowToNIFTIMatrix = getWindowToNIFTIMatrix();
+        brushRect.translate(QPoint(windowToNIFTIMatrix * lastMousePos));
+
+        QPainter painter(this);
+        painter.setTransform(windowToNIFTIMatrix.inverted().toTransform());
+
+        if (eraserBrushShape == BrushShape::Round)
+        {
+            painter.setPen(Qt::NoPen);
+            painter.setBrush(QBrush(QColor(128, 128, 255, 128)));
+            painter.drawEllipse(brushRect);
+        }
+        else
+        {
+            painter.fillRect(brushRect, QBrush(QColor(128, 128, 255, 128)));
+        }
+    }
+
+    // In live-wire mode, the path from the anchor to the cursor is drawn in the color of the current layer. Pixel centers are
+    // at integer NIFTI coordinates, the same as the eraser brush
+    if (drawMode == DrawMode::LiveWire && liveWireStarted)
+    {
+        QPolygonF polyline;
+        polyline.reserve((int)liveWirePath.size());
+        for (const QPoint &point : liveWirePath)
+            polyline.append(QPointF(point));
+
+        QPainter painter(this);
+        painter.setTransform(getWindowToNIFTIMatrix().inverted().toTransform());
+        painter.setRenderHint(QPainter::Antialiasing);
+
+        // A pen width of zero is one screen pixel wide regardless of the zoom
+        painter.setPen(QPen(tracingLayerColors[(int)tracingLayer], 0));
+        painter.drawPolyline(polyline);
+
+        painter.setBrush(QBrush(tracingLayerColors[(int)tracingLayer]));
+        painter.drawEllipse(QPointF(liveWireAnchor), 1.0, 1.0);
+    }
+}
+
+void AxialSliceWidget::renderScene()
+{
+    // Render into the scene FBO instead of the default framebuffer of the widget
+    sceneFBO->bind();
+
+    QOpenGLPaintDevice device(sceneFBO->size());
+    device.setDevicePixelRatio(devicePixelRatioF());
+    QPainter painter(&device);
 
     // With painter, call beginNativePainting before doing any custom OpenGL commands
     painter.beginNativePainting();
@@ -1172,52 +1130,43 @@ void AxialSliceWidget::paintGL()
     // Calculate the ModelViewProjection (MVP) matrix to transform the location of the axial slices
     QMatrix4x4 mvpMatrix = getMVPMatrix();
 
+    QOpenGLShaderProgram *sliceProgram = resources->getSliceProgram();
     sliceProgram->bind();
-    sliceProgram->setUniformValue("MVP", mvpMatrix);
     sliceProgram->setUniformValue("opacity", primOpacity);
     glCheckError();
 
-    // Bind the VAO, bind texture to GL_TEXTURE0, bind VBO, bind IBO
-    glBindVertexArray(sliceVertexObject);
-    glBindBuffer(GL_ARRAY_BUFFER, sliceVertexBuf);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, sliceIndexBuf);
-    glCheckError();
-
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, slicePrimTexture);
+    // Bind the VAO (the VBO and IBO are bound by the VAO), bind color map to GL_TEXTURE1
+    // The tiles of the slice are bound to GL_TEXTURE0 when drawing
+    glBindVertexArray(quadVertexObject);
     glActiveTexture(GL_TEXTURE1);
-    glBindTexture(GL_TEXTURE_1D, colorMapTexture[(int)primColorMap]);
+    glBindTexture(GL_TEXTURE_1D, resources->getColorMapTexture(primColorMap));
     glCheckError();
 
-    // Draw a triangle strip of 4 elements which is two triangles. The indices are unsigned shorts
-    glDrawElements(GL_TRIANGLE_STRIP, 4, GL_UNSIGNED_SHORT, 0);
-    glCheckError();
+    // Draw the tiles of the slice that are visible
+    slicePrimTexture->draw(sliceProgram, mvpMatrix);
 
-    if (displayType == SliceDisplayType::FatWater || displayType == SliceDisplayType::WaterFat)
+    // The secondary texture is drawn based on the last uploaded slice instead of the display type because the slice for a new
+    // display type may still be in progress
+    if (sliceSecdVisible)
     {
         sliceProgram->setUniformValue("opacity", secdOpacity);
         glCheckError();
 
-        glActiveTexture(GL_TEXTURE0);
-        glBindTexture(GL_TEXTURE_2D, sliceSecdTexture);
         glActiveTexture(GL_TEXTURE1);
-        glBindTexture(GL_TEXTURE_1D, colorMapTexture[(int)secdColorMap]);
+        glBindTexture(GL_TEXTURE_1D, resources->getColorMapTexture(secdColorMap));
         glCheckError();
 
-        // Draw a triangle strip of 4 elements which is two triangles. The indices are unsigned shorts
         // Drawing again for the secondary image
-        glDrawElements(GL_TRIANGLE_STRIP, 4, GL_UNSIGNED_SHORT, 0);
-        glCheckError();
+        sliceSecdTexture->draw(sliceProgram, mvpMatrix);
     }
 
     // Release (unbind) the binded objects in reverse order
     // This is a simple protocol to prevent anything happening to the objects outside of this function without
     // explicitly binding the objects
     glBindVertexArray(0);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    glActiveTexture(GL_TEXTURE1);
     glBindTexture(GL_TEXTURE_1D, 0);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    glActiveTexture(GL_TEXTURE0);
     sliceProgram->release();
     glCheckError();
 
@@ -1241,14 +1190,12 @@ void AxialSliceWidget::paintGL()
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     glDisable(GL_DEPTH_TEST);
 
+    QOpenGLShaderProgram *traceProgram = resources->getTraceProgram();
     traceProgram->bind();
-    traceProgram->setUniformValue("MVP", mvpMatrix);
     glCheckError();
 
-    // Bind the VAO, bind texture to GL_TEXTURE0, bind VBO, bind IBO
-    glBindVertexArray(traceVertexObject);
-    glBindBuffer(GL_ARRAY_BUFFER, traceVertexBuf);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, traceIndexBuf);
+    // Bind the VAO (the VBO and IBO are bound by the VAO), bind texture to GL_TEXTURE0
+    glBindVertexArray(quadVertexObject);
     glCheckError();
 
     for (int i = 0; i < (int)TracingLayer::Count; ++i)
@@ -1258,13 +1205,8 @@ void AxialSliceWidget::paintGL()
             // Tell the shader program what color to use for this layer
             traceProgram->setUniformValue("traceColor", tracingLayerColors[i]);
 
-            glActiveTexture(GL_TEXTURE0);
-            glBindTexture(GL_TEXTURE_2D, traceTextures[i]);
-            glCheckError();
-
-            // Draw a triangle strip of 4 elements which is two triangles. The indices are unsigned shorts
-            glDrawElements(GL_TRIANGLE_STRIP, 4, GL_UNSIGNED_SHORT, 0);
-            glCheckError();
+            // Draw the tiles of the layer that are visible
+            traceTextures[i]->draw(traceProgram, mvpMatrix);
         }
     }
 
@@ -1272,213 +1214,217 @@ void AxialSliceWidget::paintGL()
     // This is a simple protocol to prevent anything happening to the objects outside of this function without
     // explicitly binding the objects
     glBindVertexArray(0);
-    glBindTexture(GL_TEXTURE_2D, 0);
-    glBindTexture(GL_TEXTURE_1D, 0);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
     traceProgram->release();
 
     painter.endNativePainting();
 
-    // If we are in erasing mode and the mouse is hovering over this widget, we draw a transparent square
-    // the size of the eraser brush width to show what will be erased.
-    if (drawMode == DrawMode::Erase && underMouse())
-    {
-        QRectF brushRect(-std::ceil(eraserBrushWidth / 2), -std::ceil(eraserBrushWidth / 2), eraserBrushWidth, eraserBrushWidth);
-
-        brushRect.translate(-0.5f, -0.5f); // Shift because fill rectangle is shifted by default
-        brushRect.translate(lastMousePosNIFTI); // Translate to where the mouse is in NIFTI coordinates
+    painter.end();
+    sceneFBO->release();
+    glCheckError();
 
-        painter.setTransform(getWindowToNIFTIMatrix().inverted().toTransform());
-        painter.fillRect(brushRect, QBrush(QColor(128, 128, 255, 128)));
-    }
+    dirty &= ~Dirty::Scene;
 }
 
-void AxialSliceWidget::addPoint(QPoint newPoint, bool first)
+void AxialSliceWidget::addPoint(QPoint NIFTICoord, QPoint lastNIFTICoord, bool first)
 {
-    const auto windowToNIFTIMatrix = getWindowToNIFTIMatrix();
-    const QPoint lastPoint = lastMousePos;
-
-    QPoint NIFTICoord = (windowToNIFTIMatrix * newPoint);
-    QPoint lastNIFTICoord = (windowToNIFTIMatrix * lastPoint);
-
-    // Handle adding the first point to the mouse command
-    // This requires a different path because linear interpolation and other methods are not required
-    if (first)
-    {
-        mouseCommand->addPoint(NIFTICoord);
-        return;
-    }
-
     const QRect bounds(0, 0, fatImage->getXDim(), fatImage->getYDim());
-    // If the current and previous NIFTI coordinates are NOT in the bounds of the NIFTI image, then dont add any points
-    if (lastNIFTICoord == NIFTICoord || (!bounds.contains(NIFTICoord) && !bounds.contains(lastNIFTICoord)))
+
+    // Nothing is drawn if the mouse did not move (except for the first point which draws the brush once) or if the current and
+    // previous NIFTI coordinates are NOT in the bounds of the NIFTI image
+    if ((!first && lastNIFTICoord == NIFTICoord) || (!bounds.contains(NIFTICoord) && !bounds.contains(lastNIFTICoord)))
         return;
 
     // Clamp the current and previous NIFTI coordinates to the NIFTI image boundary
     NIFTICoord = util::clamp(NIFTICoord, bounds);
     lastNIFTICoord = util::clamp(lastNIFTICoord, bounds);
 
-    std::vector<QPoint> points({ lastNIFTICoord });
-
-    // Linear Interpolation between NIFTICoord and lastNIFTICoord to get in between values
-    // ----------------------------------------------------------------------------------------------------------------------------------------
-    // The length approximates how many units are between the two points
-    // Therefore, 1/length should be the approximate step value in percent to get all of the points between currentPoint and lastPoint
-    const float steps = 1 / QVector2D(NIFTICoord - lastNIFTICoord).length();
-    float percent = 0.0f;
+    // Rasterize the line with the brush, this sets the pixels and returns the runs that changed
+    std::vector<TracingSpan> spans;
+    (*tracingData)[tracingLayer].drawLine(location.z(), lastNIFTICoord, NIFTICoord, drawBrushWidth, drawBrushShape, spans);
+    spansChanged(location.z(), spans);
 
-    while (percent < 1.0f)
-    {
-        QPoint interPoint = util::lerp(QPointF(lastNIFTICoord), QPointF(NIFTICoord), percent).toPoint();
-
-        // Skip if the previous point equals this point
-        // This will occur when rounding errors happen and return the same point
-        if (interPoint != points.back())
-        {
-            // Skip if the point is already set to be a fat point. No need to set it twice
-            auto &interVal = (*tracingData)[tracingLayer].at(interPoint.x(), interPoint.y(), location.z());
-            if (interVal != 255)
-            {
-                points.push_back(interPoint);
-                interVal = 255;
-            }
-        }
+    // Add spans to the mouse command so that it can be undone/redone
+    mouseCommand->addSpans(spans);
+}
 
-        percent += steps;
-    }
+void AxialSliceWidget::erasePoint(QPoint NIFTICoord, QPoint lastNIFTICoord, bool first)
+{
+    const QRect bounds(0, 0, fatImage->getXDim(), fatImage->getYDim());
 
-    // Remove the first element which was lastPoint. This was used with linear interpolation algorithm to easily check if the interpolated point
-    // equals the last point. For the first element, the points vector is empty and so additional checks are required. Instead, the lastPoint is
-    // added so that the first element can be checked
-    points.erase(std::begin(points));
+    // Nothing is erased if the mouse did not move (except for the first point which erases the brush once) or if the current and
+    // previous NIFTI coordinates are NOT in the bounds of the NIFTI image
+    if ((!first && lastNIFTICoord == NIFTICoord) || (!bounds.contains(NIFTICoord) && !bounds.contains(lastNIFTICoord)))
+        return;
 
-    // Only set the actual given mouse coordinate if it is not already set
-    auto &pointVal = (*tracingData)[tracingLayer].at(NIFTICoord.x(), NIFTICoord.y(), location.z());
-    if (pointVal != 255)
-    {
-        points.push_back(NIFTICoord);
-        pointVal = 255;
-    }
+    // Clamp the current and previous NIFTI coordinates to the NIFTI image boundary
+    NIFTICoord = util::clamp(NIFTICoord, bounds.topLeft(), bounds.bottomRight());
+    lastNIFTICoord = util::clamp(lastNIFTICoord, bounds.topLeft(), bounds.bottomRight());
 
-    // Add points to the mouse command so that it can be undone/redone
-    mouseCommand->addPoint(points);
+    // Clear the shape swept by the brush from the last point to the current point, this returns the runs that were cleared
+    std::vector<TracingSpan> spans;
+    (*tracingData)[tracingLayer].eraseLine(location.z(), lastNIFTICoord, NIFTICoord, eraserBrushWidth, eraserBrushShape, spans);
+    spansChanged(location.z(), spans);
 
-    dirty |= Dirty::Trace(tracingLayer);
-    update();
+    // Add spans to the mouse command so that it can be undone/redone
+    mouseCommand->addSpans(spans);
 }
 
-void AxialSliceWidget::erasePoint(QPoint newPoint, bool first)
+void AxialSliceWidget::addLiveWireAnchor(QPoint NIFTICoord)
 {
-    const auto windowToNIFTIMatrix = getWindowToNIFTIMatrix();
-    const QPoint lastPoint = lastMousePos;
+    const QRect bounds(0, 0, fatImage->getXDim(), fatImage->getYDim());
+    if (!bounds.contains(NIFTICoord))
+        return;
 
-    QPoint NIFTICoord = (windowToNIFTIMatrix * newPoint);
-    QPoint lastNIFTICoord = (windowToNIFTIMatrix * lastPoint);
+    // The paths from the last anchor are not found yet, the click is added once they are
+    if (liveWireSearching)
+    {
+        liveWireClicks.push_back(NIFTICoord);
+        return;
+    }
 
-    const QRect bounds(0, 0, fatImage->getXDim(), fatImage->getYDim());
+    const int z = location.z();
 
-    // Handle adding the first point to the mouse command
-    // This requires a different path because linear interpolation and other methods are not required
-    if (first)
+    if (!liveWireStarted)
+    {
+        liveWireStarted = true;
+        liveWirePath.assign(1, NIFTICoord);
+        drawTimer.start();
+    }
+    else
     {
-        std::vector<QPoint> points;
+        // Draw the path from the last anchor to this point with the drawing brush. The points of the path are neighbors,
+        // so each line is one step. The path stays shown until the paths from the new anchor are found
+        const std::vector<QPoint> path = liveWire.pathTo(NIFTICoord);
+        liveWirePath = path;
 
-        const QRect brushRect(-std::ceil(eraserBrushWidth / 2), -std::ceil(eraserBrushWidth / 2), eraserBrushWidth, eraserBrushWidth);
-        int x1, x2, y1, y2;
+        std::vector<TracingSpan> spans;
+        for (size_t i = 1; i < path.size(); ++i)
+            (*tracingData)[tracingLayer].drawLine(z, path[i - 1], path[i], drawBrushWidth, drawBrushShape, spans);
 
-        auto translated = util::clamp(brushRect.translated(NIFTICoord), bounds);
-        translated.getCoords(&x1, &y1, &x2, &y2);
+        (*tracingData)[tracingLayer].time[z] += std::chrono::milliseconds(drawTimer.restart());
 
-        for (int x = x1; x <= x2; ++x)
+        // A segment that only crosses voxels that are already traced changes nothing, so there is nothing to undo
+        if (!spans.empty())
         {
-            for (int y = y1; y <= y2; ++y)
-            {
-                // Skip if the point is already set to be a fat point. No need to set it twice
-                auto &pointVal = (*tracingData)[tracingLayer].at(x, y, location.z());
-                if (pointVal != 0)
-                {
-                    points.push_back(QPoint(x, y));
-                    pointVal = 0;
-                }
-            }
+            spansChanged(z, spans);
+
+            // The entire segment is one command, so undo removes the last segment of the wire
+            TracingCommand *command = new TracingPointsAddCommand(this);
+            command->addSpans(spans);
+            command->finish();
+            undoStack->push(command);
+
+            dirty |= Dirty::Trace(tracingLayer);
         }
+    }
+
+    liveWireAnchor = NIFTICoord;
+    liveWire.clearAnchor();
+    liveWireSearching = true;
+    liveWireWatcher.setFuture(liveWireCostCache.search(z, NIFTICoord));
+    update();
+}
 
-        mouseCommand->addPoint(points);
+void AxialSliceWidget::liveWireWatcher_finished()
+{
+    liveWireSearching = false;
+
+    // The wire was reset while the paths were searched
+    if (!liveWireStarted || liveWireWatcher.isCanceled())
         return;
-    }
 
-    // If the current and previous NIFTI coordinates are NOT in the bounds of the NIFTI image, then dont add any points
-    if (lastNIFTICoord == NIFTICoord || (!bounds.contains(NIFTICoord) && !bounds.contains(lastNIFTICoord)))
+    liveWire = liveWireWatcher.result();
+
+    // Clicks that were made during the search are added in order, each one waits for the search of the one before it
+    if (!liveWireClicks.empty())
+    {
+        const QPoint click = liveWireClicks.front();
+        liveWireClicks.erase(std::begin(liveWireClicks));
+        addLiveWireAnchor(click);
         return;
+    }
 
-    // Clamp the current and previous NIFTI coordinates to the NIFTI image boundary
-    NIFTICoord = util::clamp(NIFTICoord, bounds.topLeft(), bounds.bottomRight());
-    lastNIFTICoord = util::clamp(lastNIFTICoord, bounds.topLeft(), bounds.bottomRight());
+    if (liveWire.isAnchored() && underMouse())
+        liveWirePath = liveWire.pathTo(getWindowToNIFTIMatrix() * mapFromGlobal(QCursor::pos()));
 
-    // This represents a linear interpolation between the last mouse and current mouse point in NIFTI coordinates. It will be the center point
-    // for the circle radius that is erased around it
-    std::vector<QPoint> eraseCenterPoints({ lastNIFTICoord });
-    // This is the actual list of points that was removed
-    std::vector<QPoint> points;
+    update();
+}
 
-    // Linear Interpolation between NIFTICoord and lastNIFTICoord to get in between values
-    // ----------------------------------------------------------------------------------------------------------------------------------------
-    // The length approximates how many units are between the two points
-    // Therefore, 1/length should be the approximate step value in percent to get all of the points between currentPoint and lastPoint
-    const float steps = 1 / QVector2D(NIFTICoord - lastNIFTICoord).length();
-    float percent = 0.0f;
+void AxialSliceWidget::resetLiveWire()
+{
+    if (!liveWireStarted)
+        return;
 
-    while (percent < 1.0f)
-    {
-        QPoint interPoint = util::lerp(QPointF(lastNIFTICoord), QPointF(NIFTICoord), percent).toPoint();
+    // A search that is still running is dropped when it finishes, or when the next search replaces it in the watcher
+    liveWireStarted = false;
+    liveWireSearching = false;
+    liveWireClicks.clear();
+    liveWire.clearAnchor();
+    liveWirePath.clear();
+    update();
+}
 
-        // Skip if the previous point equals this point
-        // This will occur when rounding errors happen and return the same point
-        if (interPoint != eraseCenterPoints.back())
-            eraseCenterPoints.push_back(interPoint);
+void AxialSliceWidget::spansChanged(int z, const std::vector<TracingSpan> &spans)
+{
+    spansChanged(z, spans.data(), spans.data() + spans.size());
+}
 
-        percent += steps;
-    }
+void AxialSliceWidget::spansChanged(int z, const TracingSpan *first, const TracingSpan *last)
+{
+    if (first == last)
+        return;
 
-    // Remove the first element which was lastPoint. This was used with linear interpolation algorithm to easily check if the interpolated point
-    // equals the last point. For the first element, the points vector is empty and so additional checks are required. Instead, the lastPoint is
-    // added so that the first element can be checked
-    eraseCenterPoints.erase(std::begin(eraseCenterPoints));
+    int yStart = std::numeric_limits<int>::max();
+    int yEnd = 0;
 
-    // Add the current NIFTI coord to erase center points
-    eraseCenterPoints.push_back(NIFTICoord);
+    for (const TracingSpan *span = first; span != last; ++span)
+    {
+        yStart = std::min(yStart, (int)span->y);
+        yEnd = std::max(yEnd, (int)span->y + 1);
+    }
 
-    // Compute Points to be erased based on eraseCenterPoints
-    // -------------------------------------------------------------------------------------------------------------------------------------
-    const QRect brushRect(-std::ceil(eraserBrushWidth / 2), -std::ceil(eraserBrushWidth / 2), eraserBrushWidth, eraserBrushWidth);
-    int x1, x2, y1, y2;
+    emit traceRowsChanged(z, yStart, yEnd);
+}
 
-    for (QPoint eraseCenter : eraseCenterPoints)
+void AxialSliceWidget::processInputQueue()
+{
+    // Rasterize all of the stroke segments that were queued since the last frame in one batch
+    if (!strokeQueue.empty())
     {
-        auto translated = util::clamp(brushRect.translated(eraseCenter), bounds);
-        translated.getCoords(&x1, &y1, &x2, &y2);
+        // The view cannot be changed while drawing so the same matrix is valid for every point in the queue
+        const auto windowToNIFTIMatrix = getWindowToNIFTIMatrix();
+        QPoint lastNIFTICoord = (windowToNIFTIMatrix * strokeLastPos);
 
-        for (int x = x1; x <= x2; ++x)
+        for (QPoint pos : strokeQueue)
         {
-            for (int y = y1; y <= y2; ++y)
+            QPoint NIFTICoord = (windowToNIFTIMatrix * pos);
+
+            switch (drawMode)
             {
-                // Skip if the point is already set to be a fat point. No need to set it twice
-                auto &pointVal = (*tracingData)[tracingLayer].at(x, y, location.z());
-                if (pointVal != 0)
-                {
-                    points.push_back(QPoint(x, y));
-                    pointVal = 0;
-                }
+                case DrawMode::Points: addPoint(NIFTICoord, lastNIFTICoord, false); break;
+                case DrawMode::Erase: erasePoint(NIFTICoord, lastNIFTICoord, false); break;
+                case DrawMode::LiveWire: break;
             }
+
+            lastNIFTICoord = NIFTICoord;
         }
+
+        strokeLastPos = strokeQueue.back();
+        strokeQueue.clear();
+
+        dirty |= Dirty::Trace(tracingLayer);
     }
 
-    // Add points to the mouse command so that it can be undone/redone
-    mouseCommand->addPoint(points);
+    // The panning since the last frame is summed together and applied directly to the view. The move command for the entire
+    // pan is pushed in finishPanGesture
+    if (!panDelta.isNull())
+    {
+        translation += QVector3D(panDelta);
+        panGestureDelta += panDelta;
+        panDelta = QPointF();
 
-    dirty |= Dirty::Trace(tracingLayer);
-    update();
+        dirty |= Dirty::Scene;
+    }
 }
 
 void AxialSliceWidget::mouseMoveEvent(QMouseEvent *eventMove)
@@ -1488,11 +1434,9 @@ void AxialSliceWidget::mouseMoveEvent(QMouseEvent *eventMove)
 
     if (startDraw)
     {
-        switch (drawMode)
-        {
-            case DrawMode::Points: addPoint(eventMove->pos(), false); break;
-            case DrawMode::Erase: erasePoint(eventMove->pos(), false); break;
-        }
+        // Queue the mouse position, the stroke is rasterized once per frame in processInputQueue
+        strokeQueue.push_back(eventMove->pos());
+        update();
     }
     else if (startPan)
     {
@@ -1512,17 +1456,24 @@ void AxialSliceWidget::mouseMoveEvent(QMouseEvent *eventMove)
         // Get the delta
         QPointF delta = (curMousePos - lastMousePos_);
 
-        // Push a new move command on the undoStack. This will call the command but also keep track
-        // of it if an undo or redo action is called. redo function is called immediately.
-        undoStack->push(new AxialMoveCommand(delta, this, moveID));
+        // Add to the pan delta which is applied to the view on the next frame
+        panDelta += delta;
+        update();
     }
 
     lastMousePos = eventMove->pos();
-    lastMousePosNIFTI = (getWindowToNIFTIMatrix() * lastMousePos);
 
     // The erase mode shows a rectangle of what will be erased so this needs to be updated if the mouse moves
     if (drawMode == DrawMode::Erase)
         update();
+
+    // The shortest paths from the anchor were found when its search finished, so this only follows the path back from the
+    // cursor. The last path stays shown while the search is running
+    if (drawMode == DrawMode::LiveWire && liveWire.isAnchored())
+    {
+        liveWirePath = liveWire.pathTo(getWindowToNIFTIMatrix() * eventMove->pos());
+        update();
+    }
 }
 
 void AxialSliceWidget::mousePressEvent(QMouseEvent *eventPress)
@@ -1537,18 +1488,34 @@ void AxialSliceWidget::mousePressEvent(QMouseEvent *eventPress)
     // Since multiple buttons down does not have functionality, the button() function
     // is used and if an additional button is down with functionality, the old button
     // is turned off and the new takes place.
+    // A zoom gesture that is still waiting on its timer is finished so that it is recorded before anything else
+    finishZoomGesture();
+
     if (eventPress->button() == Qt::LeftButton)
     {
         // See below for explanation of why this occurs
-        if (startPan)
-            startPan = false;
+        finishPanGesture();
+
+        const QPoint NIFTICoord = (getWindowToNIFTIMatrix() * eventPress->pos());
+
+        // The live-wire adds a segment on each click instead of drawing while the button is held
+        if (drawMode == DrawMode::LiveWire)
+        {
+            addLiveWireAnchor(NIFTICoord);
+            lastMousePos = eventPress->pos();
+            return;
+        }
 
         switch (drawMode)
         {
-            case DrawMode::Points: mouseCommand = new TracingPointsAddCommand(this); addPoint(eventPress->pos(), true); break;
-            case DrawMode::Erase: mouseCommand = new TracingPointsEraseCommand(this); erasePoint(eventPress->pos(), true); break;
+            case DrawMode::Points: mouseCommand = new TracingPointsAddCommand(this); addPoint(NIFTICoord, NIFTICoord, true); break;
+            case DrawMode::Erase: mouseCommand = new TracingPointsEraseCommand(this); erasePoint(NIFTICoord, NIFTICoord, true); break;
+            case DrawMode::LiveWire: break;
         }
 
+        strokeLastPos = eventPress->pos();
+        strokeQueue.clear();
+
         undoStack->push(mouseCommand);
         drawTimer.start();
         startDraw = true;
@@ -1561,14 +1528,23 @@ void AxialSliceWidget::mousePressEvent(QMouseEvent *eventPress)
         // both on so the latest one overwrites
         if (startDraw)
         {
-            // TODO: Any other stuff here
+            // Finish the queued part of the stroke before it is stopped
+            processInputQueue();
+            mouseCommand->finish();
+            mouseCommand = NULL;
             startDraw = false;
         }
 
         // Flag to indicate that panning is occuring
         // The starting position is stored so to know how much movement has occurred
         startPan = true;
-        moveID = (((int)moveID + 1) > (int)CommandID::AxialMoveEnd) ? CommandID::AxialMove : (CommandID)((int)moveID + 1);
+        panGestureDelta = QPointF();
+    }
+    else if (eventPress->button() == Qt::RightButton && drawMode == DrawMode::LiveWire && liveWireStarted)
+    {
+        // Right clicking ends the wire, the segments that were added stay
+        (*tracingData)[tracingLayer].time[location.z()] += std::chrono::milliseconds(drawTimer.elapsed());
+        resetLiveWire();
     }
     else if (eventPress->button() == Qt::RightButton)
     {
@@ -1577,7 +1553,6 @@ void AxialSliceWidget::mousePressEvent(QMouseEvent *eventPress)
     }
 
     lastMousePos = eventPress->pos();
-    lastMousePosNIFTI = (getWindowToNIFTIMatrix() * lastMousePos);
 }
 
 void AxialSliceWidget::mouseReleaseEvent(QMouseEvent *eventRelease)
@@ -1587,11 +1562,11 @@ void AxialSliceWidget::mouseReleaseEvent(QMouseEvent *eventRelease)
 
     if (eventRelease->button() == Qt::LeftButton && startDraw)
     {
-        switch (drawMode)
-        {
-            case DrawMode::Points: addPoint(eventRelease->pos(), false); break;
-            case DrawMode::Erase: erasePoint(eventRelease->pos(), false); break;
-        }
+        // Finish the stroke now rather than on the next frame because the mouse command is done after this
+        strokeQueue.push_back(eventRelease->pos());
+        processInputQueue();
+        mouseCommand->finish();
+        update();
 
         (*tracingData)[tracingLayer].time[location.z()] += std::chrono::milliseconds(drawTimer.elapsed());
         mouseCommand = NULL;
@@ -1599,7 +1574,8 @@ void AxialSliceWidget::mouseReleaseEvent(QMouseEvent *eventRelease)
     }
     else if (eventRelease->button() == Qt::MiddleButton && startPan)
     {
-        startPan = false;
+        finishPanGesture();
+        update();
     }
 }
 
@@ -1617,14 +1593,20 @@ void AxialSliceWidget::wheelEvent(QWheelEvent *event)
         // Zoom in 5% every 15 degrees which is one step on most mouses
         float scaleDelta = numDegrees.y() * (0.05f / 15);
 
-        // Clamp the scaleDelta so that the resulting scaling factor is between 0.05f to 3.0f
-        scaleDelta = std::max(std::min((scaling + scaleDelta), 3.0f), 0.05f) - scaling;
+        // Store the scaling at the start of the gesture so the entire zoom can be undone at once
+        if (!startZoom)
+        {
+            zoomGestureStartScaling = scaling;
+            startZoom = true;
+        }
+
+        // Clamp the resulting scaling factor between 0.05f to 3.0f and apply it directly to the view
+        scaling = std::max(std::min((scaling + scaleDelta), 3.0f), 0.05f);
+        dirty |= Dirty::Scene;
+        update();
 
-        // Push a new scale command on the undo stack which will immediately call redo for an action.
-        // This keeps track of it if an undo or redo command is called
-        // Only push to the stack if there is a delta
-        if (scaleDelta != 0.0f)
-            undoStack->push(new AxialScaleCommand(scaleDelta, this));
+        // Restart the timer, the scale command is pushed once the wheel has not moved for the timer interval
+        zoomGestureTimer->start();
     }
 }
 
@@ -1636,21 +1618,35 @@ void AxialSliceWidget::leaveEvent(QEvent *event)
     // Since the eraser has a rectangle that follows the cursor, tell the widget to redraw and exclude the rectangle when the mouse is off the widget
     if (drawMode == DrawMode::Erase)
         update();
+
+    // The wire stays anchored, only the path to the cursor is hidden until the mouse comes back
+    if (drawMode == DrawMode::LiveWire && liveWireStarted)
+    {
+        liveWirePath.assign(1, liveWireAnchor);
+        update();
+    }
 }
 
 AxialSliceWidget::~AxialSliceWidget()
 {
-    // Destroy the VAO, VBO, and IBO
-    glDeleteVertexArrays(1, &sliceVertexObject);
-    glDeleteBuffers(1, &sliceVertexBuf);
-    glDeleteBuffers(1, &sliceIndexBuf);
-    glDeleteTextures(1, &slicePrimTexture);
-    glDeleteTextures(1, &sliceSecdTexture);
-    glDeleteVertexArrays(1, &traceVertexObject);
-    glDeleteBuffers(1, &traceVertexBuf);
-    glDeleteBuffers(1, &traceIndexBuf);
-    glDeleteTextures((int)TracingLayer::Count, &traceTextures[0]);
-    glDeleteTextures((int)ColorMap::Count, &colorMapTexture[0]);
-    delete sliceProgram;
-    delete traceProgram;
+    // OpenGL objects are only created once the widget is shown. A widget that was never shown, such as the placeholder from the
+    // UI file that is replaced when switching views, has nothing to destroy
+    if (!resources)
+        return;
+
+    // The context must be current to destroy the OpenGL objects
+    makeCurrent();
+
+    // Destroy the VAO and textures
+    glDeleteVertexArrays(1, &quadVertexObject);
+    delete slicePrimTexture;
+    delete sliceSecdTexture;
+    for (auto texture : traceTextures)
+        delete texture;
+    delete sceneFBO;
+
+    // Release the shared resources, these are destroyed if this is the last widget using them
+    resources.reset();
+
+    doneCurrent();
 }
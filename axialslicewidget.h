@@ -9,6 +9,8 @@
 #include <QDebug>
 #include <QMouseEvent>
 #include <QOpenGLTexture>
+#include <QOpenGLFramebufferObject>
+#include <QOpenGLPaintDevice>
 #include <QVector>
 #include <QVector4D>
 #include <QMatrix4x4>
@@ -20,6 +22,9 @@
 #include <QLabel>
 #include <QTime>
 #include <QElapsedTimer>
+#include <QTimer>
+#include <QCursor>
+#include <QFutureWatcher>
 
 #include <nifti1.h>
 #include <nifti1_io.h>
@@ -31,6 +36,11 @@
 #include "commands.h"
 #include "tracing.h"
 #include "displayinfo.h"
+#include "slicescheduler.h"
+#include "glresources.h"
+#include "tiledtexture.h"
+#include "slicebufferpool.h"
+#include "livewire.h"
 #include "quazip.h"
 #include "quazipfile.h"
 #include "quazipfileinfo.h"
@@ -67,25 +77,30 @@ private:
     // Each bit represents whether the specified item in Dirty enum needs to be updated on drawing
     int dirty;
 
-    QOpenGLShaderProgram *sliceProgram;
-    GLuint sliceVertexBuf, sliceIndexBuf;
-    GLuint sliceVertexObject;
-    GLuint slicePrimTexture;
-    GLuint sliceSecdTexture;
-    QVector<VertexPT> sliceVertices;
-    QVector<unsigned short> sliceIndices;
-    bool sliceTexturePrimInit;
-    bool sliceTextureSecdInit;
-
-    QOpenGLShaderProgram *traceProgram;
-    GLuint traceVertexBuf, traceIndexBuf;
-    GLuint traceVertexObject;
-    GLuint traceTextures[(int)TracingLayer::Count];
-    QVector<VertexPT> traceVertices;
-    QVector<unsigned short> traceIndices;
-    std::array<bool, (int)TracingLayer::Count> traceTextureInit;
-
-    GLuint colorMapTexture[(int)ColorMap::Count];
+    // Shader programs, quad buffers and color maps shared with the other slice widgets
+    std::shared_ptr<GLResources> resources;
+
+    // VAO for the shared quad, this is used for drawing both the slices and the traces
+    GLuint quadVertexObject;
+
+    // Slices are split into tiles so that volumes larger than the maximum texture size can be displayed
+    TiledTexture *slicePrimTexture;
+    TiledTexture *sliceSecdTexture;
+    // Number of levels of detail the slices are drawn below the level that matches the screen, see TiledTexture
+    int levelBias;
+    // Whether the last uploaded slice has a secondary image
+    bool sliceSecdVisible;
+
+    std::array<TiledTexture *, (size_t)TracingLayer::Count> traceTextures;
+
+    // Composite of the slices, crosshair and traces. This is only rendered again when Dirty::Scene is set, otherwise it is
+    // blitted to the screen and the overlay (eraser brush) is drawn on top of it
+    QOpenGLFramebufferObject *sceneFBO;
+
+    // Prepares the slice textures on a worker thread, only the latest requested slice is kept when scrubbing through slices
+    SliceScheduler *sliceScheduler;
+    // Matrices that the slices are prepared into, these are reused so scrubbing through slices does not allocate
+    SliceBufferPool bufferPool;
 
     // Location of where the user is viewing.
     // The format is (X, Y, Z, T) where T is time
@@ -102,18 +117,52 @@ private:
     float brightness;
     float brightnessThreshold;
     float contrast;
+    WindowMode windowMode;
 
     // Sets whether drawing or erasing...useful if new draw modes are added like drawing lines
     DrawMode drawMode;
     bool startDraw;
     QElapsedTimer drawTimer;
 
+    int drawBrushWidth;
+    BrushShape drawBrushShape;
+
     int eraserBrushWidth;
+    BrushShape eraserBrushShape;
+
+    // In the live-wire mode, each click adds the path along the edges from the last anchor to the click and makes the click
+    // the new anchor. The path to the cursor is shown while the mouse moves. The cost maps of the slices are computed when
+    // the slices are shown and the paths from each anchor are searched on a worker thread, see LiveWireCostCache. The live
+    // wire is only anchored once its search is finished, the last path is shown until then and clicks are queued
+    LiveWireCostCache liveWireCostCache;
+    LiveWire liveWire;
+    QFutureWatcher<LiveWire> liveWireWatcher;
+    bool liveWireStarted;
+    bool liveWireSearching;
+    QPoint liveWireAnchor;
+    std::vector<QPoint> liveWireClicks;
+    std::vector<QPoint> liveWirePath;
 
     bool startPan;
     QPoint lastMousePos;
-    QPoint lastMousePosNIFTI;
-    CommandID moveID;
+
+    // Mouse input is queued and processed once per frame in processInputQueue. The stroke queue holds the window positions of
+    // the mouse since the last frame and strokeLastPos is the last position that was rasterized. The pan delta is the summed
+    // movement since the last frame
+    std::vector<QPoint> strokeQueue;
+    QPoint strokeLastPos;
+    QPointF panDelta;
+
+    // Pan and zoom change the view directly and one command is pushed for the entire gesture once it is finished. The pan
+    // gesture delta is the total movement since the middle button was pressed. A zoom gesture is finished once no wheel
+    // events have been received for the interval of the zoom gesture timer
+    QPointF panGestureDelta;
+    bool startZoom;
+    float zoomGestureStartScaling;
+    QTimer *zoomGestureTimer;
+
+    // If false, pan, zoom and reset view are not recorded in the undo history
+    bool recordViewHistory;
 
     QMatrix4x4 projectionMatrix;
     QMatrix4x4 viewMatrix;
@@ -128,7 +177,12 @@ private:
     int frameCount;
     float fps;
 
+    // Set until the first frame is drawn, firstFrameRendered is emitted then
+    bool firstFrame;
+
     QUndoStack *undoStack;
+    // Tracing commands of the undo stack, owned by the view of the undo stack
+    TracingHistory *tracingHistory;
 
 public:
     AxialSliceWidget(QWidget *parent);
@@ -175,12 +229,30 @@ public:
     float getContrast() const;
     void setContrast(float contrast);
 
+    WindowMode getWindowMode() const;
+    void setWindowMode(WindowMode mode);
+
+    int getLevelBias() const;
+    void setLevelBias(int bias);
+
     DrawMode getDrawMode() const;
     void setDrawMode(DrawMode mode);
 
+    int getDrawBrushWidth() const;
+    void setDrawBrushWidth(int width);
+
+    BrushShape getDrawBrushShape() const;
+    void setDrawBrushShape(BrushShape shape);
+
     int getEraserBrushWidth() const;
     void setEraserBrushWidth(int width);
 
+    BrushShape getEraserBrushShape() const;
+    void setEraserBrushShape(BrushShape shape);
+
+    LiveWireImage getLiveWireImage() const;
+    void setLiveWireImage(LiveWireImage image);
+
     TracingLayer getTracingLayer() const;
     void setTracingLayer(TracingLayer layer);
 
@@ -191,14 +263,28 @@ public:
 
     void resetView();
 
+    bool getRecordViewHistory() const;
+    void setRecordViewHistory(bool record);
+
+    void finishPanGesture();
+
     float &rscaling();
     QVector3D &rtranslation();
 
     bool saveTracingData(QuaZip *zip);
     bool loadTracingData(QuaZip *zip);
+    bool confirmReplaceTracingData();
+    void tracingDataReplaced();
+
+    // Points are given in NIFTI coordinates
+    void addPoint(QPoint NIFTICoord, QPoint lastNIFTICoord, bool first);
+    void erasePoint(QPoint NIFTICoord, QPoint lastNIFTICoord, bool first);
+    void addLiveWireAnchor(QPoint NIFTICoord);
+
+    // Removes the anchor of the live-wire, the next click starts a new wire
+    void resetLiveWire();
 
-    void addPoint(QPoint newPoint, bool first);
-    void erasePoint(QPoint newPoint, bool first);
+    void processInputQueue();
 
     QMatrix4x4 getMVPMatrix() const;
 
@@ -206,21 +292,56 @@ public:
     QMatrix4x4 getWindowToOpenGLMatrix(bool includeMVP = true, bool flipY = true) const;
     QMatrix4x4 getNIFTIToOpenGLMatrix(bool includeMVP = true, bool flipY = true) const;
 
+    // Frames drawn per second over the last second and the counters of the slice buffers, the steady state is to only reuse
+    // the sets that were reserved
+    float getFPS() const;
+    const SliceBufferPool &getBufferPool() const;
+
     void setUndoStack(QUndoStack *stack);
+    TracingHistory *getTracingHistory() const;
+    void setTracingHistory(TracingHistory *history);
 
     void setDirty(int bit);
 
-    void updateTexture();
+    static SliceResult prepareSlice(cv::Mat fatVolume, cv::Mat waterVolume, IntensityWindow fatWindow, IntensityWindow waterWindow,
+                                    int z, SliceDisplayType type, float brightness, float brightnessThreshold, float contrast,
+                                    SliceBuffers buffers);
+    void requestSlice();
+    void updateTexture(const SliceResult &result);
     void updateTrace(TracingLayer layer);
 
+    // Emits traceRowsChanged with the rows of axial slice z that the spans cover
+    void spansChanged(int z, const std::vector<TracingSpan> &spans);
+    void spansChanged(int z, const TracingSpan *first, const TracingSpan *last);
+
+public slots:
+    void finishZoomGesture();
+
+private slots:
+    void liveWireWatcher_finished();
+
+signals:
+    void firstFrameRendered();
+
+    // Rows yStart to yEnd (exclusive) of axial slice z were edited on one or more tracing layers
+    void traceRowsChanged(int z, int yStart, int yEnd);
+    // Every tracing layer was replaced, such as when the tracing data is loaded
+    void tracesReset();
+    // The frame rate was measured again, this is emitted about once a second while frames are drawn
+    void frameStatsUpdated();
+    // A tracing layer was shown or hidden
+    void tracingLayerVisibleChanged(int layer, bool visible);
+    // The axial slice of the location changed. This is emitted for every change of location, including undo and redo
+    void axialSliceChanged(int z);
+
 protected:
     void initializeGL();
     void resizeGL(int w, int h);
     void paintGL();
+    void renderScene();
 
     void initializeSliceView();
     void initializeTracing();
-    void initializeColorMaps();
 
     void mouseMoveEvent(QMouseEvent *eventMove);
     void mousePressEvent(QMouseEvent *eventPress);
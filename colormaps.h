@@ -0,0 +1,645 @@
+// Generated by colormaps/generate_colormaps.py from the PNG files in colormaps/, do not edit by hand
+#ifndef COLORMAPS_H
+#define COLORMAPS_H
+
+#include "displayinfo.h"
+
+// Number of entries in each color map
+constexpr int colorMapSize = 256;
+
+// RGBA values for each color map, indexed by ColorMap
+constexpr unsigned char colorMapData[(int)ColorMap::Count][colorMapSize * 4] =
+{
+    // Autumn
+    {
+        255, 0, 0, 255, 255, 1, 0, 255, 255, 2, 0, 255, 255, 3, 0, 255, 255, 4, 0, 255, 255, 5, 0, 255, 255, 6, 0, 255, 255, 7, 0, 255,
+        255, 8, 0, 255, 255, 9, 0, 255, 255, 10, 0, 255, 255, 11, 0, 255, 255, 12, 0, 255, 255, 13, 0, 255, 255, 14, 0, 255, 255, 15, 0, 255,
+        255, 16, 0, 255, 255, 17, 0, 255, 255, 18, 0, 255, 255, 19, 0, 255, 255, 20, 0, 255, 255, 21, 0, 255, 255, 22, 0, 255, 255, 23, 0, 255,
+        255, 24, 0, 255, 255, 25, 0, 255, 255, 26, 0, 255, 255, 27, 0, 255, 255, 28, 0, 255, 255, 29, 0, 255, 255, 30, 0, 255, 255, 31, 0, 255,
+        255, 32, 0, 255, 255, 33, 0, 255, 255, 34, 0, 255, 255, 35, 0, 255, 255, 36, 0, 255, 255, 37, 0, 255, 255, 38, 0, 255, 255, 39, 0, 255,
+        255, 40, 0, 255, 255, 41, 0, 255, 255, 42, 0, 255, 255, 43, 0, 255, 255, 44, 0, 255, 255, 45, 0, 255, 255, 46, 0, 255, 255, 47, 0, 255,
+        255, 48, 0, 255, 255, 49, 0, 255, 255, 50, 0, 255, 255, 51, 0, 255, 255, 52, 0, 255, 255, 53, 0, 255, 255, 54, 0, 255, 255, 55, 0, 255,
+        255, 56, 0, 255, 255, 57, 0, 255, 255, 58, 0, 255, 255, 59, 0, 255, 255, 60, 0, 255, 255, 61, 0, 255, 255, 62, 0, 255, 255, 63, 0, 255,
+        255, 64, 0, 255, 255, 65, 0, 255, 255, 66, 0, 255, 255, 67, 0, 255, 255, 68, 0, 255, 255, 69, 0, 255, 255, 70, 0, 255, 255, 71, 0, 255,
+        255, 72, 0, 255, 255, 73, 0, 255, 255, 74, 0, 255, 255, 75, 0, 255, 255, 76, 0, 255, 255, 77, 0, 255, 255, 78, 0, 255, 255, 79, 0, 255,
+        255, 80, 0, 255, 255, 81, 0, 255, 255, 82, 0, 255, 255, 83, 0, 255, 255, 84, 0, 255, 255, 85, 0, 255, 255, 86, 0, 255, 255, 87, 0, 255,
+        255, 88, 0, 255, 255, 89, 0, 255, 255, 90, 0, 255, 255, 91, 0, 255, 255, 92, 0, 255, 255, 93, 0, 255, 255, 94, 0, 255, 255, 95, 0, 255,
+        255, 96, 0, 255, 255, 97, 0, 255, 255, 98, 0, 255, 255, 99, 0, 255, 255, 100, 0, 255, 255, 101, 0, 255, 255, 102, 0, 255, 255, 103, 0, 255,
+        255, 104, 0, 255, 255, 105, 0, 255, 255, 106, 0, 255, 255, 107, 0, 255, 255, 108, 0, 255, 255, 109, 0, 255, 255, 110, 0, 255, 255, 111, 0, 255,
+        255, 112, 0, 255, 255, 113, 0, 255, 255, 114, 0, 255, 255, 115, 0, 255, 255, 116, 0, 255, 255, 117, 0, 255, 255, 118, 0, 255, 255, 119, 0, 255,
+        255, 120, 0, 255, 255, 121, 0, 255, 255, 122, 0, 255, 255, 123, 0, 255, 255, 124, 0, 255, 255, 125, 0, 255, 255, 126, 0, 255, 255, 127, 0, 255,
+        255, 128, 0, 255, 255, 129, 0, 255, 255, 130, 0, 255, 255, 131, 0, 255, 255, 132, 0, 255, 255, 133, 0, 255, 255, 134, 0, 255, 255, 135, 0, 255,
+        255, 136, 0, 255, 255, 137, 0, 255, 255, 138, 0, 255, 255, 139, 0, 255, 255, 140, 0, 255, 255, 141, 0, 255, 255, 142, 0, 255, 255, 143, 0, 255,
+        255, 144, 0, 255, 255, 145, 0, 255, 255, 146, 0, 255, 255, 147, 0, 255, 255, 148, 0, 255, 255, 149, 0, 255, 255, 150, 0, 255, 255, 151, 0, 255,
+        255, 152, 0, 255, 255, 153, 0, 255, 255, 154, 0, 255, 255, 155, 0, 255, 255, 156, 0, 255, 255, 157, 0, 255, 255, 158, 0, 255, 255, 159, 0, 255,
+        255, 160, 0, 255, 255, 161, 0, 255, 255, 162, 0, 255, 255, 163, 0, 255, 255, 164, 0, 255, 255, 165, 0, 255, 255, 166, 0, 255, 255, 167, 0, 255,
+        255, 168, 0, 255, 255, 169, 0, 255, 255, 170, 0, 255, 255, 171, 0, 255, 255, 172, 0, 255, 255, 173, 0, 255, 255, 174, 0, 255, 255, 175, 0, 255,
+        255, 176, 0, 255, 255, 177, 0, 255, 255, 178, 0, 255, 255, 179, 0, 255, 255, 180, 0, 255, 255, 181, 0, 255, 255, 182, 0, 255, 255, 183, 0, 255,
+        255, 184, 0, 255, 255, 185, 0, 255, 255, 186, 0, 255, 255, 187, 0, 255, 255, 188, 0, 255, 255, 189, 0, 255, 255, 190, 0, 255, 255, 191, 0, 255,
+        255, 192, 0, 255, 255, 193, 0, 255, 255, 194, 0, 255, 255, 195, 0, 255, 255, 196, 0, 255, 255, 197, 0, 255, 255, 198, 0, 255, 255, 199, 0, 255,
+        255, 200, 0, 255, 255, 201, 0, 255, 255, 202, 0, 255, 255, 203, 0, 255, 255, 204, 0, 255, 255, 205, 0, 255, 255, 206, 0, 255, 255, 207, 0, 255,
+        255, 208, 0, 255, 255, 209, 0, 255, 255, 210, 0, 255, 255, 211, 0, 255, 255, 212, 0, 255, 255, 213, 0, 255, 255, 214, 0, 255, 255, 215, 0, 255,
+        255, 216, 0, 255, 255, 217, 0, 255, 255, 218, 0, 255, 255, 219, 0, 255, 255, 220, 0, 255, 255, 221, 0, 255, 255, 222, 0, 255, 255, 223, 0, 255,
+        255, 224, 0, 255, 255, 225, 0, 255, 255, 226, 0, 255, 255, 227, 0, 255, 255, 228, 0, 255, 255, 229, 0, 255, 255, 230, 0, 255, 255, 231, 0, 255,
+        255, 232, 0, 255, 255, 233, 0, 255, 255, 234, 0, 255, 255, 235, 0, 255, 255, 236, 0, 255, 255, 237, 0, 255, 255, 238, 0, 255, 255, 239, 0, 255,
+        255, 240, 0, 255, 255, 241, 0, 255, 255, 242, 0, 255, 255, 243, 0, 255, 255, 244, 0, 255, 255, 245, 0, 255, 255, 246, 0, 255, 255, 247, 0, 255,
+        255, 248, 0, 255, 255, 249, 0, 255, 255, 250, 0, 255, 255, 251, 0, 255, 255, 252, 0, 255, 255, 253, 0, 255, 255, 254, 0, 255, 255, 255, 0, 255,
+    },
+    // Bone
+    {
+        0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 1, 255, 0, 0, 2, 255, 1, 1, 3, 255, 2, 2, 4, 255, 3, 3, 6, 255,
+        4, 4, 7, 255, 5, 5, 8, 255, 6, 6, 9, 255, 7, 7, 10, 255, 8, 8, 12, 255, 8, 8, 13, 255, 9, 9, 14, 255, 10, 10, 15, 255,
+        11, 11, 17, 255, 12, 12, 18, 255, 13, 13, 19, 255, 14, 14, 20, 255, 15, 15, 21, 255, 15, 15, 23, 255, 16, 16, 24, 255, 17, 17, 25, 255,
+        18, 18, 26, 255, 19, 19, 28, 255, 20, 20, 29, 255, 21, 21, 30, 255, 22, 22, 31, 255, 23, 23, 32, 255, 23, 23, 34, 255, 24, 24, 35, 255,
+        25, 25, 36, 255, 26, 26, 37, 255, 27, 27, 38, 255, 28, 28, 40, 255, 29, 29, 41, 255, 30, 30, 42, 255, 31, 31, 43, 255, 31, 31, 45, 255,
+        32, 32, 46, 255, 33, 33, 47, 255, 34, 34, 48, 255, 35, 35, 49, 255, 36, 36, 51, 255, 37, 37, 52, 255, 38, 38, 53, 255, 39, 39, 54, 255,
+        39, 39, 56, 255, 40, 40, 57, 255, 41, 41, 58, 255, 42, 42, 59, 255, 43, 43, 60, 255, 44, 44, 62, 255, 45, 45, 63, 255, 46, 46, 64, 255,
+        46, 46, 65, 255, 47, 47, 66, 255, 48, 48, 68, 255, 49, 49, 69, 255, 50, 50, 70, 255, 51, 51, 71, 255, 52, 52, 73, 255, 53, 53, 74, 255,
+        54, 54, 75, 255, 54, 54, 76, 255, 55, 55, 77, 255, 56, 56, 79, 255, 57, 57, 80, 255, 58, 58, 81, 255, 59, 59, 82, 255, 60, 60, 84, 255,
+        61, 61, 85, 255, 62, 62, 86, 255, 62, 62, 87, 255, 63, 63, 88, 255, 64, 64, 90, 255, 65, 65, 91, 255, 66, 66, 92, 255, 67, 67, 93, 255,
+        68, 68, 94, 255, 69, 69, 96, 255, 70, 70, 97, 255, 70, 70, 98, 255, 71, 71, 99, 255, 72, 72, 101, 255, 73, 73, 102, 255, 74, 74, 103, 255,
+        75, 75, 104, 255, 76, 76, 105, 255, 77, 77, 107, 255, 77, 77, 108, 255, 78, 78, 109, 255, 79, 79, 110, 255, 80, 80, 112, 255, 81, 81, 113, 255,
+        82, 82, 114, 255, 83, 83, 115, 255, 84, 85, 116, 255, 85, 86, 116, 255, 85, 87, 117, 255, 86, 88, 118, 255, 87, 89, 119, 255, 88, 91, 120, 255,
+        89, 92, 121, 255, 90, 93, 122, 255, 91, 94, 123, 255, 92, 95, 124, 255, 93, 97, 124, 255, 93, 98, 125, 255, 94, 99, 126, 255, 95, 100, 127, 255,
+        96, 102, 128, 255, 97, 103, 129, 255, 98, 104, 130, 255, 99, 105, 131, 255, 100, 106, 131, 255, 100, 108, 132, 255, 101, 109, 133, 255, 102, 110, 134, 255,
+        103, 111, 135, 255, 104, 113, 136, 255, 105, 114, 137, 255, 106, 115, 138, 255, 107, 116, 139, 255, 108, 117, 139, 255, 108, 119, 140, 255, 109, 120, 141, 255,
+        110, 121, 142, 255, 111, 122, 143, 255, 112, 123, 144, 255, 113, 125, 145, 255, 114, 126, 146, 255, 115, 127, 147, 255, 116, 128, 147, 255, 116, 130, 148, 255,
+        117, 131, 149, 255, 118, 132, 150, 255, 119, 133, 151, 255, 120, 134, 152, 255, 121, 136, 153, 255, 122, 137, 154, 255, 123, 138, 155, 255, 124, 139, 155, 255,
+        124, 141, 156, 255, 125, 142, 157, 255, 126, 143, 158, 255, 127, 144, 159, 255, 128, 145, 160, 255, 129, 147, 161, 255, 130, 148, 162, 255, 131, 149, 162, 255,
+        131, 150, 163, 255, 132, 151, 164, 255, 133, 153, 165, 255, 134, 154, 166, 255, 135, 155, 167, 255, 136, 156, 168, 255, 137, 158, 169, 255, 138, 159, 170, 255,
+        139, 160, 170, 255, 139, 161, 171, 255, 140, 162, 172, 255, 141, 164, 173, 255, 142, 165, 174, 255, 143, 166, 175, 255, 144, 167, 176, 255, 145, 169, 177, 255,
+        146, 170, 178, 255, 147, 171, 178, 255, 147, 172, 179, 255, 148, 173, 180, 255, 149, 175, 181, 255, 150, 176, 182, 255, 151, 177, 183, 255, 152, 178, 184, 255,
+        153, 179, 185, 255, 154, 181, 185, 255, 155, 182, 186, 255, 155, 183, 187, 255, 156, 184, 188, 255, 157, 186, 189, 255, 158, 187, 190, 255, 159, 188, 191, 255,
+        160, 189, 192, 255, 161, 190, 193, 255, 162, 192, 193, 255, 162, 193, 194, 255, 163, 194, 195, 255, 164, 195, 196, 255, 165, 197, 197, 255, 166, 198, 198, 255,
+        167, 199, 199, 255, 169, 200, 200, 255, 170, 201, 201, 255, 171, 201, 201, 255, 173, 202, 202, 255, 174, 203, 203, 255, 175, 204, 204, 255, 177, 205, 205, 255,
+        178, 206, 206, 255, 180, 207, 207, 255, 181, 208, 208, 255, 182, 209, 209, 255, 184, 209, 209, 255, 185, 210, 210, 255, 187, 211, 211, 255, 188, 212, 212, 255,
+        189, 213, 213, 255, 191, 214, 214, 255, 192, 215, 215, 255, 193, 216, 216, 255, 195, 216, 216, 255, 196, 217, 217, 255, 198, 218, 218, 255, 199, 219, 219, 255,
+        200, 220, 220, 255, 202, 221, 221, 255, 203, 222, 222, 255, 205, 223, 223, 255, 206, 224, 224, 255, 207, 224, 224, 255, 209, 225, 225, 255, 210, 226, 226, 255,
+        211, 227, 227, 255, 213, 228, 228, 255, 214, 229, 229, 255, 216, 230, 230, 255, 217, 231, 231, 255, 218, 232, 232, 255, 220, 232, 232, 255, 221, 233, 233, 255,
+        222, 234, 234, 255, 224, 235, 235, 255, 225, 236, 236, 255, 227, 237, 237, 255, 228, 238, 238, 255, 229, 239, 239, 255, 231, 239, 239, 255, 232, 240, 240, 255,
+        234, 241, 241, 255, 235, 242, 242, 255, 236, 243, 243, 255, 238, 244, 244, 255, 239, 245, 245, 255, 240, 246, 246, 255, 242, 247, 247, 255, 243, 247, 247, 255,
+        245, 248, 248, 255, 246, 249, 249, 255, 247, 250, 250, 255, 249, 251, 251, 255, 250, 252, 252, 255, 252, 253, 253, 255, 253, 254, 254, 255, 254, 255, 255, 255,
+    },
+    // Cool
+    {
+        0, 255, 255, 255, 0, 255, 255, 255, 0, 255, 255, 255, 0, 255, 255, 255, 1, 254, 255, 255, 2, 253, 255, 255, 3, 252, 255, 255, 4, 251, 255, 255,
+        5, 250, 255, 255, 6, 249, 255, 255, 7, 248, 255, 255, 8, 247, 255, 255, 9, 246, 255, 255, 10, 245, 255, 255, 11, 244, 255, 255, 12, 243, 255, 255,
+        13, 242, 255, 255, 14, 241, 255, 255, 15, 240, 255, 255, 16, 239, 255, 255, 17, 238, 255, 255, 18, 237, 255, 255, 19, 236, 255, 255, 20, 235, 255, 255,
+        21, 234, 255, 255, 22, 233, 255, 255, 23, 232, 255, 255, 24, 231, 255, 255, 25, 230, 255, 255, 26, 229, 255, 255, 27, 228, 255, 255, 28, 227, 255, 255,
+        29, 226, 255, 255, 30, 225, 255, 255, 31, 224, 255, 255, 32, 223, 255, 255, 33, 222, 255, 255, 34, 221, 255, 255, 35, 220, 255, 255, 36, 219, 255, 255,
+        37, 218, 255, 255, 38, 217, 255, 255, 39, 216, 255, 255, 40, 215, 255, 255, 41, 214, 255, 255, 42, 213, 255, 255, 43, 212, 255, 255, 44, 211, 255, 255,
+        45, 210, 255, 255, 46, 209, 255, 255, 47, 208, 255, 255, 48, 207, 255, 255, 49, 206, 255, 255, 50, 205, 255, 255, 51, 204, 255, 255, 52, 203, 255, 255,
+        53, 202, 255, 255, 54, 201, 255, 255, 55, 200, 255, 255, 56, 199, 255, 255, 57, 198, 255, 255, 58, 197, 255, 255, 59, 196, 255, 255, 60, 195, 255, 255,
+        61, 194, 255, 255, 62, 193, 255, 255, 63, 192, 255, 255, 64, 191, 255, 255, 65, 190, 255, 255, 66, 189, 255, 255, 67, 188, 255, 255, 68, 187, 255, 255,
+        69, 186, 255, 255, 70, 185, 255, 255, 71, 184, 255, 255, 72, 183, 255, 255, 73, 182, 255, 255, 74, 181, 255, 255, 75, 180, 255, 255, 76, 179, 255, 255,
+        77, 178, 255, 255, 78, 177, 255, 255, 79, 176, 255, 255, 80, 175, 255, 255, 81, 174, 255, 255, 82, 173, 255, 255, 83, 172, 255, 255, 84, 171, 255, 255,
+        86, 169, 255, 255, 87, 168, 255, 255, 88, 167, 255, 255, 89, 166, 255, 255, 90, 165, 255, 255, 91, 164, 255, 255, 92, 163, 255, 255, 93, 162, 255, 255,
+        94, 161, 255, 255, 95, 160, 255, 255, 96, 159, 255, 255, 97, 158, 255, 255, 98, 157, 255, 255, 99, 156, 255, 255, 100, 155, 255, 255, 101, 154, 255, 255,
+        102, 153, 255, 255, 103, 152, 255, 255, 104, 151, 255, 255, 105, 150, 255, 255, 106, 149, 255, 255, 107, 148, 255, 255, 108, 147, 255, 255, 109, 146, 255, 255,
+        110, 145, 255, 255, 111, 144, 255, 255, 112, 143, 255, 255, 113, 142, 255, 255, 114, 141, 255, 255, 115, 140, 255, 255, 116, 139, 255, 255, 117, 138, 255, 255,
+        118, 137, 255, 255, 119, 136, 255, 255, 120, 135, 255, 255, 121, 134, 255, 255, 122, 133, 255, 255, 123, 132, 255, 255, 124, 131, 255, 255, 125, 130, 255, 255,
+        126, 129, 255, 255, 127, 128, 255, 255, 128, 127, 255, 255, 129, 126, 255, 255, 130, 125, 255, 255, 131, 124, 255, 255, 132, 123, 255, 255, 133, 122, 255, 255,
+        134, 121, 255, 255, 135, 120, 255, 255, 136, 119, 255, 255, 137, 118, 255, 255, 138, 117, 255, 255, 139, 116, 255, 255, 140, 115, 255, 255, 141, 114, 255, 255,
+        142, 113, 255, 255, 143, 112, 255, 255, 144, 111, 255, 255, 145, 110, 255, 255, 146, 109, 255, 255, 147, 108, 255, 255, 148, 107, 255, 255, 149, 106, 255, 255,
+        150, 105, 255, 255, 151, 104, 255, 255, 152, 103, 255, 255, 153, 102, 255, 255, 154, 101, 255, 255, 155, 100, 255, 255, 156, 99, 255, 255, 157, 98, 255, 255,
+        158, 97, 255, 255, 159, 96, 255, 255, 160, 95, 255, 255, 161, 94, 255, 255, 162, 93, 255, 255, 163, 92, 255, 255, 164, 91, 255, 255, 165, 90, 255, 255,
+        166, 89, 255, 255, 167, 88, 255, 255, 168, 87, 255, 255, 169, 86, 255, 255, 171, 84, 255, 255, 172, 83, 255, 255, 173, 82, 255, 255, 174, 81, 255, 255,
+        175, 80, 255, 255, 176, 79, 255, 255, 177, 78, 255, 255, 178, 77, 255, 255, 179, 76, 255, 255, 180, 75, 255, 255, 181, 74, 255, 255, 182, 73, 255, 255,
+        183, 72, 255, 255, 184, 71, 255, 255, 185, 70, 255, 255, 186, 69, 255, 255, 187, 68, 255, 255, 188, 67, 255, 255, 189, 66, 255, 255, 190, 65, 255, 255,
+        191, 64, 255, 255, 192, 63, 255, 255, 193, 62, 255, 255, 194, 61, 255, 255, 195, 60, 255, 255, 196, 59, 255, 255, 197, 58, 255, 255, 198, 57, 255, 255,
+        199, 56, 255, 255, 200, 55, 255, 255, 201, 54, 255, 255, 202, 53, 255, 255, 203, 52, 255, 255, 204, 51, 255, 255, 205, 50, 255, 255, 206, 49, 255, 255,
+        207, 48, 255, 255, 208, 47, 255, 255, 209, 46, 255, 255, 210, 45, 255, 255, 211, 44, 255, 255, 212, 43, 255, 255, 213, 42, 255, 255, 214, 41, 255, 255,
+        215, 40, 255, 255, 216, 39, 255, 255, 217, 38, 255, 255, 218, 37, 255, 255, 219, 36, 255, 255, 220, 35, 255, 255, 221, 34, 255, 255, 222, 33, 255, 255,
+        223, 32, 255, 255, 224, 31, 255, 255, 225, 30, 255, 255, 226, 29, 255, 255, 227, 28, 255, 255, 228, 27, 255, 255, 229, 26, 255, 255, 230, 25, 255, 255,
+        231, 24, 255, 255, 232, 23, 255, 255, 233, 22, 255, 255, 234, 21, 255, 255, 235, 20, 255, 255, 236, 19, 255, 255, 237, 18, 255, 255, 238, 17, 255, 255,
+        239, 16, 255, 255, 240, 15, 255, 255, 241, 14, 255, 255, 242, 13, 255, 255, 243, 12, 255, 255, 244, 11, 255, 255, 245, 10, 255, 255, 246, 9, 255, 255,
+        247, 8, 255, 255, 248, 7, 255, 255, 249, 6, 255, 255, 250, 5, 255, 255, 251, 4, 255, 255, 252, 3, 255, 255, 253, 2, 255, 255, 254, 1, 255, 255,
+    },
+    // Copper
+    {
+        6, 0, 2, 255, 7, 0, 3, 255, 8, 0, 3, 255, 9, 0, 4, 255, 11, 0, 4, 255, 12, 1, 5, 255, 13, 2, 5, 255, 15, 3, 6, 255,
+        16, 4, 6, 255, 17, 4, 7, 255, 18, 5, 7, 255, 20, 6, 8, 255, 21, 7, 8, 255, 22, 8, 9, 255, 23, 8, 9, 255, 25, 9, 10, 255,
+        26, 10, 10, 255, 27, 11, 11, 255, 28, 11, 11, 255, 30, 12, 12, 255, 31, 13, 12, 255, 32, 14, 13, 255, 34, 15, 13, 255, 35, 15, 14, 255,
+        36, 16, 14, 255, 37, 17, 15, 255, 39, 18, 15, 255, 40, 19, 16, 255, 41, 19, 16, 255, 42, 20, 17, 255, 44, 21, 17, 255, 45, 22, 18, 255,
+        46, 23, 18, 255, 47, 23, 19, 255, 49, 24, 19, 255, 50, 25, 20, 255, 51, 26, 20, 255, 52, 26, 21, 255, 54, 27, 21, 255, 55, 28, 22, 255,
+        56, 29, 22, 255, 58, 30, 23, 255, 59, 30, 23, 255, 60, 31, 24, 255, 61, 32, 24, 255, 63, 33, 25, 255, 64, 34, 25, 255, 65, 34, 26, 255,
+        66, 35, 26, 255, 68, 36, 27, 255, 69, 37, 27, 255, 70, 38, 28, 255, 71, 38, 28, 255, 73, 39, 29, 255, 74, 40, 29, 255, 75, 41, 30, 255,
+        77, 41, 30, 255, 78, 42, 31, 255, 79, 43, 31, 255, 80, 44, 32, 255, 82, 45, 32, 255, 83, 45, 33, 255, 84, 46, 33, 255, 85, 47, 34, 255,
+        87, 48, 34, 255, 88, 49, 35, 255, 89, 49, 35, 255, 90, 50, 36, 255, 92, 51, 36, 255, 93, 52, 37, 255, 94, 53, 38, 255, 95, 53, 38, 255,
+        97, 54, 39, 255, 98, 55, 39, 255, 99, 56, 40, 255, 101, 57, 40, 255, 102, 57, 41, 255, 103, 58, 41, 255, 104, 59, 42, 255, 106, 60, 42, 255,
+        107, 60, 43, 255, 108, 61, 43, 255, 109, 62, 44, 255, 111, 63, 44, 255, 112, 64, 45, 255, 113, 64, 45, 255, 114, 65, 46, 255, 116, 66, 46, 255,
+        117, 67, 47, 255, 118, 68, 47, 255, 120, 68, 48, 255, 121, 69, 48, 255, 122, 70, 49, 255, 123, 71, 49, 255, 125, 72, 50, 255, 126, 72, 50, 255,
+        127, 73, 51, 255, 128, 74, 51, 255, 130, 75, 52, 255, 131, 75, 52, 255, 132, 76, 53, 255, 133, 77, 53, 255, 135, 78, 54, 255, 136, 79, 54, 255,
+        137, 79, 55, 255, 139, 80, 55, 255, 140, 81, 56, 255, 141, 82, 56, 255, 142, 83, 57, 255, 144, 83, 57, 255, 145, 84, 58, 255, 146, 85, 58, 255,
+        147, 86, 59, 255, 149, 87, 59, 255, 150, 87, 60, 255, 151, 88, 60, 255, 152, 89, 61, 255, 154, 90, 61, 255, 155, 91, 62, 255, 156, 91, 62, 255,
+        157, 92, 63, 255, 159, 93, 63, 255, 160, 94, 64, 255, 161, 94, 64, 255, 163, 95, 65, 255, 164, 96, 65, 255, 165, 97, 66, 255, 166, 98, 66, 255,
+        168, 98, 67, 255, 169, 99, 67, 255, 170, 100, 68, 255, 171, 101, 68, 255, 173, 102, 69, 255, 174, 102, 69, 255, 175, 103, 70, 255, 176, 104, 70, 255,
+        178, 105, 71, 255, 179, 106, 71, 255, 180, 106, 72, 255, 182, 107, 72, 255, 183, 108, 73, 255, 184, 109, 73, 255, 185, 109, 74, 255, 187, 110, 74, 255,
+        188, 111, 75, 255, 189, 112, 75, 255, 190, 113, 76, 255, 192, 113, 76, 255, 193, 114, 77, 255, 194, 115, 77, 255, 195, 116, 78, 255, 197, 117, 78, 255,
+        198, 117, 79, 255, 199, 118, 79, 255, 200, 119, 80, 255, 202, 120, 80, 255, 203, 121, 81, 255, 204, 121, 81, 255, 206, 122, 82, 255, 207, 123, 82, 255,
+        208, 124, 83, 255, 209, 125, 83, 255, 211, 125, 84, 255, 212, 126, 84, 255, 213, 127, 85, 255, 214, 128, 85, 255, 216, 128, 86, 255, 217, 129, 86, 255,
+        218, 130, 87, 255, 219, 131, 87, 255, 221, 132, 88, 255, 222, 132, 88, 255, 223, 133, 89, 255, 225, 134, 89, 255, 226, 135, 90, 255, 227, 136, 90, 255,
+        228, 136, 91, 255, 230, 137, 91, 255, 231, 138, 92, 255, 232, 139, 92, 255, 233, 140, 93, 255, 235, 140, 93, 255, 236, 141, 94, 255, 237, 142, 94, 255,
+        238, 143, 95, 255, 240, 143, 95, 255, 241, 144, 96, 255, 242, 145, 96, 255, 243, 146, 97, 255, 245, 147, 97, 255, 246, 147, 98, 255, 247, 148, 98, 255,
+        249, 149, 99, 255, 250, 150, 99, 255, 251, 151, 100, 255, 252, 151, 100, 255, 254, 152, 101, 255, 255, 153, 101, 255, 255, 154, 102, 255, 255, 155, 102, 255,
+        255, 155, 103, 255, 255, 156, 103, 255, 255, 157, 104, 255, 255, 158, 104, 255, 255, 158, 105, 255, 255, 159, 105, 255, 255, 160, 106, 255, 255, 161, 106, 255,
+        255, 162, 107, 255, 255, 162, 107, 255, 255, 163, 108, 255, 255, 164, 108, 255, 255, 165, 109, 255, 255, 166, 109, 255, 255, 166, 110, 255, 255, 167, 111, 255,
+        255, 168, 111, 255, 255, 169, 112, 255, 255, 170, 112, 255, 255, 170, 113, 255, 255, 171, 113, 255, 255, 172, 114, 255, 255, 173, 114, 255, 255, 174, 115, 255,
+        255, 174, 115, 255, 255, 175, 116, 255, 255, 176, 116, 255, 255, 177, 117, 255, 255, 177, 117, 255, 255, 178, 118, 255, 255, 179, 118, 255, 255, 180, 119, 255,
+        255, 181, 119, 255, 255, 181, 120, 255, 255, 182, 120, 255, 255, 183, 121, 255, 255, 184, 121, 255, 255, 185, 122, 255, 255, 185, 122, 255, 255, 186, 123, 255,
+        255, 187, 123, 255, 255, 188, 124, 255, 255, 189, 124, 255, 255, 189, 125, 255, 255, 190, 125, 255, 255, 191, 126, 255, 255, 192, 126, 255, 255, 192, 127, 255,
+        255, 193, 127, 255, 255, 194, 128, 255, 255, 195, 128, 255, 255, 196, 129, 255, 255, 196, 129, 255, 255, 197, 130, 255, 255, 198, 130, 255, 255, 199, 131, 255,
+    },
+    // Gray
+    {
+        0, 0, 0, 255, 1, 1, 1, 255, 2, 2, 2, 255, 3, 3, 3, 255, 4, 4, 4, 255, 5, 5, 5, 255, 6, 6, 6, 255, 7, 7, 7, 255,
+        8, 8, 8, 255, 9, 9, 9, 255, 10, 10, 10, 255, 11, 11, 11, 255, 12, 12, 12, 255, 13, 13, 13, 255, 14, 14, 14, 255, 15, 15, 15, 255,
+        16, 16, 16, 255, 17, 17, 17, 255, 18, 18, 18, 255, 19, 19, 19, 255, 20, 20, 20, 255, 21, 21, 21, 255, 22, 22, 22, 255, 23, 23, 23, 255,
+        24, 24, 24, 255, 25, 25, 25, 255, 26, 26, 26, 255, 27, 27, 27, 255, 28, 28, 28, 255, 29, 29, 29, 255, 30, 30, 30, 255, 31, 31, 31, 255,
+        32, 32, 32, 255, 33, 33, 33, 255, 34, 34, 34, 255, 35, 35, 35, 255, 36, 36, 36, 255, 37, 37, 37, 255, 38, 38, 38, 255, 39, 39, 39, 255,
+        40, 40, 40, 255, 41, 41, 41, 255, 42, 42, 42, 255, 43, 43, 43, 255, 44, 44, 44, 255, 45, 45, 45, 255, 46, 46, 46, 255, 47, 47, 47, 255,
+        48, 48, 48, 255, 49, 49, 49, 255, 50, 50, 50, 255, 51, 51, 51, 255, 52, 52, 52, 255, 53, 53, 53, 255, 54, 54, 54, 255, 55, 55, 55, 255,
+        56, 56, 56, 255, 57, 57, 57, 255, 58, 58, 58, 255, 59, 59, 59, 255, 60, 60, 60, 255, 61, 61, 61, 255, 62, 62, 62, 255, 63, 63, 63, 255,
+        64, 64, 64, 255, 65, 65, 65, 255, 66, 66, 66, 255, 67, 67, 67, 255, 68, 68, 68, 255, 69, 69, 69, 255, 70, 70, 70, 255, 71, 71, 71, 255,
+        72, 72, 72, 255, 73, 73, 73, 255, 74, 74, 74, 255, 75, 75, 75, 255, 76, 76, 76, 255, 77, 77, 77, 255, 78, 78, 78, 255, 79, 79, 79, 255,
+        80, 80, 80, 255, 81, 81, 81, 255, 82, 82, 82, 255, 83, 83, 83, 255, 84, 84, 84, 255, 85, 85, 85, 255, 86, 86, 86, 255, 87, 87, 87, 255,
+        88, 88, 88, 255, 89, 89, 89, 255, 90, 90, 90, 255, 91, 91, 91, 255, 92, 92, 92, 255, 93, 93, 93, 255, 94, 94, 94, 255, 95, 95, 95, 255,
+        96, 96, 96, 255, 97, 97, 97, 255, 98, 98, 98, 255, 99, 99, 99, 255, 100, 100, 100, 255, 101, 101, 101, 255, 102, 102, 102, 255, 103, 103, 103, 255,
+        104, 104, 104, 255, 105, 105, 105, 255, 106, 106, 106, 255, 107, 107, 107, 255, 108, 108, 108, 255, 109, 109, 109, 255, 110, 110, 110, 255, 111, 111, 111, 255,
+        112, 112, 112, 255, 113, 113, 113, 255, 114, 114, 114, 255, 115, 115, 115, 255, 116, 116, 116, 255, 117, 117, 117, 255, 118, 118, 118, 255, 119, 119, 119, 255,
+        120, 120, 120, 255, 121, 121, 121, 255, 122, 122, 122, 255, 123, 123, 123, 255, 124, 124, 124, 255, 125, 125, 125, 255, 126, 126, 126, 255, 127, 127, 127, 255,
+        128, 128, 128, 255, 129, 129, 129, 255, 130, 130, 130, 255, 131, 131, 131, 255, 132, 132, 132, 255, 133, 133, 133, 255, 134, 134, 134, 255, 135, 135, 135, 255,
+        136, 136, 136, 255, 137, 137, 137, 255, 138, 138, 138, 255, 139, 139, 139, 255, 140, 140, 140, 255, 141, 141, 141, 255, 142, 142, 142, 255, 143, 143, 143, 255,
+        144, 144, 144, 255, 145, 145, 145, 255, 146, 146, 146, 255, 147, 147, 147, 255, 148, 148, 148, 255, 149, 149, 149, 255, 150, 150, 150, 255, 151, 151, 151, 255,
+        152, 152, 152, 255, 153, 153, 153, 255, 154, 154, 154, 255, 155, 155, 155, 255, 156, 156, 156, 255, 157, 157, 157, 255, 158, 158, 158, 255, 159, 159, 159, 255,
+        160, 160, 160, 255, 161, 161, 161, 255, 162, 162, 162, 255, 163, 163, 163, 255, 164, 164, 164, 255, 165, 165, 165, 255, 166, 166, 166, 255, 167, 167, 167, 255,
+        168, 168, 168, 255, 169, 169, 169, 255, 170, 170, 170, 255, 171, 171, 171, 255, 172, 172, 172, 255, 173, 173, 173, 255, 174, 174, 174, 255, 175, 175, 175, 255,
+        176, 176, 176, 255, 177, 177, 177, 255, 178, 178, 178, 255, 179, 179, 179, 255, 180, 180, 180, 255, 181, 181, 181, 255, 182, 182, 182, 255, 183, 183, 183, 255,
+        184, 184, 184, 255, 185, 185, 185, 255, 186, 186, 186, 255, 187, 187, 187, 255, 188, 188, 188, 255, 189, 189, 189, 255, 190, 190, 190, 255, 191, 191, 191, 255,
+        192, 192, 192, 255, 193, 193, 193, 255, 194, 194, 194, 255, 195, 195, 195, 255, 196, 196, 196, 255, 197, 197, 197, 255, 198, 198, 198, 255, 199, 199, 199, 255,
+        200, 200, 200, 255, 201, 201, 201, 255, 202, 202, 202, 255, 203, 203, 203, 255, 204, 204, 204, 255, 205, 205, 205, 255, 206, 206, 206, 255, 207, 207, 207, 255,
+        208, 208, 208, 255, 209, 209, 209, 255, 210, 210, 210, 255, 211, 211, 211, 255, 212, 212, 212, 255, 213, 213, 213, 255, 214, 214, 214, 255, 215, 215, 215, 255,
+        216, 216, 216, 255, 217, 217, 217, 255, 218, 218, 218, 255, 219, 219, 219, 255, 220, 220, 220, 255, 221, 221, 221, 255, 222, 222, 222, 255, 223, 223, 223, 255,
+        224, 224, 224, 255, 225, 225, 225, 255, 226, 226, 226, 255, 227, 227, 227, 255, 228, 228, 228, 255, 229, 229, 229, 255, 230, 230, 230, 255, 231, 231, 231, 255,
+        232, 232, 232, 255, 233, 233, 233, 255, 234, 234, 234, 255, 235, 235, 235, 255, 236, 236, 236, 255, 237, 237, 237, 255, 238, 238, 238, 255, 239, 239, 239, 255,
+        240, 240, 240, 255, 241, 241, 241, 255, 242, 242, 242, 255, 243, 243, 243, 255, 244, 244, 244, 255, 245, 245, 245, 255, 246, 246, 246, 255, 247, 247, 247, 255,
+        248, 248, 248, 255, 249, 249, 249, 255, 250, 250, 250, 255, 251, 251, 251, 255, 252, 252, 252, 255, 253, 253, 253, 255, 254, 254, 254, 255, 255, 255, 255, 255,
+    },
+    // Hot
+    {
+        1, 0, 0, 255, 4, 0, 0, 255, 7, 0, 0, 255, 9, 0, 0, 255, 12, 0, 0, 255, 15, 0, 0, 255, 17, 0, 0, 255, 20, 0, 0, 255,
+        23, 0, 0, 255, 25, 0, 0, 255, 28, 0, 0, 255, 31, 0, 0, 255, 33, 0, 0, 255, 36, 0, 0, 255, 39, 0, 0, 255, 41, 0, 0, 255,
+        44, 0, 0, 255, 46, 0, 0, 255, 49, 0, 0, 255, 52, 0, 0, 255, 54, 0, 0, 255, 57, 0, 0, 255, 60, 0, 0, 255, 62, 0, 0, 255,
+        65, 0, 0, 255, 68, 0, 0, 255, 70, 0, 0, 255, 73, 0, 0, 255, 76, 0, 0, 255, 78, 0, 0, 255, 81, 0, 0, 255, 84, 0, 0, 255,
+        86, 0, 0, 255, 89, 0, 0, 255, 92, 0, 0, 255, 94, 0, 0, 255, 97, 0, 0, 255, 100, 0, 0, 255, 102, 0, 0, 255, 105, 0, 0, 255,
+        108, 0, 0, 255, 110, 0, 0, 255, 113, 0, 0, 255, 116, 0, 0, 255, 118, 0, 0, 255, 121, 0, 0, 255, 124, 0, 0, 255, 126, 0, 0, 255,
+        129, 0, 0, 255, 131, 0, 0, 255, 134, 0, 0, 255, 137, 0, 0, 255, 139, 0, 0, 255, 142, 0, 0, 255, 145, 0, 0, 255, 147, 0, 0, 255,
+        150, 0, 0, 255, 153, 0, 0, 255, 155, 0, 0, 255, 158, 0, 0, 255, 161, 0, 0, 255, 163, 0, 0, 255, 166, 0, 0, 255, 169, 0, 0, 255,
+        171, 0, 0, 255, 174, 0, 0, 255, 177, 0, 0, 255, 179, 0, 0, 255, 182, 0, 0, 255, 185, 0, 0, 255, 187, 0, 0, 255, 190, 0, 0, 255,
+        193, 0, 0, 255, 195, 0, 0, 255, 198, 0, 0, 255, 201, 0, 0, 255, 203, 0, 0, 255, 206, 0, 0, 255, 209, 0, 0, 255, 211, 0, 0, 255,
+        214, 0, 0, 255, 216, 0, 0, 255, 219, 0, 0, 255, 222, 0, 0, 255, 224, 0, 0, 255, 227, 0, 0, 255, 230, 0, 0, 255, 232, 0, 0, 255,
+        235, 0, 0, 255, 238, 0, 0, 255, 240, 0, 0, 255, 243, 0, 0, 255, 246, 0, 0, 255, 248, 0, 0, 255, 251, 0, 0, 255, 254, 0, 0, 255,
+        255, 1, 0, 255, 255, 4, 0, 255, 255, 7, 0, 255, 255, 9, 0, 255, 255, 12, 0, 255, 255, 15, 0, 255, 255, 17, 0, 255, 255, 20, 0, 255,
+        255, 23, 0, 255, 255, 25, 0, 255, 255, 28, 0, 255, 255, 31, 0, 255, 255, 33, 0, 255, 255, 36, 0, 255, 255, 39, 0, 255, 255, 41, 0, 255,
+        255, 44, 0, 255, 255, 46, 0, 255, 255, 49, 0, 255, 255, 52, 0, 255, 255, 54, 0, 255, 255, 57, 0, 255, 255, 60, 0, 255, 255, 62, 0, 255,
+        255, 65, 0, 255, 255, 68, 0, 255, 255, 70, 0, 255, 255, 73, 0, 255, 255, 76, 0, 255, 255, 78, 0, 255, 255, 81, 0, 255, 255, 84, 0, 255,
+        255, 86, 0, 255, 255, 89, 0, 255, 255, 92, 0, 255, 255, 94, 0, 255, 255, 97, 0, 255, 255, 100, 0, 255, 255, 102, 0, 255, 255, 105, 0, 255,
+        255, 108, 0, 255, 255, 110, 0, 255, 255, 113, 0, 255, 255, 116, 0, 255, 255, 118, 0, 255, 255, 121, 0, 255, 255, 124, 0, 255, 255, 126, 0, 255,
+        255, 129, 0, 255, 255, 131, 0, 255, 255, 134, 0, 255, 255, 137, 0, 255, 255, 139, 0, 255, 255, 142, 0, 255, 255, 145, 0, 255, 255, 147, 0, 255,
+        255, 150, 0, 255, 255, 153, 0, 255, 255, 155, 0, 255, 255, 158, 0, 255, 255, 161, 0, 255, 255, 163, 0, 255, 255, 166, 0, 255, 255, 169, 0, 255,
+        255, 171, 0, 255, 255, 174, 0, 255, 255, 177, 0, 255, 255, 179, 0, 255, 255, 182, 0, 255, 255, 185, 0, 255, 255, 187, 0, 255, 255, 190, 0, 255,
+        255, 193, 0, 255, 255, 195, 0, 255, 255, 198, 0, 255, 255, 201, 0, 255, 255, 203, 0, 255, 255, 206, 0, 255, 255, 209, 0, 255, 255, 211, 0, 255,
+        255, 214, 0, 255, 255, 216, 0, 255, 255, 219, 0, 255, 255, 222, 0, 255, 255, 224, 0, 255, 255, 227, 0, 255, 255, 230, 0, 255, 255, 232, 0, 255,
+        255, 235, 0, 255, 255, 238, 0, 255, 255, 240, 0, 255, 255, 243, 0, 255, 255, 246, 0, 255, 255, 248, 0, 255, 255, 251, 0, 255, 255, 254, 0, 255,
+        255, 255, 2, 255, 255, 255, 6, 255, 255, 255, 10, 255, 255, 255, 14, 255, 255, 255, 18, 255, 255, 255, 22, 255, 255, 255, 26, 255, 255, 255, 30, 255,
+        255, 255, 34, 255, 255, 255, 38, 255, 255, 255, 42, 255, 255, 255, 46, 255, 255, 255, 50, 255, 255, 255, 54, 255, 255, 255, 58, 255, 255, 255, 62, 255,
+        255, 255, 66, 255, 255, 255, 70, 255, 255, 255, 74, 255, 255, 255, 78, 255, 255, 255, 82, 255, 255, 255, 86, 255, 255, 255, 90, 255, 255, 255, 94, 255,
+        255, 255, 98, 255, 255, 255, 102, 255, 255, 255, 106, 255, 255, 255, 110, 255, 255, 255, 114, 255, 255, 255, 118, 255, 255, 255, 122, 255, 255, 255, 126, 255,
+        255, 255, 129, 255, 255, 255, 133, 255, 255, 255, 137, 255, 255, 255, 141, 255, 255, 255, 145, 255, 255, 255, 149, 255, 255, 255, 153, 255, 255, 255, 157, 255,
+        255, 255, 161, 255, 255, 255, 165, 255, 255, 255, 169, 255, 255, 255, 173, 255, 255, 255, 177, 255, 255, 255, 181, 255, 255, 255, 185, 255, 255, 255, 189, 255,
+        255, 255, 193, 255, 255, 255, 197, 255, 255, 255, 201, 255, 255, 255, 205, 255, 255, 255, 209, 255, 255, 255, 213, 255, 255, 255, 217, 255, 255, 255, 221, 255,
+        255, 255, 225, 255, 255, 255, 229, 255, 255, 255, 233, 255, 255, 255, 237, 255, 255, 255, 241, 255, 255, 255, 245, 255, 255, 255, 249, 255, 255, 255, 253, 255,
+    },
+    // HSV
+    {
+        255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 3, 0, 255, 255, 9, 0, 255, 255, 15, 0, 255, 255, 21, 0, 255,
+        255, 27, 0, 255, 255, 33, 0, 255, 255, 39, 0, 255, 255, 45, 0, 255, 255, 51, 0, 255, 255, 57, 0, 255, 255, 63, 0, 255, 255, 69, 0, 255,
+        255, 75, 0, 255, 255, 81, 0, 255, 255, 87, 0, 255, 255, 93, 0, 255, 255, 99, 0, 255, 255, 105, 0, 255, 255, 111, 0, 255, 255, 117, 0, 255,
+        255, 123, 0, 255, 255, 128, 0, 255, 255, 134, 0, 255, 255, 140, 0, 255, 255, 146, 0, 255, 255, 152, 0, 255, 255, 158, 0, 255, 255, 164, 0, 255,
+        255, 170, 0, 255, 255, 176, 0, 255, 255, 182, 0, 255, 255, 188, 0, 255, 255, 194, 0, 255, 255, 200, 0, 255, 255, 206, 0, 255, 255, 212, 0, 255,
+        255, 218, 0, 255, 255, 224, 0, 255, 255, 230, 0, 255, 255, 236, 0, 255, 255, 242, 0, 255, 255, 248, 0, 255, 255, 254, 0, 255, 250, 255, 0, 255,
+        244, 255, 0, 255, 238, 255, 0, 255, 232, 255, 0, 255, 226, 255, 0, 255, 220, 255, 0, 255, 214, 255, 0, 255, 208, 255, 0, 255, 202, 255, 0, 255,
+        196, 255, 0, 255, 190, 255, 0, 255, 184, 255, 0, 255, 178, 255, 0, 255, 172, 255, 0, 255, 166, 255, 0, 255, 160, 255, 0, 255, 154, 255, 0, 255,
+        148, 255, 0, 255, 142, 255, 0, 255, 136, 255, 0, 255, 130, 255, 0, 255, 125, 255, 0, 255, 119, 255, 0, 255, 113, 255, 0, 255, 107, 255, 0, 255,
+        101, 255, 0, 255, 95, 255, 0, 255, 89, 255, 0, 255, 83, 255, 0, 255, 77, 255, 0, 255, 71, 255, 0, 255, 65, 255, 0, 255, 59, 255, 0, 255,
+        53, 255, 0, 255, 47, 255, 0, 255, 41, 255, 0, 255, 35, 255, 0, 255, 29, 255, 0, 255, 23, 255, 0, 255, 17, 255, 0, 255, 11, 255, 0, 255,
+        5, 255, 0, 255, 0, 255, 1, 255, 0, 255, 7, 255, 0, 255, 13, 255, 0, 255, 19, 255, 0, 255, 25, 255, 0, 255, 31, 255, 0, 255, 37, 255,
+        0, 255, 43, 255, 0, 255, 49, 255, 0, 255, 55, 255, 0, 255, 61, 255, 0, 255, 67, 255, 0, 255, 73, 255, 0, 255, 79, 255, 0, 255, 85, 255,
+        0, 255, 91, 255, 0, 255, 97, 255, 0, 255, 103, 255, 0, 255, 109, 255, 0, 255, 115, 255, 0, 255, 121, 255, 0, 255, 127, 255, 0, 255, 132, 255,
+        0, 255, 138, 255, 0, 255, 144, 255, 0, 255, 150, 255, 0, 255, 156, 255, 0, 255, 162, 255, 0, 255, 168, 255, 0, 255, 174, 255, 0, 255, 180, 255,
+        0, 255, 186, 255, 0, 255, 192, 255, 0, 255, 198, 255, 0, 255, 204, 255, 0, 255, 210, 255, 0, 255, 216, 255, 0, 255, 222, 255, 0, 255, 228, 255,
+        0, 255, 234, 255, 0, 255, 240, 255, 0, 255, 246, 255, 0, 255, 252, 255, 0, 255, 255, 255, 0, 255, 255, 255, 0, 255, 255, 255, 0, 255, 255, 255,
+        0, 255, 255, 255, 0, 255, 255, 255, 0, 255, 255, 255, 0, 255, 255, 255, 0, 255, 255, 255, 0, 255, 255, 255, 0, 255, 255, 255, 0, 255, 255, 255,
+        0, 255, 255, 255, 0, 255, 255, 255, 0, 255, 255, 255, 0, 255, 255, 255, 0, 255, 255, 255, 0, 255, 255, 255, 0, 255, 255, 255, 0, 255, 255, 255,
+        0, 255, 255, 255, 0, 255, 255, 255, 0, 255, 255, 255, 0, 255, 255, 255, 0, 255, 255, 255, 0, 255, 255, 255, 0, 255, 255, 255, 0, 255, 255, 255,
+        0, 255, 255, 255, 0, 255, 255, 255, 0, 255, 255, 255, 0, 255, 255, 255, 0, 255, 255, 255, 0, 255, 255, 255, 0, 255, 255, 255, 0, 255, 255, 255,
+        0, 252, 255, 255, 0, 246, 255, 255, 0, 240, 255, 255, 0, 234, 255, 255, 0, 228, 255, 255, 0, 222, 255, 255, 0, 216, 255, 255, 0, 210, 255, 255,
+        0, 204, 255, 255, 0, 198, 255, 255, 0, 192, 255, 255, 0, 186, 255, 255, 0, 180, 255, 255, 0, 174, 255, 255, 0, 168, 255, 255, 0, 162, 255, 255,
+        0, 156, 255, 255, 0, 150, 255, 255, 0, 144, 255, 255, 0, 138, 255, 255, 0, 132, 255, 255, 0, 127, 255, 255, 0, 121, 255, 255, 0, 115, 255, 255,
+        0, 109, 255, 255, 0, 103, 255, 255, 0, 97, 255, 255, 0, 91, 255, 255, 0, 85, 255, 255, 0, 79, 255, 255, 0, 73, 255, 255, 0, 67, 255, 255,
+        0, 61, 255, 255, 0, 55, 255, 255, 0, 49, 255, 255, 0, 43, 255, 255, 0, 37, 255, 255, 0, 31, 255, 255, 0, 25, 255, 255, 0, 19, 255, 255,
+        0, 13, 255, 255, 0, 7, 255, 255, 0, 1, 255, 255, 5, 0, 255, 255, 11, 0, 255, 255, 17, 0, 255, 255, 23, 0, 255, 255, 29, 0, 255, 255,
+        35, 0, 255, 255, 41, 0, 254, 255, 47, 0, 248, 255, 53, 0, 242, 255, 59, 0, 236, 255, 65, 0, 230, 255, 71, 0, 224, 255, 77, 0, 218, 255,
+        83, 0, 212, 255, 89, 0, 206, 255, 95, 0, 200, 255, 101, 0, 194, 255, 107, 0, 188, 255, 113, 0, 182, 255, 119, 0, 176, 255, 125, 0, 170, 255,
+        130, 0, 164, 255, 136, 0, 158, 255, 142, 0, 152, 255, 148, 0, 146, 255, 154, 0, 140, 255, 160, 0, 134, 255, 166, 0, 128, 255, 172, 0, 123, 255,
+        178, 0, 117, 255, 184, 0, 111, 255, 190, 0, 105, 255, 196, 0, 99, 255, 202, 0, 93, 255, 208, 0, 87, 255, 214, 0, 81, 255, 220, 0, 75, 255,
+        226, 0, 69, 255, 232, 0, 63, 255, 238, 0, 57, 255, 244, 0, 51, 255, 250, 0, 45, 255, 255, 0, 39, 255, 255, 0, 33, 255, 255, 0, 27, 255,
+    },
+    // Jet
+    {
+        0, 0, 129, 255, 0, 0, 133, 255, 0, 0, 137, 255, 0, 0, 141, 255, 0, 0, 145, 255, 0, 0, 149, 255, 0, 0, 153, 255, 0, 0, 157, 255,
+        0, 0, 161, 255, 0, 0, 165, 255, 0, 0, 169, 255, 0, 0, 173, 255, 0, 0, 177, 255, 0, 0, 181, 255, 0, 0, 185, 255, 0, 0, 189, 255,
+        0, 0, 193, 255, 0, 0, 197, 255, 0, 0, 201, 255, 0, 0, 205, 255, 0, 0, 209, 255, 0, 0, 213, 255, 0, 0, 217, 255, 0, 0, 221, 255,
+        0, 0, 225, 255, 0, 0, 229, 255, 0, 0, 233, 255, 0, 0, 237, 255, 0, 0, 241, 255, 0, 0, 245, 255, 0, 0, 249, 255, 0, 0, 253, 255,
+        0, 2, 255, 255, 0, 6, 255, 255, 0, 10, 255, 255, 0, 14, 255, 255, 0, 18, 255, 255, 0, 22, 255, 255, 0, 26, 255, 255, 0, 30, 255, 255,
+        0, 34, 255, 255, 0, 38, 255, 255, 0, 42, 255, 255, 0, 46, 255, 255, 0, 50, 255, 255, 0, 54, 255, 255, 0, 58, 255, 255, 0, 62, 255, 255,
+        0, 66, 255, 255, 0, 70, 255, 255, 0, 74, 255, 255, 0, 78, 255, 255, 0, 82, 255, 255, 0, 86, 255, 255, 0, 90, 255, 255, 0, 94, 255, 255,
+        0, 98, 255, 255, 0, 102, 255, 255, 0, 106, 255, 255, 0, 110, 255, 255, 0, 114, 255, 255, 0, 118, 255, 255, 0, 122, 255, 255, 0, 126, 255, 255,
+        0, 129, 255, 255, 0, 133, 255, 255, 0, 137, 255, 255, 0, 141, 255, 255, 0, 145, 255, 255, 0, 149, 255, 255, 0, 153, 255, 255, 0, 157, 255, 255,
+        0, 161, 255, 255, 0, 165, 255, 255, 0, 169, 255, 255, 0, 173, 255, 255, 0, 177, 255, 255, 0, 181, 255, 255, 0, 185, 255, 255, 0, 189, 255, 255,
+        0, 193, 255, 255, 0, 197, 255, 255, 0, 201, 255, 255, 0, 205, 255, 255, 0, 209, 255, 255, 0, 213, 255, 255, 0, 217, 255, 255, 0, 221, 255, 255,
+        0, 225, 255, 255, 0, 229, 255, 255, 0, 233, 255, 255, 0, 237, 255, 255, 0, 241, 255, 255, 0, 245, 255, 255, 0, 249, 255, 255, 0, 253, 255, 255,
+        2, 255, 253, 255, 6, 255, 249, 255, 10, 255, 245, 255, 14, 255, 241, 255, 18, 255, 237, 255, 22, 255, 233, 255, 26, 255, 229, 255, 30, 255, 225, 255,
+        34, 255, 221, 255, 38, 255, 217, 255, 42, 255, 213, 255, 46, 255, 209, 255, 50, 255, 205, 255, 54, 255, 201, 255, 58, 255, 197, 255, 62, 255, 193, 255,
+        66, 255, 189, 255, 70, 255, 185, 255, 74, 255, 181, 255, 78, 255, 177, 255, 82, 255, 173, 255, 86, 255, 169, 255, 90, 255, 165, 255, 94, 255, 161, 255,
+        98, 255, 157, 255, 102, 255, 153, 255, 106, 255, 149, 255, 110, 255, 145, 255, 114, 255, 141, 255, 118, 255, 137, 255, 122, 255, 133, 255, 126, 255, 129, 255,
+        129, 255, 126, 255, 133, 255, 122, 255, 137, 255, 118, 255, 141, 255, 114, 255, 145, 255, 110, 255, 149, 255, 106, 255, 153, 255, 102, 255, 157, 255, 98, 255,
+        161, 255, 94, 255, 165, 255, 90, 255, 169, 255, 86, 255, 173, 255, 82, 255, 177, 255, 78, 255, 181, 255, 74, 255, 185, 255, 70, 255, 189, 255, 66, 255,
+        193, 255, 62, 255, 197, 255, 58, 255, 201, 255, 54, 255, 205, 255, 50, 255, 209, 255, 46, 255, 213, 255, 42, 255, 217, 255, 38, 255, 221, 255, 34, 255,
+        225, 255, 30, 255, 229, 255, 26, 255, 233, 255, 22, 255, 237, 255, 18, 255, 241, 255, 14, 255, 245, 255, 10, 255, 249, 255, 6, 255, 253, 255, 2, 255,
+        255, 253, 0, 255, 255, 249, 0, 255, 255, 245, 0, 255, 255, 241, 0, 255, 255, 237, 0, 255, 255, 233, 0, 255, 255, 229, 0, 255, 255, 225, 0, 255,
+        255, 221, 0, 255, 255, 217, 0, 255, 255, 213, 0, 255, 255, 209, 0, 255, 255, 205, 0, 255, 255, 201, 0, 255, 255, 197, 0, 255, 255, 193, 0, 255,
+        255, 189, 0, 255, 255, 185, 0, 255, 255, 181, 0, 255, 255, 177, 0, 255, 255, 173, 0, 255, 255, 169, 0, 255, 255, 165, 0, 255, 255, 161, 0, 255,
+        255, 157, 0, 255, 255, 153, 0, 255, 255, 149, 0, 255, 255, 145, 0, 255, 255, 141, 0, 255, 255, 137, 0, 255, 255, 133, 0, 255, 255, 129, 0, 255,
+        255, 126, 0, 255, 255, 122, 0, 255, 255, 118, 0, 255, 255, 114, 0, 255, 255, 110, 0, 255, 255, 106, 0, 255, 255, 102, 0, 255, 255, 98, 0, 255,
+        255, 94, 0, 255, 255, 90, 0, 255, 255, 86, 0, 255, 255, 82, 0, 255, 255, 78, 0, 255, 255, 74, 0, 255, 255, 70, 0, 255, 255, 66, 0, 255,
+        255, 62, 0, 255, 255, 58, 0, 255, 255, 54, 0, 255, 255, 50, 0, 255, 255, 46, 0, 255, 255, 42, 0, 255, 255, 38, 0, 255, 255, 34, 0, 255,
+        255, 30, 0, 255, 255, 26, 0, 255, 255, 22, 0, 255, 255, 18, 0, 255, 255, 14, 0, 255, 255, 10, 0, 255, 255, 6, 0, 255, 255, 2, 0, 255,
+        253, 0, 0, 255, 249, 0, 0, 255, 245, 0, 0, 255, 241, 0, 0, 255, 237, 0, 0, 255, 233, 0, 0, 255, 229, 0, 0, 255, 225, 0, 0, 255,
+        221, 0, 0, 255, 217, 0, 0, 255, 213, 0, 0, 255, 209, 0, 0, 255, 205, 0, 0, 255, 201, 0, 0, 255, 197, 0, 0, 255, 193, 0, 0, 255,
+        189, 0, 0, 255, 185, 0, 0, 255, 181, 0, 0, 255, 177, 0, 0, 255, 173, 0, 0, 255, 169, 0, 0, 255, 165, 0, 0, 255, 161, 0, 0, 255,
+        157, 0, 0, 255, 153, 0, 0, 255, 149, 0, 0, 255, 145, 0, 0, 255, 141, 0, 0, 255, 137, 0, 0, 255, 133, 0, 0, 255, 129, 0, 0, 255,
+    },
+    // Parula
+    {
+        52, 37, 124, 255, 52, 39, 127, 255, 53, 40, 130, 255, 53, 42, 133, 255, 53, 43, 136, 255, 53, 45, 140, 255, 54, 46, 143, 255, 54, 48, 146, 255,
+        54, 49, 149, 255, 54, 51, 152, 255, 54, 52, 155, 255, 54, 54, 158, 255, 54, 55, 161, 255, 54, 57, 165, 255, 54, 58, 168, 255, 53, 60, 171, 255,
+        53, 62, 174, 255, 52, 63, 177, 255, 51, 65, 181, 255, 50, 67, 184, 255, 49, 68, 187, 255, 48, 70, 190, 255, 46, 72, 194, 255, 45, 74, 197, 255,
+        42, 75, 200, 255, 40, 77, 204, 255, 37, 79, 207, 255, 34, 82, 210, 255, 30, 84, 213, 255, 26, 86, 216, 255, 21, 88, 218, 255, 17, 91, 221, 255,
+        13, 93, 222, 255, 9, 95, 223, 255, 6, 96, 224, 255, 4, 98, 225, 255, 2, 100, 225, 255, 1, 101, 225, 255, 1, 102, 225, 255, 1, 104, 225, 255,
+        2, 105, 225, 255, 2, 106, 225, 255, 3, 107, 225, 255, 4, 108, 224, 255, 5, 109, 224, 255, 6, 110, 223, 255, 7, 111, 223, 255, 8, 112, 223, 255,
+        9, 113, 222, 255, 10, 114, 222, 255, 11, 115, 221, 255, 12, 116, 221, 255, 13, 117, 220, 255, 14, 118, 220, 255, 15, 119, 219, 255, 16, 120, 218, 255,
+        16, 121, 218, 255, 17, 122, 217, 255, 18, 123, 217, 255, 18, 124, 216, 255, 19, 125, 216, 255, 19, 126, 215, 255, 19, 127, 215, 255, 20, 128, 214, 255,
+        20, 129, 214, 255, 20, 130, 213, 255, 20, 131, 213, 255, 20, 132, 212, 255, 20, 133, 212, 255, 20, 134, 211, 255, 20, 135, 211, 255, 19, 136, 211, 255,
+        19, 138, 211, 255, 18, 139, 210, 255, 18, 140, 210, 255, 17, 141, 210, 255, 16, 143, 210, 255, 15, 144, 210, 255, 14, 145, 210, 255, 13, 147, 210, 255,
+        12, 148, 210, 255, 11, 149, 210, 255, 10, 150, 209, 255, 9, 152, 209, 255, 8, 153, 209, 255, 8, 154, 209, 255, 7, 155, 208, 255, 7, 156, 208, 255,
+        7, 157, 207, 255, 6, 158, 207, 255, 6, 159, 206, 255, 6, 160, 205, 255, 6, 161, 205, 255, 6, 162, 204, 255, 6, 162, 203, 255, 6, 163, 202, 255,
+        6, 164, 201, 255, 6, 165, 200, 255, 6, 166, 200, 255, 6, 166, 199, 255, 6, 167, 198, 255, 6, 168, 197, 255, 6, 168, 196, 255, 7, 169, 195, 255,
+        7, 170, 193, 255, 8, 170, 192, 255, 8, 171, 191, 255, 9, 172, 190, 255, 10, 172, 189, 255, 12, 173, 188, 255, 13, 173, 187, 255, 14, 174, 186, 255,
+        16, 175, 184, 255, 17, 175, 183, 255, 19, 176, 182, 255, 21, 176, 181, 255, 22, 177, 179, 255, 24, 178, 178, 255, 26, 178, 177, 255, 28, 179, 176, 255,
+        30, 179, 174, 255, 32, 180, 173, 255, 34, 180, 172, 255, 36, 181, 170, 255, 38, 181, 169, 255, 40, 182, 167, 255, 43, 182, 166, 255, 45, 183, 165, 255,
+        47, 183, 163, 255, 49, 184, 162, 255, 52, 184, 160, 255, 54, 185, 159, 255, 57, 185, 157, 255, 59, 186, 156, 255, 62, 186, 154, 255, 65, 186, 153, 255,
+        67, 187, 151, 255, 70, 187, 150, 255, 73, 188, 148, 255, 76, 188, 146, 255, 78, 188, 145, 255, 81, 189, 143, 255, 84, 189, 142, 255, 87, 189, 140, 255,
+        90, 189, 139, 255, 93, 190, 137, 255, 96, 190, 136, 255, 99, 190, 134, 255, 102, 190, 133, 255, 105, 190, 132, 255, 108, 191, 130, 255, 111, 191, 129, 255,
+        114, 191, 128, 255, 117, 191, 126, 255, 120, 191, 125, 255, 123, 191, 124, 255, 126, 191, 123, 255, 128, 191, 122, 255, 131, 191, 121, 255, 134, 191, 119, 255,
+        136, 191, 118, 255, 139, 191, 117, 255, 142, 191, 116, 255, 144, 191, 115, 255, 147, 191, 114, 255, 149, 191, 113, 255, 152, 191, 112, 255, 154, 191, 111, 255,
+        157, 191, 110, 255, 159, 190, 109, 255, 162, 190, 108, 255, 164, 190, 107, 255, 166, 190, 106, 255, 169, 190, 105, 255, 171, 190, 104, 255, 173, 190, 104, 255,
+        175, 190, 103, 255, 178, 189, 102, 255, 180, 189, 101, 255, 182, 189, 100, 255, 184, 189, 99, 255, 186, 189, 98, 255, 189, 189, 97, 255, 191, 188, 97, 255,
+        193, 188, 96, 255, 195, 188, 95, 255, 197, 188, 94, 255, 199, 188, 93, 255, 201, 187, 92, 255, 204, 187, 91, 255, 206, 187, 90, 255, 208, 187, 90, 255,
+        210, 187, 89, 255, 212, 187, 88, 255, 214, 186, 87, 255, 216, 186, 86, 255, 218, 186, 85, 255, 220, 186, 84, 255, 222, 186, 83, 255, 224, 186, 83, 255,
+        226, 185, 82, 255, 228, 185, 81, 255, 230, 185, 80, 255, 232, 185, 79, 255, 234, 185, 78, 255, 236, 185, 77, 255, 238, 185, 75, 255, 240, 185, 74, 255,
+        242, 185, 73, 255, 244, 185, 72, 255, 246, 186, 70, 255, 247, 186, 69, 255, 249, 187, 67, 255, 251, 188, 66, 255, 252, 189, 64, 255, 253, 190, 62, 255,
+        254, 191, 60, 255, 254, 192, 59, 255, 255, 193, 57, 255, 255, 194, 56, 255, 255, 196, 55, 255, 255, 197, 53, 255, 254, 198, 52, 255, 254, 200, 51, 255,
+        254, 201, 50, 255, 253, 202, 48, 255, 253, 204, 47, 255, 252, 205, 46, 255, 252, 206, 45, 255, 251, 208, 44, 255, 251, 209, 43, 255, 250, 210, 42, 255,
+        249, 212, 41, 255, 249, 213, 40, 255, 248, 214, 39, 255, 248, 216, 38, 255, 247, 217, 37, 255, 247, 218, 36, 255, 246, 220, 35, 255, 246, 221, 34, 255,
+        245, 223, 33, 255, 245, 224, 32, 255, 245, 226, 31, 255, 245, 227, 29, 255, 244, 229, 28, 255, 244, 231, 27, 255, 245, 232, 26, 255, 245, 234, 25, 255,
+        245, 236, 24, 255, 245, 238, 22, 255, 246, 240, 21, 255, 246, 242, 20, 255, 247, 244, 19, 255, 247, 246, 17, 255, 248, 248, 16, 255, 249, 250, 14, 255,
+    },
+    // Pink
+    {
+        12, 0, 0, 255, 17, 0, 0, 255, 22, 0, 0, 255, 27, 0, 0, 255, 33, 4, 4, 255, 38, 11, 11, 255, 43, 18, 18, 255, 48, 24, 24, 255,
+        52, 28, 28, 255, 56, 32, 32, 255, 59, 34, 34, 255, 62, 36, 36, 255, 65, 38, 38, 255, 68, 40, 40, 255, 71, 42, 42, 255, 74, 44, 44, 255,
+        77, 46, 46, 255, 79, 48, 48, 255, 82, 50, 50, 255, 84, 52, 52, 255, 86, 53, 53, 255, 89, 55, 55, 255, 91, 56, 56, 255, 93, 58, 58, 255,
+        95, 59, 59, 255, 97, 61, 61, 255, 99, 62, 62, 255, 101, 64, 64, 255, 103, 65, 65, 255, 105, 66, 66, 255, 107, 68, 68, 255, 109, 69, 69, 255,
+        111, 70, 70, 255, 112, 71, 71, 255, 114, 72, 72, 255, 116, 74, 74, 255, 118, 75, 75, 255, 119, 76, 76, 255, 121, 77, 77, 255, 123, 78, 78, 255,
+        124, 79, 79, 255, 126, 80, 80, 255, 127, 81, 81, 255, 129, 82, 82, 255, 130, 83, 83, 255, 132, 84, 84, 255, 133, 86, 86, 255, 135, 87, 87, 255,
+        136, 87, 87, 255, 138, 88, 88, 255, 139, 89, 89, 255, 141, 90, 90, 255, 142, 91, 91, 255, 144, 92, 92, 255, 145, 93, 93, 255, 146, 94, 94, 255,
+        148, 95, 95, 255, 149, 96, 96, 255, 150, 97, 97, 255, 152, 98, 98, 255, 153, 99, 99, 255, 154, 99, 99, 255, 155, 100, 100, 255, 157, 101, 101, 255,
+        158, 102, 102, 255, 159, 103, 103, 255, 161, 104, 104, 255, 162, 105, 105, 255, 163, 105, 105, 255, 164, 106, 106, 255, 165, 107, 107, 255, 167, 108, 108, 255,
+        168, 109, 109, 255, 169, 109, 109, 255, 170, 110, 110, 255, 171, 111, 111, 255, 172, 112, 112, 255, 174, 112, 112, 255, 175, 113, 113, 255, 176, 114, 114, 255,
+        177, 115, 115, 255, 178, 115, 115, 255, 179, 116, 116, 255, 180, 117, 117, 255, 181, 118, 118, 255, 183, 118, 118, 255, 184, 119, 119, 255, 185, 120, 120, 255,
+        186, 121, 121, 255, 187, 121, 121, 255, 188, 122, 122, 255, 189, 123, 123, 255, 190, 123, 123, 255, 191, 124, 124, 255, 192, 124, 125, 255, 193, 125, 125, 255,
+        194, 126, 126, 255, 195, 128, 127, 255, 195, 129, 128, 255, 195, 131, 128, 255, 196, 133, 129, 255, 196, 134, 130, 255, 196, 136, 130, 255, 197, 137, 131, 255,
+        197, 139, 131, 255, 198, 140, 132, 255, 198, 141, 133, 255, 199, 143, 133, 255, 199, 144, 134, 255, 200, 146, 135, 255, 200, 147, 135, 255, 200, 148, 136, 255,
+        201, 150, 137, 255, 201, 151, 137, 255, 202, 152, 138, 255, 202, 154, 138, 255, 203, 155, 139, 255, 203, 156, 140, 255, 203, 157, 140, 255, 204, 159, 141, 255,
+        204, 160, 142, 255, 205, 161, 142, 255, 205, 162, 143, 255, 205, 164, 143, 255, 206, 165, 144, 255, 206, 166, 145, 255, 207, 167, 145, 255, 207, 168, 146, 255,
+        208, 170, 146, 255, 208, 171, 147, 255, 208, 172, 148, 255, 209, 173, 148, 255, 209, 174, 149, 255, 210, 175, 149, 255, 210, 176, 150, 255, 210, 178, 150, 255,
+        211, 179, 151, 255, 211, 180, 152, 255, 212, 181, 152, 255, 212, 182, 153, 255, 212, 183, 153, 255, 213, 184, 154, 255, 213, 185, 154, 255, 214, 186, 155, 255,
+        214, 187, 155, 255, 215, 188, 156, 255, 215, 190, 157, 255, 215, 191, 157, 255, 216, 192, 158, 255, 216, 193, 158, 255, 217, 194, 159, 255, 217, 195, 159, 255,
+        217, 196, 160, 255, 218, 197, 160, 255, 218, 198, 161, 255, 218, 199, 161, 255, 219, 200, 162, 255, 219, 201, 162, 255, 220, 202, 163, 255, 220, 203, 164, 255,
+        220, 204, 164, 255, 221, 205, 165, 255, 221, 206, 165, 255, 222, 207, 166, 255, 222, 208, 166, 255, 222, 209, 167, 255, 223, 209, 167, 255, 223, 210, 168, 255,
+        224, 211, 168, 255, 224, 212, 169, 255, 224, 213, 169, 255, 225, 214, 170, 255, 225, 215, 170, 255, 225, 216, 171, 255, 226, 217, 171, 255, 226, 218, 172, 255,
+        227, 219, 172, 255, 227, 220, 173, 255, 227, 221, 173, 255, 228, 221, 174, 255, 228, 222, 174, 255, 228, 223, 175, 255, 229, 224, 175, 255, 229, 225, 176, 255,
+        230, 226, 176, 255, 230, 227, 177, 255, 230, 228, 177, 255, 231, 229, 178, 255, 231, 229, 178, 255, 231, 230, 178, 255, 232, 231, 179, 255, 232, 232, 179, 255,
+        233, 233, 180, 255, 233, 233, 182, 255, 233, 233, 183, 255, 234, 234, 185, 255, 234, 234, 186, 255, 234, 234, 188, 255, 235, 235, 189, 255, 235, 235, 190, 255,
+        236, 236, 192, 255, 236, 236, 193, 255, 236, 236, 194, 255, 237, 237, 195, 255, 237, 237, 197, 255, 237, 237, 198, 255, 238, 238, 199, 255, 238, 238, 201, 255,
+        238, 238, 202, 255, 239, 239, 203, 255, 239, 239, 204, 255, 240, 240, 206, 255, 240, 240, 207, 255, 240, 240, 208, 255, 241, 241, 209, 255, 241, 241, 211, 255,
+        241, 241, 212, 255, 242, 242, 213, 255, 242, 242, 214, 255, 242, 242, 215, 255, 243, 243, 217, 255, 243, 243, 218, 255, 243, 243, 219, 255, 244, 244, 220, 255,
+        244, 244, 221, 255, 244, 244, 222, 255, 245, 245, 224, 255, 245, 245, 225, 255, 246, 246, 226, 255, 246, 246, 227, 255, 246, 246, 228, 255, 247, 247, 229, 255,
+        247, 247, 230, 255, 247, 247, 231, 255, 248, 248, 232, 255, 248, 248, 234, 255, 248, 248, 235, 255, 249, 249, 236, 255, 249, 249, 237, 255, 249, 249, 238, 255,
+        250, 250, 239, 255, 250, 250, 240, 255, 250, 250, 241, 255, 251, 251, 242, 255, 251, 251, 243, 255, 251, 251, 244, 255, 252, 252, 245, 255, 252, 252, 246, 255,
+        252, 252, 247, 255, 253, 253, 248, 255, 253, 253, 249, 255, 253, 253, 250, 255, 254, 254, 251, 255, 254, 254, 252, 255, 254, 254, 253, 255, 255, 255, 254, 255,
+    },
+    // Spring
+    {
+        255, 0, 255, 255, 255, 1, 254, 255, 255, 2, 253, 255, 255, 3, 252, 255, 255, 4, 251, 255, 255, 5, 250, 255, 255, 6, 249, 255, 255, 7, 248, 255,
+        255, 8, 247, 255, 255, 9, 246, 255, 255, 10, 245, 255, 255, 11, 244, 255, 255, 12, 243, 255, 255, 13, 242, 255, 255, 14, 241, 255, 255, 15, 240, 255,
+        255, 16, 239, 255, 255, 17, 238, 255, 255, 18, 237, 255, 255, 19, 236, 255, 255, 20, 235, 255, 255, 21, 234, 255, 255, 22, 233, 255, 255, 23, 232, 255,
+        255, 24, 231, 255, 255, 25, 230, 255, 255, 26, 229, 255, 255, 27, 228, 255, 255, 28, 227, 255, 255, 29, 226, 255, 255, 30, 225, 255, 255, 31, 224, 255,
+        255, 32, 223, 255, 255, 33, 222, 255, 255, 34, 221, 255, 255, 35, 220, 255, 255, 36, 219, 255, 255, 37, 218, 255, 255, 38, 217, 255, 255, 39, 216, 255,
+        255, 40, 215, 255, 255, 41, 214, 255, 255, 42, 213, 255, 255, 43, 212, 255, 255, 44, 211, 255, 255, 45, 210, 255, 255, 46, 209, 255, 255, 47, 208, 255,
+        255, 48, 207, 255, 255, 49, 206, 255, 255, 50, 205, 255, 255, 51, 204, 255, 255, 52, 203, 255, 255, 53, 202, 255, 255, 54, 201, 255, 255, 55, 200, 255,
+        255, 56, 199, 255, 255, 57, 198, 255, 255, 58, 197, 255, 255, 59, 196, 255, 255, 60, 195, 255, 255, 61, 194, 255, 255, 62, 193, 255, 255, 63, 192, 255,
+        255, 64, 191, 255, 255, 65, 190, 255, 255, 66, 189, 255, 255, 67, 188, 255, 255, 68, 187, 255, 255, 69, 186, 255, 255, 70, 185, 255, 255, 71, 184, 255,
+        255, 72, 183, 255, 255, 73, 182, 255, 255, 74, 181, 255, 255, 75, 180, 255, 255, 76, 179, 255, 255, 77, 178, 255, 255, 78, 177, 255, 255, 79, 176, 255,
+        255, 80, 175, 255, 255, 81, 174, 255, 255, 82, 173, 255, 255, 83, 172, 255, 255, 84, 171, 255, 255, 85, 170, 255, 255, 86, 169, 255, 255, 87, 168, 255,
+        255, 88, 167, 255, 255, 89, 166, 255, 255, 90, 165, 255, 255, 91, 164, 255, 255, 92, 163, 255, 255, 93, 162, 255, 255, 94, 161, 255, 255, 95, 160, 255,
+        255, 96, 159, 255, 255, 97, 158, 255, 255, 98, 157, 255, 255, 99, 156, 255, 255, 100, 155, 255, 255, 101, 154, 255, 255, 102, 153, 255, 255, 103, 152, 255,
+        255, 104, 151, 255, 255, 105, 150, 255, 255, 106, 149, 255, 255, 107, 148, 255, 255, 108, 147, 255, 255, 109, 146, 255, 255, 110, 145, 255, 255, 111, 144, 255,
+        255, 112, 143, 255, 255, 113, 142, 255, 255, 114, 141, 255, 255, 115, 140, 255, 255, 116, 139, 255, 255, 117, 138, 255, 255, 118, 137, 255, 255, 119, 136, 255,
+        255, 120, 135, 255, 255, 121, 134, 255, 255, 122, 133, 255, 255, 123, 132, 255, 255, 124, 131, 255, 255, 125, 130, 255, 255, 126, 129, 255, 255, 127, 128, 255,
+        255, 128, 127, 255, 255, 129, 126, 255, 255, 130, 125, 255, 255, 131, 124, 255, 255, 132, 123, 255, 255, 133, 122, 255, 255, 134, 121, 255, 255, 135, 120, 255,
+        255, 136, 119, 255, 255, 137, 118, 255, 255, 138, 117, 255, 255, 139, 116, 255, 255, 140, 115, 255, 255, 141, 114, 255, 255, 142, 113, 255, 255, 143, 112, 255,
+        255, 144, 111, 255, 255, 145, 110, 255, 255, 146, 109, 255, 255, 147, 108, 255, 255, 148, 107, 255, 255, 149, 106, 255, 255, 150, 105, 255, 255, 151, 104, 255,
+        255, 152, 103, 255, 255, 153, 102, 255, 255, 154, 101, 255, 255, 155, 100, 255, 255, 156, 99, 255, 255, 157, 98, 255, 255, 158, 97, 255, 255, 159, 96, 255,
+        255, 160, 95, 255, 255, 161, 94, 255, 255, 162, 93, 255, 255, 163, 92, 255, 255, 164, 91, 255, 255, 165, 90, 255, 255, 166, 89, 255, 255, 167, 88, 255,
+        255, 168, 87, 255, 255, 169, 86, 255, 255, 170, 85, 255, 255, 171, 84, 255, 255, 172, 83, 255, 255, 173, 82, 255, 255, 174, 81, 255, 255, 175, 80, 255,
+        255, 176, 79, 255, 255, 177, 78, 255, 255, 178, 77, 255, 255, 179, 76, 255, 255, 180, 75, 255, 255, 181, 74, 255, 255, 182, 73, 255, 255, 183, 72, 255,
+        255, 184, 71, 255, 255, 185, 70, 255, 255, 186, 69, 255, 255, 187, 68, 255, 255, 188, 67, 255, 255, 189, 66, 255, 255, 190, 65, 255, 255, 191, 64, 255,
+        255, 192, 63, 255, 255, 193, 62, 255, 255, 194, 61, 255, 255, 195, 60, 255, 255, 196, 59, 255, 255, 197, 58, 255, 255, 198, 57, 255, 255, 199, 56, 255,
+        255, 200, 55, 255, 255, 201, 54, 255, 255, 202, 53, 255, 255, 203, 52, 255, 255, 204, 51, 255, 255, 205, 50, 255, 255, 206, 49, 255, 255, 207, 48, 255,
+        255, 208, 47, 255, 255, 209, 46, 255, 255, 210, 45, 255, 255, 211, 44, 255, 255, 212, 43, 255, 255, 213, 42, 255, 255, 214, 41, 255, 255, 215, 40, 255,
+        255, 216, 39, 255, 255, 217, 38, 255, 255, 218, 37, 255, 255, 219, 36, 255, 255, 220, 35, 255, 255, 221, 34, 255, 255, 222, 33, 255, 255, 223, 32, 255,
+        255, 224, 31, 255, 255, 225, 30, 255, 255, 226, 29, 255, 255, 227, 28, 255, 255, 228, 27, 255, 255, 229, 26, 255, 255, 230, 25, 255, 255, 231, 24, 255,
+        255, 232, 23, 255, 255, 233, 22, 255, 255, 234, 21, 255, 255, 235, 20, 255, 255, 236, 19, 255, 255, 237, 18, 255, 255, 238, 17, 255, 255, 239, 16, 255,
+        255, 240, 15, 255, 255, 241, 14, 255, 255, 242, 13, 255, 255, 243, 12, 255, 255, 244, 11, 255, 255, 245, 10, 255, 255, 246, 9, 255, 255, 247, 8, 255,
+        255, 248, 7, 255, 255, 249, 6, 255, 255, 250, 5, 255, 255, 251, 4, 255, 255, 252, 3, 255, 255, 253, 2, 255, 255, 254, 1, 255, 255, 255, 0, 255,
+    },
+    // Summer
+    {
+        0, 128, 102, 255, 1, 128, 102, 255, 2, 129, 102, 255, 3, 129, 102, 255, 4, 130, 102, 255, 5, 130, 102, 255, 6, 131, 102, 255, 7, 131, 102, 255,
+        8, 132, 102, 255, 9, 132, 102, 255, 10, 133, 102, 255, 11, 133, 102, 255, 12, 134, 102, 255, 13, 134, 102, 255, 14, 135, 102, 255, 15, 135, 102, 255,
+        16, 136, 102, 255, 17, 136, 102, 255, 18, 137, 102, 255, 19, 137, 102, 255, 20, 138, 102, 255, 21, 138, 102, 255, 22, 139, 102, 255, 23, 139, 102, 255,
+        24, 140, 102, 255, 25, 140, 102, 255, 26, 141, 102, 255, 27, 141, 102, 255, 28, 142, 102, 255, 29, 142, 102, 255, 30, 143, 102, 255, 31, 143, 102, 255,
+        32, 144, 102, 255, 33, 144, 102, 255, 34, 145, 102, 255, 35, 145, 102, 255, 36, 146, 102, 255, 37, 146, 102, 255, 38, 147, 102, 255, 39, 147, 102, 255,
+        40, 148, 102, 255, 41, 148, 102, 255, 42, 149, 102, 255, 43, 149, 102, 255, 44, 150, 102, 255, 45, 150, 102, 255, 46, 151, 102, 255, 47, 151, 102, 255,
+        48, 152, 102, 255, 49, 152, 102, 255, 50, 153, 102, 255, 51, 153, 102, 255, 52, 154, 102, 255, 53, 154, 102, 255, 54, 155, 102, 255, 55, 155, 102, 255,
+        56, 156, 102, 255, 57, 156, 102, 255, 58, 157, 102, 255, 59, 157, 102, 255, 60, 158, 102, 255, 61, 158, 102, 255, 62, 159, 102, 255, 63, 159, 102, 255,
+        64, 160, 102, 255, 65, 160, 102, 255, 66, 161, 102, 255, 67, 161, 102, 255, 68, 162, 102, 255, 69, 162, 102, 255, 70, 163, 102, 255, 71, 163, 102, 255,
+        72, 164, 102, 255, 73, 164, 102, 255, 74, 165, 102, 255, 75, 165, 102, 255, 76, 166, 102, 255, 77, 166, 102, 255, 78, 167, 102, 255, 79, 167, 102, 255,
+        80, 168, 102, 255, 81, 168, 102, 255, 82, 169, 102, 255, 83, 169, 102, 255, 84, 170, 102, 255, 85, 170, 102, 255, 86, 171, 102, 255, 87, 171, 102, 255,
+        88, 172, 102, 255, 89, 172, 102, 255, 90, 173, 102, 255, 91, 173, 102, 255, 92, 174, 102, 255, 93, 174, 102, 255, 94, 175, 102, 255, 95, 175, 102, 255,
+        96, 176, 102, 255, 97, 176, 102, 255, 98, 177, 102, 255, 99, 177, 102, 255, 100, 178, 102, 255, 101, 178, 102, 255, 102, 179, 102, 255, 103, 179, 102, 255,
+        104, 180, 102, 255, 105, 180, 102, 255, 106, 181, 102, 255, 107, 181, 102, 255, 108, 182, 102, 255, 109, 182, 102, 255, 110, 183, 102, 255, 111, 183, 102, 255,
+        112, 184, 102, 255, 113, 184, 102, 255, 114, 185, 102, 255, 115, 185, 102, 255, 116, 186, 102, 255, 117, 186, 102, 255, 118, 187, 102, 255, 119, 187, 102, 255,
+        120, 188, 102, 255, 121, 188, 102, 255, 122, 189, 102, 255, 123, 189, 102, 255, 124, 190, 102, 255, 125, 190, 102, 255, 126, 191, 102, 255, 127, 191, 102, 255,
+        128, 191, 102, 255, 129, 192, 102, 255, 130, 192, 102, 255, 131, 193, 102, 255, 132, 193, 102, 255, 133, 194, 102, 255, 134, 194, 102, 255, 135, 195, 102, 255,
+        136, 195, 102, 255, 137, 196, 102, 255, 138, 196, 102, 255, 139, 197, 102, 255, 140, 197, 102, 255, 141, 198, 102, 255, 142, 198, 102, 255, 143, 199, 102, 255,
+        144, 199, 102, 255, 145, 200, 102, 255, 146, 200, 102, 255, 147, 201, 102, 255, 148, 201, 102, 255, 149, 202, 102, 255, 150, 202, 102, 255, 151, 203, 102, 255,
+        152, 203, 102, 255, 153, 204, 102, 255, 154, 204, 102, 255, 155, 205, 102, 255, 156, 205, 102, 255, 157, 206, 102, 255, 158, 206, 102, 255, 159, 207, 102, 255,
+        160, 207, 102, 255, 161, 208, 102, 255, 162, 208, 102, 255, 163, 209, 102, 255, 164, 209, 102, 255, 165, 210, 102, 255, 166, 210, 102, 255, 167, 211, 102, 255,
+        168, 211, 102, 255, 169, 212, 102, 255, 170, 212, 102, 255, 171, 213, 102, 255, 172, 213, 102, 255, 173, 214, 102, 255, 174, 214, 102, 255, 175, 215, 102, 255,
+        176, 215, 102, 255, 177, 216, 102, 255, 178, 216, 102, 255, 179, 217, 102, 255, 180, 217, 102, 255, 181, 218, 102, 255, 182, 218, 102, 255, 183, 219, 102, 255,
+        184, 219, 102, 255, 185, 220, 102, 255, 186, 220, 102, 255, 187, 221, 102, 255, 188, 221, 102, 255, 189, 222, 102, 255, 190, 222, 102, 255, 191, 223, 102, 255,
+        192, 223, 102, 255, 193, 224, 102, 255, 194, 224, 102, 255, 195, 225, 102, 255, 196, 225, 102, 255, 197, 226, 102, 255, 198, 226, 102, 255, 199, 227, 102, 255,
+        200, 227, 102, 255, 201, 228, 102, 255, 202, 228, 102, 255, 203, 229, 102, 255, 204, 229, 102, 255, 205, 230, 102, 255, 206, 230, 102, 255, 207, 231, 102, 255,
+        208, 231, 102, 255, 209, 232, 102, 255, 210, 232, 102, 255, 211, 233, 102, 255, 212, 233, 102, 255, 213, 234, 102, 255, 214, 234, 102, 255, 215, 235, 102, 255,
+        216, 235, 102, 255, 217, 236, 102, 255, 218, 236, 102, 255, 219, 237, 102, 255, 220, 237, 102, 255, 221, 238, 102, 255, 222, 238, 102, 255, 223, 239, 102, 255,
+        224, 239, 102, 255, 225, 240, 102, 255, 226, 240, 102, 255, 227, 241, 102, 255, 228, 241, 102, 255, 229, 242, 102, 255, 230, 242, 102, 255, 231, 243, 102, 255,
+        232, 243, 102, 255, 233, 244, 102, 255, 234, 244, 102, 255, 235, 245, 102, 255, 236, 245, 102, 255, 237, 246, 102, 255, 238, 246, 102, 255, 239, 247, 102, 255,
+        240, 247, 102, 255, 241, 248, 102, 255, 242, 248, 102, 255, 243, 249, 102, 255, 244, 249, 102, 255, 245, 250, 102, 255, 246, 250, 102, 255, 247, 251, 102, 255,
+        248, 251, 102, 255, 249, 252, 102, 255, 250, 252, 102, 255, 251, 253, 102, 255, 252, 253, 102, 255, 253, 254, 102, 255, 254, 254, 102, 255, 255, 255, 102, 255,
+    },
+    // Winter
+    {
+        0, 0, 255, 255, 0, 1, 254, 255, 0, 2, 254, 255, 0, 3, 253, 255, 0, 4, 253, 255, 0, 5, 252, 255, 0, 6, 252, 255, 0, 7, 251, 255,
+        0, 8, 251, 255, 0, 9, 250, 255, 0, 10, 250, 255, 0, 11, 249, 255, 0, 12, 249, 255, 0, 13, 248, 255, 0, 14, 248, 255, 0, 15, 247, 255,
+        0, 16, 247, 255, 0, 17, 246, 255, 0, 18, 246, 255, 0, 19, 245, 255, 0, 20, 245, 255, 0, 21, 244, 255, 0, 22, 244, 255, 0, 23, 243, 255,
+        0, 24, 243, 255, 0, 25, 242, 255, 0, 26, 242, 255, 0, 27, 241, 255, 0, 28, 241, 255, 0, 29, 240, 255, 0, 30, 240, 255, 0, 31, 239, 255,
+        0, 32, 239, 255, 0, 33, 238, 255, 0, 34, 238, 255, 0, 35, 237, 255, 0, 36, 237, 255, 0, 37, 236, 255, 0, 38, 236, 255, 0, 39, 235, 255,
+        0, 40, 235, 255, 0, 41, 234, 255, 0, 42, 234, 255, 0, 43, 233, 255, 0, 44, 233, 255, 0, 45, 232, 255, 0, 46, 232, 255, 0, 47, 231, 255,
+        0, 48, 231, 255, 0, 49, 230, 255, 0, 50, 230, 255, 0, 51, 229, 255, 0, 52, 229, 255, 0, 53, 228, 255, 0, 54, 228, 255, 0, 55, 227, 255,
+        0, 56, 227, 255, 0, 57, 226, 255, 0, 58, 226, 255, 0, 59, 225, 255, 0, 60, 225, 255, 0, 61, 224, 255, 0, 62, 224, 255, 0, 63, 223, 255,
+        0, 64, 223, 255, 0, 65, 222, 255, 0, 66, 222, 255, 0, 67, 221, 255, 0, 68, 221, 255, 0, 69, 220, 255, 0, 70, 220, 255, 0, 71, 219, 255,
+        0, 72, 219, 255, 0, 73, 218, 255, 0, 74, 218, 255, 0, 75, 217, 255, 0, 76, 217, 255, 0, 77, 216, 255, 0, 78, 216, 255, 0, 79, 215, 255,
+        0, 80, 215, 255, 0, 81, 214, 255, 0, 82, 214, 255, 0, 83, 213, 255, 0, 84, 213, 255, 0, 85, 212, 255, 0, 86, 212, 255, 0, 87, 211, 255,
+        0, 88, 211, 255, 0, 89, 210, 255, 0, 90, 210, 255, 0, 91, 209, 255, 0, 92, 209, 255, 0, 93, 208, 255, 0, 94, 208, 255, 0, 95, 207, 255,
+        0, 96, 207, 255, 0, 97, 206, 255, 0, 98, 206, 255, 0, 99, 205, 255, 0, 100, 205, 255, 0, 101, 204, 255, 0, 102, 204, 255, 0, 103, 203, 255,
+        0, 104, 203, 255, 0, 105, 202, 255, 0, 106, 202, 255, 0, 107, 201, 255, 0, 108, 201, 255, 0, 109, 200, 255, 0, 110, 200, 255, 0, 111, 199, 255,
+        0, 112, 199, 255, 0, 113, 198, 255, 0, 114, 198, 255, 0, 115, 197, 255, 0, 116, 197, 255, 0, 117, 196, 255, 0, 118, 196, 255, 0, 119, 195, 255,
+        0, 120, 195, 255, 0, 121, 194, 255, 0, 122, 194, 255, 0, 123, 193, 255, 0, 124, 193, 255, 0, 125, 192, 255, 0, 126, 192, 255, 0, 127, 191, 255,
+        0, 128, 191, 255, 0, 129, 191, 255, 0, 130, 190, 255, 0, 131, 190, 255, 0, 132, 189, 255, 0, 133, 189, 255, 0, 134, 188, 255, 0, 135, 188, 255,
+        0, 136, 187, 255, 0, 137, 187, 255, 0, 138, 186, 255, 0, 139, 186, 255, 0, 140, 185, 255, 0, 141, 185, 255, 0, 142, 184, 255, 0, 143, 184, 255,
+        0, 144, 183, 255, 0, 145, 183, 255, 0, 146, 182, 255, 0, 147, 182, 255, 0, 148, 181, 255, 0, 149, 181, 255, 0, 150, 180, 255, 0, 151, 180, 255,
+        0, 152, 179, 255, 0, 153, 179, 255, 0, 154, 178, 255, 0, 155, 178, 255, 0, 156, 177, 255, 0, 157, 177, 255, 0, 158, 176, 255, 0, 159, 176, 255,
+        0, 160, 175, 255, 0, 161, 175, 255, 0, 162, 174, 255, 0, 163, 174, 255, 0, 164, 173, 255, 0, 165, 173, 255, 0, 166, 172, 255, 0, 167, 172, 255,
+        0, 168, 171, 255, 0, 169, 171, 255, 0, 170, 170, 255, 0, 171, 170, 255, 0, 172, 169, 255, 0, 173, 169, 255, 0, 174, 168, 255, 0, 175, 168, 255,
+        0, 176, 167, 255, 0, 177, 167, 255, 0, 178, 166, 255, 0, 179, 166, 255, 0, 180, 165, 255, 0, 181, 165, 255, 0, 182, 164, 255, 0, 183, 164, 255,
+        0, 184, 163, 255, 0, 185, 163, 255, 0, 186, 162, 255, 0, 187, 162, 255, 0, 188, 161, 255, 0, 189, 161, 255, 0, 190, 160, 255, 0, 191, 160, 255,
+        0, 192, 159, 255, 0, 193, 159, 255, 0, 194, 158, 255, 0, 195, 158, 255, 0, 196, 157, 255, 0, 197, 157, 255, 0, 198, 156, 255, 0, 199, 156, 255,
+        0, 200, 155, 255, 0, 201, 155, 255, 0, 202, 154, 255, 0, 203, 154, 255, 0, 204, 153, 255, 0, 205, 153, 255, 0, 206, 152, 255, 0, 207, 152, 255,
+        0, 208, 151, 255, 0, 209, 151, 255, 0, 210, 150, 255, 0, 211, 150, 255, 0, 212, 149, 255, 0, 213, 149, 255, 0, 214, 148, 255, 0, 215, 148, 255,
+        0, 216, 147, 255, 0, 217, 147, 255, 0, 218, 146, 255, 0, 219, 146, 255, 0, 220, 145, 255, 0, 221, 145, 255, 0, 222, 144, 255, 0, 223, 144, 255,
+        0, 224, 143, 255, 0, 225, 143, 255, 0, 226, 142, 255, 0, 227, 142, 255, 0, 228, 141, 255, 0, 229, 141, 255, 0, 230, 140, 255, 0, 231, 140, 255,
+        0, 232, 139, 255, 0, 233, 139, 255, 0, 234, 138, 255, 0, 235, 138, 255, 0, 236, 137, 255, 0, 237, 137, 255, 0, 238, 136, 255, 0, 239, 136, 255,
+        0, 240, 135, 255, 0, 241, 135, 255, 0, 242, 134, 255, 0, 243, 134, 255, 0, 244, 133, 255, 0, 245, 133, 255, 0, 246, 132, 255, 0, 247, 132, 255,
+        0, 248, 131, 255, 0, 249, 131, 255, 0, 250, 130, 255, 0, 251, 130, 255, 0, 252, 129, 255, 0, 253, 129, 255, 0, 254, 128, 255, 0, 255, 128, 255,
+    },
+    // Red
+    {
+        0, 0, 0, 255, 1, 0, 0, 255, 2, 0, 0, 255, 3, 0, 0, 255, 4, 0, 0, 255, 5, 0, 0, 255, 6, 0, 0, 255, 7, 0, 0, 255,
+        8, 0, 0, 255, 9, 0, 0, 255, 10, 0, 0, 255, 11, 0, 0, 255, 12, 0, 0, 255, 13, 0, 0, 255, 14, 0, 0, 255, 15, 0, 0, 255,
+        16, 0, 0, 255, 17, 0, 0, 255, 18, 0, 0, 255, 19, 0, 0, 255, 20, 0, 0, 255, 21, 0, 0, 255, 22, 0, 0, 255, 23, 0, 0, 255,
+        24, 0, 0, 255, 25, 0, 0, 255, 26, 0, 0, 255, 27, 0, 0, 255, 28, 0, 0, 255, 29, 0, 0, 255, 30, 0, 0, 255, 31, 0, 0, 255,
+        32, 0, 0, 255, 33, 0, 0, 255, 34, 0, 0, 255, 35, 0, 0, 255, 36, 0, 0, 255, 37, 0, 0, 255, 38, 0, 0, 255, 39, 0, 0, 255,
+        40, 0, 0, 255, 41, 0, 0, 255, 42, 0, 0, 255, 43, 0, 0, 255, 44, 0, 0, 255, 45, 0, 0, 255, 46, 0, 0, 255, 47, 0, 0, 255,
+        48, 0, 0, 255, 49, 0, 0, 255, 50, 0, 0, 255, 51, 0, 0, 255, 52, 0, 0, 255, 53, 0, 0, 255, 54, 0, 0, 255, 55, 0, 0, 255,
+        56, 0, 0, 255, 57, 0, 0, 255, 58, 0, 0, 255, 59, 0, 0, 255, 60, 0, 0, 255, 61, 0, 0, 255, 62, 0, 0, 255, 63, 0, 0, 255,
+        64, 0, 0, 255, 65, 0, 0, 255, 66, 0, 0, 255, 67, 0, 0, 255, 68, 0, 0, 255, 69, 0, 0, 255, 70, 0, 0, 255, 71, 0, 0, 255,
+        72, 0, 0, 255, 73, 0, 0, 255, 74, 0, 0, 255, 75, 0, 0, 255, 76, 0, 0, 255, 77, 0, 0, 255, 78, 0, 0, 255, 79, 0, 0, 255,
+        80, 0, 0, 255, 81, 0, 0, 255, 82, 0, 0, 255, 83, 0, 0, 255, 84, 0, 0, 255, 85, 0, 0, 255, 86, 0, 0, 255, 87, 0, 0, 255,
+        88, 0, 0, 255, 89, 0, 0, 255, 90, 0, 0, 255, 91, 0, 0, 255, 92, 0, 0, 255, 93, 0, 0, 255, 94, 0, 0, 255, 95, 0, 0, 255,
+        96, 0, 0, 255, 97, 0, 0, 255, 98, 0, 0, 255, 99, 0, 0, 255, 100, 0, 0, 255, 101, 0, 0, 255, 102, 0, 0, 255, 103, 0, 0, 255,
+        104, 0, 0, 255, 105, 0, 0, 255, 106, 0, 0, 255, 107, 0, 0, 255, 108, 0, 0, 255, 109, 0, 0, 255, 110, 0, 0, 255, 111, 0, 0, 255,
+        112, 0, 0, 255, 113, 0, 0, 255, 114, 0, 0, 255, 115, 0, 0, 255, 116, 0, 0, 255, 117, 0, 0, 255, 118, 0, 0, 255, 119, 0, 0, 255,
+        120, 0, 0, 255, 121, 0, 0, 255, 122, 0, 0, 255, 123, 0, 0, 255, 124, 0, 0, 255, 125, 0, 0, 255, 126, 0, 0, 255, 127, 0, 0, 255,
+        128, 0, 0, 255, 129, 0, 0, 255, 130, 0, 0, 255, 131, 0, 0, 255, 132, 0, 0, 255, 133, 0, 0, 255, 134, 0, 0, 255, 135, 0, 0, 255,
+        136, 0, 0, 255, 137, 0, 0, 255, 138, 0, 0, 255, 139, 0, 0, 255, 140, 0, 0, 255, 141, 0, 0, 255, 142, 0, 0, 255, 143, 0, 0, 255,
+        144, 0, 0, 255, 145, 0, 0, 255, 146, 0, 0, 255, 147, 0, 0, 255, 148, 0, 0, 255, 149, 0, 0, 255, 150, 0, 0, 255, 151, 0, 0, 255,
+        152, 0, 0, 255, 153, 0, 0, 255, 154, 0, 0, 255, 155, 0, 0, 255, 156, 0, 0, 255, 157, 0, 0, 255, 158, 0, 0, 255, 159, 0, 0, 255,
+        160, 0, 0, 255, 161, 0, 0, 255, 162, 0, 0, 255, 163, 0, 0, 255, 164, 0, 0, 255, 165, 0, 0, 255, 166, 0, 0, 255, 167, 0, 0, 255,
+        168, 0, 0, 255, 169, 0, 0, 255, 170, 0, 0, 255, 171, 0, 0, 255, 172, 0, 0, 255, 173, 0, 0, 255, 174, 0, 0, 255, 175, 0, 0, 255,
+        176, 0, 0, 255, 177, 0, 0, 255, 178, 0, 0, 255, 179, 0, 0, 255, 180, 0, 0, 255, 181, 0, 0, 255, 182, 0, 0, 255, 183, 0, 0, 255,
+        184, 0, 0, 255, 185, 0, 0, 255, 186, 0, 0, 255, 187, 0, 0, 255, 188, 0, 0, 255, 189, 0, 0, 255, 190, 0, 0, 255, 191, 0, 0, 255,
+        192, 0, 0, 255, 193, 0, 0, 255, 194, 0, 0, 255, 195, 0, 0, 255, 196, 0, 0, 255, 197, 0, 0, 255, 198, 0, 0, 255, 199, 0, 0, 255,
+        200, 0, 0, 255, 201, 0, 0, 255, 202, 0, 0, 255, 203, 0, 0, 255, 204, 0, 0, 255, 205, 0, 0, 255, 206, 0, 0, 255, 207, 0, 0, 255,
+        208, 0, 0, 255, 209, 0, 0, 255, 210, 0, 0, 255, 211, 0, 0, 255, 212, 0, 0, 255, 213, 0, 0, 255, 214, 0, 0, 255, 215, 0, 0, 255,
+        216, 0, 0, 255, 217, 0, 0, 255, 218, 0, 0, 255, 219, 0, 0, 255, 220, 0, 0, 255, 221, 0, 0, 255, 222, 0, 0, 255, 223, 0, 0, 255,
+        224, 0, 0, 255, 225, 0, 0, 255, 226, 0, 0, 255, 227, 0, 0, 255, 228, 0, 0, 255, 229, 0, 0, 255, 230, 0, 0, 255, 231, 0, 0, 255,
+        232, 0, 0, 255, 233, 0, 0, 255, 234, 0, 0, 255, 235, 0, 0, 255, 236, 0, 0, 255, 237, 0, 0, 255, 238, 0, 0, 255, 239, 0, 0, 255,
+        240, 0, 0, 255, 241, 0, 0, 255, 242, 0, 0, 255, 243, 0, 0, 255, 244, 0, 0, 255, 245, 0, 0, 255, 246, 0, 0, 255, 247, 0, 0, 255,
+        248, 0, 0, 255, 249, 0, 0, 255, 250, 0, 0, 255, 251, 0, 0, 255, 252, 0, 0, 255, 253, 0, 0, 255, 254, 0, 0, 255, 255, 0, 0, 255,
+    },
+    // Green
+    {
+        0, 0, 0, 255, 0, 1, 0, 255, 0, 2, 0, 255, 0, 3, 0, 255, 0, 4, 0, 255, 0, 5, 0, 255, 0, 6, 0, 255, 0, 7, 0, 255,
+        0, 8, 0, 255, 0, 9, 0, 255, 0, 10, 0, 255, 0, 11, 0, 255, 0, 12, 0, 255, 0, 13, 0, 255, 0, 14, 0, 255, 0, 15, 0, 255,
+        0, 16, 0, 255, 0, 17, 0, 255, 0, 18, 0, 255, 0, 19, 0, 255, 0, 20, 0, 255, 0, 21, 0, 255, 0, 22, 0, 255, 0, 23, 0, 255,
+        0, 24, 0, 255, 0, 25, 0, 255, 0, 26, 0, 255, 0, 27, 0, 255, 0, 28, 0, 255, 0, 29, 0, 255, 0, 30, 0, 255, 0, 31, 0, 255,
+        0, 32, 0, 255, 0, 33, 0, 255, 0, 34, 0, 255, 0, 35, 0, 255, 0, 36, 0, 255, 0, 37, 0, 255, 0, 38, 0, 255, 0, 39, 0, 255,
+        0, 40, 0, 255, 0, 41, 0, 255, 0, 42, 0, 255, 0, 43, 0, 255, 0, 44, 0, 255, 0, 45, 0, 255, 0, 46, 0, 255, 0, 47, 0, 255,
+        0, 48, 0, 255, 0, 49, 0, 255, 0, 50, 0, 255, 0, 51, 0, 255, 0, 52, 0, 255, 0, 53, 0, 255, 0, 54, 0, 255, 0, 55, 0, 255,
+        0, 56, 0, 255, 0, 57, 0, 255, 0, 58, 0, 255, 0, 59, 0, 255, 0, 60, 0, 255, 0, 61, 0, 255, 0, 62, 0, 255, 0, 63, 0, 255,
+        0, 64, 0, 255, 0, 65, 0, 255, 0, 66, 0, 255, 0, 67, 0, 255, 0, 68, 0, 255, 0, 69, 0, 255, 0, 70, 0, 255, 0, 71, 0, 255,
+        0, 72, 0, 255, 0, 73, 0, 255, 0, 74, 0, 255, 0, 75, 0, 255, 0, 76, 0, 255, 0, 77, 0, 255, 0, 78, 0, 255, 0, 79, 0, 255,
+        0, 80, 0, 255, 0, 81, 0, 255, 0, 82, 0, 255, 0, 83, 0, 255, 0, 84, 0, 255, 0, 85, 0, 255, 0, 86, 0, 255, 0, 87, 0, 255,
+        0, 88, 0, 255, 0, 89, 0, 255, 0, 90, 0, 255, 0, 91, 0, 255, 0, 92, 0, 255, 0, 93, 0, 255, 0, 94, 0, 255, 0, 95, 0, 255,
+        0, 96, 0, 255, 0, 97, 0, 255, 0, 98, 0, 255, 0, 99, 0, 255, 0, 100, 0, 255, 0, 101, 0, 255, 0, 102, 0, 255, 0, 103, 0, 255,
+        0, 104, 0, 255, 0, 105, 0, 255, 0, 106, 0, 255, 0, 107, 0, 255, 0, 108, 0, 255, 0, 109, 0, 255, 0, 110, 0, 255, 0, 111, 0, 255,
+        0, 112, 0, 255, 0, 113, 0, 255, 0, 114, 0, 255, 0, 115, 0, 255, 0, 116, 0, 255, 0, 117, 0, 255, 0, 118, 0, 255, 0, 119, 0, 255,
+        0, 120, 0, 255, 0, 121, 0, 255, 0, 122, 0, 255, 0, 123, 0, 255, 0, 124, 0, 255, 0, 125, 0, 255, 0, 126, 0, 255, 0, 127, 0, 255,
+        0, 128, 0, 255, 0, 129, 0, 255, 0, 130, 0, 255, 0, 131, 0, 255, 0, 132, 0, 255, 0, 133, 0, 255, 0, 134, 0, 255, 0, 135, 0, 255,
+        0, 136, 0, 255, 0, 137, 0, 255, 0, 138, 0, 255, 0, 139, 0, 255, 0, 140, 0, 255, 0, 141, 0, 255, 0, 142, 0, 255, 0, 143, 0, 255,
+        0, 144, 0, 255, 0, 145, 0, 255, 0, 146, 0, 255, 0, 147, 0, 255, 0, 148, 0, 255, 0, 149, 0, 255, 0, 150, 0, 255, 0, 151, 0, 255,
+        0, 152, 0, 255, 0, 153, 0, 255, 0, 154, 0, 255, 0, 155, 0, 255, 0, 156, 0, 255, 0, 157, 0, 255, 0, 158, 0, 255, 0, 159, 0, 255,
+        0, 160, 0, 255, 0, 161, 0, 255, 0, 162, 0, 255, 0, 163, 0, 255, 0, 164, 0, 255, 0, 165, 0, 255, 0, 166, 0, 255, 0, 167, 0, 255,
+        0, 168, 0, 255, 0, 169, 0, 255, 0, 170, 0, 255, 0, 171, 0, 255, 0, 172, 0, 255, 0, 173, 0, 255, 0, 174, 0, 255, 0, 175, 0, 255,
+        0, 176, 0, 255, 0, 177, 0, 255, 0, 178, 0, 255, 0, 179, 0, 255, 0, 180, 0, 255, 0, 181, 0, 255, 0, 182, 0, 255, 0, 183, 0, 255,
+        0, 184, 0, 255, 0, 185, 0, 255, 0, 186, 0, 255, 0, 187, 0, 255, 0, 188, 0, 255, 0, 189, 0, 255, 0, 190, 0, 255, 0, 191, 0, 255,
+        0, 192, 0, 255, 0, 193, 0, 255, 0, 194, 0, 255, 0, 195, 0, 255, 0, 196, 0, 255, 0, 197, 0, 255, 0, 198, 0, 255, 0, 199, 0, 255,
+        0, 200, 0, 255, 0, 201, 0, 255, 0, 202, 0, 255, 0, 203, 0, 255, 0, 204, 0, 255, 0, 205, 0, 255, 0, 206, 0, 255, 0, 207, 0, 255,
+        0, 208, 0, 255, 0, 209, 0, 255, 0, 210, 0, 255, 0, 211, 0, 255, 0, 212, 0, 255, 0, 213, 0, 255, 0, 214, 0, 255, 0, 215, 0, 255,
+        0, 216, 0, 255, 0, 217, 0, 255, 0, 218, 0, 255, 0, 219, 0, 255, 0, 220, 0, 255, 0, 221, 0, 255, 0, 222, 0, 255, 0, 223, 0, 255,
+        0, 224, 0, 255, 0, 225, 0, 255, 0, 226, 0, 255, 0, 227, 0, 255, 0, 228, 0, 255, 0, 229, 0, 255, 0, 230, 0, 255, 0, 231, 0, 255,
+        0, 232, 0, 255, 0, 233, 0, 255, 0, 234, 0, 255, 0, 235, 0, 255, 0, 236, 0, 255, 0, 237, 0, 255, 0, 238, 0, 255, 0, 239, 0, 255,
+        0, 240, 0, 255, 0, 241, 0, 255, 0, 242, 0, 255, 0, 243, 0, 255, 0, 244, 0, 255, 0, 245, 0, 255, 0, 246, 0, 255, 0, 247, 0, 255,
+        0, 248, 0, 255, 0, 249, 0, 255, 0, 250, 0, 255, 0, 251, 0, 255, 0, 252, 0, 255, 0, 253, 0, 255, 0, 254, 0, 255, 0, 255, 0, 255,
+    },
+    // Blue
+    {
+        0, 0, 0, 255, 0, 0, 1, 255, 0, 0, 2, 255, 0, 0, 3, 255, 0, 0, 4, 255, 0, 0, 5, 255, 0, 0, 6, 255, 0, 0, 7, 255,
+        0, 0, 8, 255, 0, 0, 9, 255, 0, 0, 10, 255, 0, 0, 11, 255, 0, 0, 12, 255, 0, 0, 13, 255, 0, 0, 14, 255, 0, 0, 15, 255,
+        0, 0, 16, 255, 0, 0, 17, 255, 0, 0, 18, 255, 0, 0, 19, 255, 0, 0, 20, 255, 0, 0, 21, 255, 0, 0, 22, 255, 0, 0, 23, 255,
+        0, 0, 24, 255, 0, 0, 25, 255, 0, 0, 26, 255, 0, 0, 27, 255, 0, 0, 28, 255, 0, 0, 29, 255, 0, 0, 30, 255, 0, 0, 31, 255,
+        0, 0, 32, 255, 0, 0, 33, 255, 0, 0, 34, 255, 0, 0, 35, 255, 0, 0, 36, 255, 0, 0, 37, 255, 0, 0, 38, 255, 0, 0, 39, 255,
+        0, 0, 40, 255, 0, 0, 41, 255, 0, 0, 42, 255, 0, 0, 43, 255, 0, 0, 44, 255, 0, 0, 45, 255, 0, 0, 46, 255, 0, 0, 47, 255,
+        0, 0, 48, 255, 0, 0, 49, 255, 0, 0, 50, 255, 0, 0, 51, 255, 0, 0, 52, 255, 0, 0, 53, 255, 0, 0, 54, 255, 0, 0, 55, 255,
+        0, 0, 56, 255, 0, 0, 57, 255, 0, 0, 58, 255, 0, 0, 59, 255, 0, 0, 60, 255, 0, 0, 61, 255, 0, 0, 62, 255, 0, 0, 63, 255,
+        0, 0, 64, 255, 0, 0, 65, 255, 0, 0, 66, 255, 0, 0, 67, 255, 0, 0, 68, 255, 0, 0, 69, 255, 0, 0, 70, 255, 0, 0, 71, 255,
+        0, 0, 72, 255, 0, 0, 73, 255, 0, 0, 74, 255, 0, 0, 75, 255, 0, 0, 76, 255, 0, 0, 77, 255, 0, 0, 78, 255, 0, 0, 79, 255,
+        0, 0, 80, 255, 0, 0, 81, 255, 0, 0, 82, 255, 0, 0, 83, 255, 0, 0, 84, 255, 0, 0, 85, 255, 0, 0, 86, 255, 0, 0, 87, 255,
+        0, 0, 88, 255, 0, 0, 89, 255, 0, 0, 90, 255, 0, 0, 91, 255, 0, 0, 92, 255, 0, 0, 93, 255, 0, 0, 94, 255, 0, 0, 95, 255,
+        0, 0, 96, 255, 0, 0, 97, 255, 0, 0, 98, 255, 0, 0, 99, 255, 0, 0, 100, 255, 0, 0, 101, 255, 0, 0, 102, 255, 0, 0, 103, 255,
+        0, 0, 104, 255, 0, 0, 105, 255, 0, 0, 106, 255, 0, 0, 107, 255, 0, 0, 108, 255, 0, 0, 109, 255, 0, 0, 110, 255, 0, 0, 111, 255,
+        0, 0, 112, 255, 0, 0, 113, 255, 0, 0, 114, 255, 0, 0, 115, 255, 0, 0, 116, 255, 0, 0, 117, 255, 0, 0, 118, 255, 0, 0, 119, 255,
+        0, 0, 120, 255, 0, 0, 121, 255, 0, 0, 122, 255, 0, 0, 123, 255, 0, 0, 124, 255, 0, 0, 125, 255, 0, 0, 126, 255, 0, 0, 127, 255,
+        0, 0, 128, 255, 0, 0, 129, 255, 0, 0, 130, 255, 0, 0, 131, 255, 0, 0, 132, 255, 0, 0, 133, 255, 0, 0, 134, 255, 0, 0, 135, 255,
+        0, 0, 136, 255, 0, 0, 137, 255, 0, 0, 138, 255, 0, 0, 139, 255, 0, 0, 140, 255, 0, 0, 141, 255, 0, 0, 142, 255, 0, 0, 143, 255,
+        0, 0, 144, 255, 0, 0, 145, 255, 0, 0, 146, 255, 0, 0, 147, 255, 0, 0, 148, 255, 0, 0, 149, 255, 0, 0, 150, 255, 0, 0, 151, 255,
+        0, 0, 152, 255, 0, 0, 153, 255, 0, 0, 154, 255, 0, 0, 155, 255, 0, 0, 156, 255, 0, 0, 157, 255, 0, 0, 158, 255, 0, 0, 159, 255,
+        0, 0, 160, 255, 0, 0, 161, 255, 0, 0, 162, 255, 0, 0, 163, 255, 0, 0, 164, 255, 0, 0, 165, 255, 0, 0, 166, 255, 0, 0, 167, 255,
+        0, 0, 168, 255, 0, 0, 169, 255, 0, 0, 170, 255, 0, 0, 171, 255, 0, 0, 172, 255, 0, 0, 173, 255, 0, 0, 174, 255, 0, 0, 175, 255,
+        0, 0, 176, 255, 0, 0, 177, 255, 0, 0, 178, 255, 0, 0, 179, 255, 0, 0, 180, 255, 0, 0, 181, 255, 0, 0, 182, 255, 0, 0, 183, 255,
+        0, 0, 184, 255, 0, 0, 185, 255, 0, 0, 186, 255, 0, 0, 187, 255, 0, 0, 188, 255, 0, 0, 189, 255, 0, 0, 190, 255, 0, 0, 191, 255,
+        0, 0, 192, 255, 0, 0, 193, 255, 0, 0, 194, 255, 0, 0, 195, 255, 0, 0, 196, 255, 0, 0, 197, 255, 0, 0, 198, 255, 0, 0, 199, 255,
+        0, 0, 200, 255, 0, 0, 201, 255, 0, 0, 202, 255, 0, 0, 203, 255, 0, 0, 204, 255, 0, 0, 205, 255, 0, 0, 206, 255, 0, 0, 207, 255,
+        0, 0, 208, 255, 0, 0, 209, 255, 0, 0, 210, 255, 0, 0, 211, 255, 0, 0, 212, 255, 0, 0, 213, 255, 0, 0, 214, 255, 0, 0, 215, 255,
+        0, 0, 216, 255, 0, 0, 217, 255, 0, 0, 218, 255, 0, 0, 219, 255, 0, 0, 220, 255, 0, 0, 221, 255, 0, 0, 222, 255, 0, 0, 223, 255,
+        0, 0, 224, 255, 0, 0, 225, 255, 0, 0, 226, 255, 0, 0, 227, 255, 0, 0, 228, 255, 0, 0, 229, 255, 0, 0, 230, 255, 0, 0, 231, 255,
+        0, 0, 232, 255, 0, 0, 233, 255, 0, 0, 234, 255, 0, 0, 235, 255, 0, 0, 236, 255, 0, 0, 237, 255, 0, 0, 238, 255, 0, 0, 239, 255,
+        0, 0, 240, 255, 0, 0, 241, 255, 0, 0, 242, 255, 0, 0, 243, 255, 0, 0, 244, 255, 0, 0, 245, 255, 0, 0, 246, 255, 0, 0, 247, 255,
+        0, 0, 248, 255, 0, 0, 249, 255, 0, 0, 250, 255, 0, 0, 251, 255, 0, 0, 252, 255, 0, 0, 253, 255, 0, 0, 254, 255, 0, 0, 255, 255,
+    },
+    // RedWhite
+    {
+        255, 242, 237, 255, 255, 242, 236, 255, 255, 241, 235, 255, 255, 241, 235, 255, 255, 241, 234, 255, 255, 240, 233, 255, 255, 240, 232, 255, 255, 239, 231, 255,
+        255, 239, 231, 255, 255, 238, 230, 255, 255, 238, 229, 255, 255, 237, 228, 255, 255, 237, 227, 255, 255, 236, 226, 255, 255, 235, 225, 255, 255, 235, 224, 255,
+        254, 234, 223, 255, 254, 233, 222, 255, 254, 232, 221, 255, 254, 232, 220, 255, 254, 231, 219, 255, 254, 230, 217, 255, 254, 229, 216, 255, 254, 228, 215, 255,
+        254, 227, 214, 255, 254, 226, 213, 255, 254, 225, 212, 255, 254, 225, 210, 255, 254, 224, 209, 255, 254, 223, 208, 255, 254, 222, 207, 255, 254, 221, 205, 255,
+        254, 220, 204, 255, 253, 219, 203, 255, 253, 218, 201, 255, 253, 217, 200, 255, 253, 216, 199, 255, 253, 215, 197, 255, 253, 213, 196, 255, 253, 212, 195, 255,
+        253, 211, 193, 255, 253, 210, 192, 255, 253, 209, 190, 255, 253, 208, 189, 255, 253, 207, 188, 255, 253, 206, 186, 255, 253, 205, 185, 255, 253, 203, 183, 255,
+        253, 202, 182, 255, 253, 201, 180, 255, 253, 200, 179, 255, 252, 199, 178, 255, 252, 198, 176, 255, 252, 197, 175, 255, 252, 195, 173, 255, 252, 194, 172, 255,
+        252, 193, 170, 255, 252, 192, 169, 255, 252, 191, 167, 255, 252, 189, 166, 255, 252, 188, 164, 255, 252, 187, 163, 255, 252, 186, 161, 255, 252, 185, 160, 255,
+        252, 184, 158, 255, 252, 182, 157, 255, 252, 181, 155, 255, 252, 180, 154, 255, 252, 179, 152, 255, 252, 177, 151, 255, 252, 176, 149, 255, 252, 175, 148, 255,
+        252, 174, 146, 255, 252, 173, 145, 255, 252, 171, 143, 255, 252, 170, 142, 255, 252, 169, 140, 255, 252, 168, 139, 255, 252, 167, 137, 255, 252, 165, 136, 255,
+        252, 164, 135, 255, 252, 163, 133, 255, 252, 162, 132, 255, 252, 160, 130, 255, 252, 159, 129, 255, 252, 158, 127, 255, 252, 157, 126, 255, 252, 155, 124, 255,
+        252, 154, 123, 255, 252, 153, 122, 255, 252, 152, 120, 255, 252, 150, 119, 255, 252, 149, 117, 255, 252, 148, 116, 255, 252, 147, 115, 255, 252, 145, 113, 255,
+        252, 144, 112, 255, 252, 143, 110, 255, 252, 142, 109, 255, 252, 140, 108, 255, 252, 139, 106, 255, 252, 138, 105, 255, 252, 137, 104, 255, 252, 135, 102, 255,
+        252, 134, 101, 255, 252, 133, 100, 255, 252, 131, 99, 255, 252, 130, 97, 255, 252, 129, 96, 255, 252, 128, 95, 255, 252, 126, 94, 255, 252, 125, 92, 255,
+        252, 124, 91, 255, 252, 122, 90, 255, 252, 121, 89, 255, 252, 120, 87, 255, 252, 118, 86, 255, 252, 117, 85, 255, 251, 116, 84, 255, 251, 115, 83, 255,
+        251, 113, 82, 255, 251, 112, 80, 255, 251, 111, 79, 255, 251, 109, 78, 255, 251, 108, 77, 255, 251, 107, 76, 255, 250, 105, 75, 255, 250, 104, 74, 255,
+        250, 103, 73, 255, 250, 101, 72, 255, 250, 100, 71, 255, 250, 99, 70, 255, 249, 97, 69, 255, 249, 96, 68, 255, 249, 94, 67, 255, 249, 93, 66, 255,
+        248, 92, 65, 255, 248, 90, 64, 255, 248, 89, 63, 255, 247, 88, 62, 255, 247, 86, 61, 255, 247, 85, 60, 255, 246, 84, 59, 255, 246, 82, 58, 255,
+        246, 81, 58, 255, 245, 79, 57, 255, 245, 78, 56, 255, 244, 77, 55, 255, 244, 75, 54, 255, 243, 74, 53, 255, 243, 73, 53, 255, 242, 71, 52, 255,
+        242, 70, 51, 255, 241, 69, 50, 255, 241, 67, 50, 255, 240, 66, 49, 255, 239, 65, 48, 255, 239, 63, 47, 255, 238, 62, 47, 255, 237, 61, 46, 255,
+        237, 59, 45, 255, 236, 58, 45, 255, 235, 57, 44, 255, 234, 55, 43, 255, 233, 54, 43, 255, 232, 53, 42, 255, 232, 52, 41, 255, 231, 50, 41, 255,
+        230, 49, 40, 255, 229, 48, 40, 255, 228, 47, 39, 255, 227, 45, 39, 255, 226, 44, 38, 255, 225, 43, 38, 255, 223, 42, 37, 255, 222, 41, 37, 255,
+        221, 40, 36, 255, 220, 39, 36, 255, 218, 37, 35, 255, 217, 36, 35, 255, 216, 35, 34, 255, 214, 34, 34, 255, 213, 33, 33, 255, 212, 32, 33, 255,
+        211, 31, 32, 255, 210, 30, 32, 255, 209, 30, 32, 255, 208, 29, 31, 255, 207, 28, 31, 255, 206, 27, 30, 255, 205, 26, 30, 255, 204, 25, 30, 255,
+        203, 25, 29, 255, 202, 24, 29, 255, 201, 23, 29, 255, 200, 23, 28, 255, 199, 22, 28, 255, 198, 22, 28, 255, 196, 22, 27, 255, 195, 22, 27, 255,
+        194, 21, 27, 255, 193, 21, 27, 255, 192, 21, 26, 255, 191, 21, 26, 255, 190, 21, 26, 255, 188, 20, 25, 255, 187, 20, 25, 255, 186, 20, 25, 255,
+        185, 20, 25, 255, 183, 19, 24, 255, 182, 19, 24, 255, 181, 19, 24, 255, 180, 18, 24, 255, 178, 18, 24, 255, 177, 18, 23, 255, 176, 18, 23, 255,
+        174, 17, 23, 255, 173, 17, 23, 255, 172, 17, 22, 255, 170, 16, 22, 255, 169, 16, 22, 255, 167, 16, 22, 255, 166, 15, 22, 255, 164, 15, 21, 255,
+        163, 15, 21, 255, 161, 14, 21, 255, 160, 14, 21, 255, 158, 13, 21, 255, 157, 13, 20, 255, 155, 13, 20, 255, 153, 12, 20, 255, 152, 12, 20, 255,
+        150, 11, 20, 255, 148, 11, 19, 255, 147, 11, 19, 255, 145, 10, 19, 255, 143, 10, 19, 255, 141, 9, 18, 255, 140, 9, 18, 255, 138, 8, 18, 255,
+        136, 8, 18, 255, 134, 7, 17, 255, 132, 7, 17, 255, 130, 6, 17, 255, 128, 6, 17, 255, 126, 5, 16, 255, 124, 5, 16, 255, 122, 4, 16, 255,
+        120, 4, 15, 255, 118, 3, 15, 255, 116, 3, 15, 255, 114, 2, 15, 255, 111, 2, 14, 255, 109, 1, 14, 255, 107, 1, 14, 255, 105, 0, 13, 255,
+    },
+    // GreenWhite
+    {
+        246, 252, 244, 255, 245, 252, 243, 255, 245, 252, 243, 255, 244, 251, 242, 255, 244, 251, 241, 255, 243, 251, 241, 255, 243, 251, 240, 255, 242, 251, 240, 255,
+        242, 250, 239, 255, 241, 250, 239, 255, 241, 250, 238, 255, 240, 250, 237, 255, 240, 250, 237, 255, 239, 249, 236, 255, 238, 249, 235, 255, 238, 249, 235, 255,
+        237, 249, 234, 255, 237, 248, 233, 255, 236, 248, 232, 255, 235, 248, 232, 255, 235, 248, 231, 255, 234, 247, 230, 255, 233, 247, 230, 255, 233, 247, 229, 255,
+        232, 246, 228, 255, 231, 246, 227, 255, 231, 246, 226, 255, 230, 246, 226, 255, 229, 245, 225, 255, 228, 245, 224, 255, 228, 245, 223, 255, 227, 244, 222, 255,
+        226, 244, 221, 255, 225, 244, 221, 255, 225, 243, 220, 255, 224, 243, 219, 255, 223, 243, 218, 255, 222, 242, 217, 255, 221, 242, 216, 255, 221, 242, 215, 255,
+        220, 241, 214, 255, 219, 241, 213, 255, 218, 241, 212, 255, 217, 240, 211, 255, 216, 240, 210, 255, 215, 240, 209, 255, 214, 239, 208, 255, 214, 239, 207, 255,
+        213, 239, 206, 255, 212, 238, 205, 255, 211, 238, 204, 255, 210, 237, 203, 255, 209, 237, 202, 255, 208, 237, 201, 255, 207, 236, 200, 255, 206, 236, 199, 255,
+        205, 235, 198, 255, 204, 235, 197, 255, 203, 235, 196, 255, 202, 234, 195, 255, 201, 234, 194, 255, 200, 233, 193, 255, 199, 233, 192, 255, 198, 232, 191, 255,
+        197, 232, 190, 255, 196, 231, 189, 255, 195, 231, 188, 255, 193, 231, 187, 255, 192, 230, 185, 255, 191, 230, 184, 255, 190, 229, 183, 255, 189, 229, 182, 255,
+        188, 228, 181, 255, 187, 228, 180, 255, 186, 227, 179, 255, 184, 227, 178, 255, 183, 226, 176, 255, 182, 226, 175, 255, 181, 225, 174, 255, 180, 225, 173, 255,
+        179, 224, 172, 255, 177, 224, 171, 255, 176, 223, 170, 255, 175, 223, 168, 255, 174, 222, 167, 255, 173, 222, 166, 255, 171, 221, 165, 255, 170, 221, 164, 255,
+        169, 220, 163, 255, 168, 219, 162, 255, 166, 219, 160, 255, 165, 218, 159, 255, 164, 218, 158, 255, 163, 217, 157, 255, 161, 217, 156, 255, 160, 216, 155, 255,
+        159, 215, 153, 255, 157, 215, 152, 255, 156, 214, 151, 255, 155, 214, 150, 255, 153, 213, 149, 255, 152, 213, 148, 255, 151, 212, 146, 255, 149, 211, 145, 255,
+        148, 211, 144, 255, 147, 210, 143, 255, 145, 209, 142, 255, 144, 209, 141, 255, 143, 208, 139, 255, 141, 208, 138, 255, 140, 207, 137, 255, 138, 206, 136, 255,
+        137, 206, 135, 255, 136, 205, 134, 255, 134, 204, 133, 255, 133, 204, 131, 255, 131, 203, 130, 255, 130, 202, 129, 255, 129, 202, 128, 255, 127, 201, 127, 255,
+        126, 200, 126, 255, 124, 200, 125, 255, 123, 199, 124, 255, 121, 198, 122, 255, 120, 198, 121, 255, 118, 197, 120, 255, 117, 196, 119, 255, 115, 195, 118, 255,
+        114, 195, 117, 255, 112, 194, 116, 255, 111, 193, 115, 255, 109, 193, 114, 255, 108, 192, 114, 255, 106, 191, 113, 255, 105, 190, 112, 255, 103, 190, 112, 255,
+        102, 189, 111, 255, 100, 188, 110, 255, 99, 187, 110, 255, 97, 187, 109, 255, 96, 186, 108, 255, 94, 185, 107, 255, 93, 184, 107, 255, 91, 184, 106, 255,
+        89, 183, 105, 255, 88, 182, 104, 255, 86, 181, 104, 255, 85, 180, 103, 255, 83, 180, 102, 255, 82, 179, 102, 255, 80, 178, 101, 255, 78, 177, 100, 255,
+        77, 176, 99, 255, 75, 176, 99, 255, 74, 175, 98, 255, 72, 174, 97, 255, 70, 173, 96, 255, 69, 172, 95, 255, 67, 171, 95, 255, 66, 171, 94, 255,
+        65, 170, 93, 255, 64, 169, 92, 255, 63, 168, 92, 255, 62, 167, 91, 255, 61, 166, 90, 255, 60, 165, 89, 255, 59, 165, 89, 255, 59, 164, 88, 255,
+        58, 163, 87, 255, 57, 162, 86, 255, 56, 161, 85, 255, 55, 160, 85, 255, 54, 159, 84, 255, 53, 158, 83, 255, 52, 157, 82, 255, 51, 157, 82, 255,
+        50, 156, 81, 255, 49, 155, 80, 255, 48, 154, 79, 255, 47, 153, 78, 255, 46, 152, 78, 255, 45, 151, 77, 255, 44, 150, 76, 255, 44, 149, 75, 255,
+        43, 148, 74, 255, 42, 147, 74, 255, 41, 146, 73, 255, 40, 145, 72, 255, 39, 144, 71, 255, 38, 143, 71, 255, 37, 142, 70, 255, 36, 141, 69, 255,
+        35, 140, 68, 255, 34, 139, 68, 255, 33, 138, 67, 255, 32, 137, 66, 255, 31, 136, 65, 255, 30, 135, 64, 255, 29, 134, 64, 255, 28, 133, 63, 255,
+        27, 132, 62, 255, 26, 131, 61, 255, 25, 130, 61, 255, 24, 129, 60, 255, 23, 128, 59, 255, 21, 127, 59, 255, 20, 126, 58, 255, 19, 125, 57, 255,
+        18, 124, 56, 255, 17, 123, 56, 255, 16, 122, 55, 255, 15, 121, 54, 255, 14, 120, 53, 255, 12, 119, 53, 255, 11, 118, 52, 255, 10, 117, 51, 255,
+        9, 116, 51, 255, 8, 115, 50, 255, 6, 113, 49, 255, 5, 112, 49, 255, 4, 111, 48, 255, 3, 110, 47, 255, 1, 109, 47, 255, 0, 108, 46, 255,
+        0, 107, 45, 255, 0, 106, 45, 255, 0, 105, 44, 255, 0, 103, 43, 255, 0, 102, 43, 255, 0, 101, 42, 255, 0, 100, 41, 255, 0, 99, 41, 255,
+        0, 98, 40, 255, 0, 97, 40, 255, 0, 95, 39, 255, 0, 94, 38, 255, 0, 93, 38, 255, 0, 92, 37, 255, 0, 91, 37, 255, 0, 90, 36, 255,
+        0, 88, 35, 255, 0, 87, 35, 255, 0, 86, 34, 255, 0, 85, 34, 255, 0, 84, 33, 255, 0, 82, 33, 255, 0, 81, 32, 255, 0, 80, 32, 255,
+        0, 79, 31, 255, 0, 78, 31, 255, 0, 76, 30, 255, 0, 75, 30, 255, 0, 74, 29, 255, 0, 73, 29, 255, 0, 71, 28, 255, 0, 70, 28, 255,
+    }
+};
+
+#endif // COLORMAPS_H
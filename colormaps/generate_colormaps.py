@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+"""Generates colormaps.h from the color map PNG files in this directory.
+
+Each PNG must be an 8-bit RGBA image that is 256 pixels wide and 1 pixel high. The order of the files must match the
+ColorMap enum in displayinfo.h. Run this script from the root of the repository after adding or changing a color map:
+
+    python3 colormaps/generate_colormaps.py > colormaps.h
+"""
+
+import os
+import struct
+import sys
+import zlib
+
+COLOR_MAPS = [
+    ('Autumn', 'MATLAB_autumn.png'),
+    ('Bone', 'MATLAB_bone.png'),
+    ('Cool', 'MATLAB_cool.png'),
+    ('Copper', 'MATLAB_copper.png'),
+    ('Gray', 'MATLAB_gray.png'),
+    ('Hot', 'MATLAB_hot.png'),
+    ('HSV', 'MATLAB_hsv.png'),
+    ('Jet', 'MATLAB_jet.png'),
+    ('Parula', 'MATLAB_parula.png'),
+    ('Pink', 'MATLAB_pink.png'),
+    ('Spring', 'MATLAB_spring.png'),
+    ('Summer', 'MATLAB_summer.png'),
+    ('Winter', 'MATLAB_winter.png'),
+    ('Red', 'red.png'),
+    ('Green', 'green.png'),
+    ('Blue', 'blue.png'),
+    ('RedWhite', 'redWhite.png'),
+    ('GreenWhite', 'greenWhite.png'),
+]
+
+WIDTH = 256
+
+
+def paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    return b if pb <= pc else c
+
+
+def read_png(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        sys.exit('%s is not a PNG file' % path)
+
+    pos = 8
+    idat = b''
+    while pos < len(data):
+        length, chunk_type = struct.unpack('>I4s', data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+
+        if chunk_type == b'IHDR':
+            width, height, depth, color_type, _, _, interlace = struct.unpack('>IIBBBBB', chunk)
+            if (width, height, depth, color_type, interlace) != (WIDTH, 1, 8, 6, 0):
+                sys.exit('%s must be a %dx1 8-bit RGBA non-interlaced image' % (path, WIDTH))
+        elif chunk_type == b'IDAT':
+            idat += chunk
+
+    raw = zlib.decompress(idat)
+    filter_type, row = raw[0], bytearray(raw[1:])
+
+    # There is only one row so the prior row is all zeros for the Up, Average and Paeth filters
+    for i in range(len(row)):
+        left = row[i - 4] if i >= 4 else 0
+        if filter_type == 1:
+            row[i] = (row[i] + left) & 0xFF
+        elif filter_type == 3:
+            row[i] = (row[i] + left // 2) & 0xFF
+        elif filter_type == 4:
+            row[i] = (row[i] + paeth(left, 0, 0)) & 0xFF
+
+    return row
+
+
+def main():
+    directory = os.path.dirname(os.path.abspath(__file__))
+
+    print('// Generated by colormaps/generate_colormaps.py from the PNG files in colormaps/, do not edit by hand')
+    print('#ifndef COLORMAPS_H')
+    print('#define COLORMAPS_H')
+    print('')
+    print('#include "displayinfo.h"')
+    print('')
+    print('// Number of entries in each color map')
+    print('constexpr int colorMapSize = %d;' % WIDTH)
+    print('')
+    print('// RGBA values for each color map, indexed by ColorMap')
+    print('constexpr unsigned char colorMapData[(int)ColorMap::Count][colorMapSize * 4] =')
+    print('{')
+
+    for index, (name, filename) in enumerate(COLOR_MAPS):
+        row = read_png(os.path.join(directory, filename))
+
+        print('    // %s' % name)
+        print('    {')
+        for offset in range(0, len(row), 32):
+            print('        ' + ', '.join('%d' % value for value in row[offset:offset + 32]) + ',')
+        print('    }' + (',' if index < len(COLOR_MAPS) - 1 else ''))
+
+    print('};')
+    print('')
+    print('#endif // COLORMAPS_H')
+
+
+if __name__ == '__main__':
+    main()
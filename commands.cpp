@@ -5,8 +5,8 @@
 
 // AxialMoveCommand
 // --------------------------------------------------------------------------------------------------------------------
-AxialMoveCommand::AxialMoveCommand(QPointF delta, AxialSliceWidget *widget, CommandID ID, QUndoCommand *parent) : QUndoCommand(parent),
-    delta(delta), widget(widget), ID(ID)
+AxialMoveCommand::AxialMoveCommand(QPointF delta, AxialSliceWidget *widget, QUndoCommand *parent) : QUndoCommand(parent),
+    delta(delta), widget(widget), applied(true)
 {
     // Updates text that is shown on QUndoView
     setText(QObject::tr("Move axial image by (%1%, %2%)").arg(int(delta.x() * 100.0f)).arg(int(delta.y() * 100.0f)));
@@ -14,7 +14,7 @@ AxialMoveCommand::AxialMoveCommand(QPointF delta, AxialSliceWidget *widget, Comm
 
 void AxialMoveCommand::undo()
 {
-    // Divide delta by respective width/height of screen and add it to the translation
+    // Subtract delta from the translation
     widget->rtranslation() -= delta;
 
     // Tell the screen to draw itself since the scene changed
@@ -23,6 +23,13 @@ void AxialMoveCommand::undo()
 
 void AxialMoveCommand::redo()
 {
+    // The widget was already moved during the pan gesture so skip the redo when the command is pushed
+    if (applied)
+    {
+        applied = false;
+        return;
+    }
+
     // Add delta to translation
     widget->rtranslation() += delta;
 
@@ -30,26 +37,10 @@ void AxialMoveCommand::redo()
     widget->update();
 }
 
-bool AxialMoveCommand::mergeWith(const QUndoCommand *command)
-{
-    const AxialMoveCommand *moveCommand = static_cast<const AxialMoveCommand *>(command);
-
-    // Merge the commands by adding their respective deltas
-    delta += moveCommand->delta;
-
-    // Updates text that is shown on QUndoView
-    setText(QObject::tr("Move axial image by (%1%, %2%)").arg(int(delta.x()*100.0f)).arg(int(delta.y()*100.0f)));
-
-    //if (delta.length() == 0)
-    //    setObsolete(true);
-
-    return true;
-}
-
 // CoronalMoveCommand
 // --------------------------------------------------------------------------------------------------------------------
-CoronalMoveCommand::CoronalMoveCommand(QPointF delta, CoronalSliceWidget *widget, CommandID ID, QUndoCommand *parent) : QUndoCommand(parent),
-    delta(delta), widget(widget), ID(ID)
+CoronalMoveCommand::CoronalMoveCommand(QPointF delta, CoronalSliceWidget *widget, QUndoCommand *parent) : QUndoCommand(parent),
+    delta(delta), widget(widget), applied(true)
 {
     // Updates text that is shown on QUndoView
     setText(QObject::tr("Move coronal image by (%1%, %2%)").arg(int(delta.x() * 100.0f)).arg(int(delta.y() * 100.0f)));
@@ -57,7 +48,7 @@ CoronalMoveCommand::CoronalMoveCommand(QPointF delta, CoronalSliceWidget *widget
 
 void CoronalMoveCommand::undo()
 {
-    // Divide delta by respective width/height of screen and add it to the translation
+    // Subtract delta from the translation
     widget->rtranslation() -= delta;
 
     // Tell the screen to draw itself since the scene changed
@@ -66,6 +57,13 @@ void CoronalMoveCommand::undo()
 
 void CoronalMoveCommand::redo()
 {
+    // The widget was already moved during the pan gesture so skip the redo when the command is pushed
+    if (applied)
+    {
+        applied = false;
+        return;
+    }
+
     // Add delta to translation
     widget->rtranslation() += delta;
 
@@ -73,38 +71,19 @@ void CoronalMoveCommand::redo()
     widget->update();
 }
 
-bool CoronalMoveCommand::mergeWith(const QUndoCommand *command)
-{
-    const CoronalMoveCommand *moveCommand = static_cast<const CoronalMoveCommand *>(command);
-
-    // Merge the commands by adding their respective deltas
-    delta += moveCommand->delta;
-
-    // Updates text that is shown on QUndoView
-    setText(QObject::tr("Move coronal image by (%1%, %2%)").arg(int(delta.x()*100.0f)).arg(int(delta.y()*100.0f)));
-
-    //if (delta.length() == 0)
-    //    setObsolete(true);
-
-    return true;
-}
-
 // AxialScaleCommand
 // --------------------------------------------------------------------------------------------------------------------
-AxialScaleCommand::AxialScaleCommand(float scaling, AxialSliceWidget *widget, QUndoCommand *parent) : QUndoCommand(parent),
-    scaling(scaling), widget(widget)
+AxialScaleCommand::AxialScaleCommand(float oldScaling, float newScaling, AxialSliceWidget *widget, QUndoCommand *parent) : QUndoCommand(parent),
+    oldScaling(oldScaling), newScaling(newScaling), widget(widget), applied(true)
 {
     // Updates text that is shown on QUndoView
-    setText(QObject::tr("Scale axial image by %1%").arg(int(scaling * 100.0f)));
+    setText(QObject::tr("Scale axial image from %1% to %2%").arg(int(oldScaling * 100.0f)).arg(int(newScaling * 100.0f)));
 }
 
 void AxialScaleCommand::undo()
 {
-    // Add the scaling to the total scaling to zoom in or out
-    widget->rscaling() -= scaling;
-
-    // Clamp it between 0.05f (5%) to 3.0f (300%)
-    widget->rscaling() = std::max(std::min(widget->rscaling(), 3.0f), 0.05f);
+    // The scaling factors are already clamped when the gesture occurs, so they are restored as is
+    widget->rscaling() = oldScaling;
 
     // Tell the screen to draw itself since the scene changed
     widget->update();
@@ -112,54 +91,32 @@ void AxialScaleCommand::undo()
 
 void AxialScaleCommand::redo()
 {
-    // Add the scaling to the total scaling to zoom in or out
-    widget->rscaling() += scaling;
+    // The widget was already scaled during the zoom gesture so skip the redo when the command is pushed
+    if (applied)
+    {
+        applied = false;
+        return;
+    }
 
-    // Clamp it between 0.05f (5%) to 3.0f (300%)
-    widget->rscaling() = std::max(std::min(widget->rscaling(), 3.0f), 0.05f);
+    widget->rscaling() = newScaling;
 
     // Tell the screen to draw itself since the scene changed
     widget->update();
 }
 
-bool AxialScaleCommand::mergeWith(const QUndoCommand *command)
-{
-    const AxialScaleCommand *scaleCommand = static_cast<const AxialScaleCommand *>(command);
-
-    // Merge the two commands by adding the scaling component
-    scaling += scaleCommand->scaling;
-
-    // Updates text that is shown on QUndoView
-    setText(QObject::tr("Scale axial image by %1%").arg(int(scaling*100.0f)));
-
-    // When building this executable, the setObsolete command requires a special patch in Qt to work
-    // correctly. It is something that I edited in the Qt source code and contributed to the Qt source
-    // code. It is likely that it will not become apart of the built libraries until Qt 5.9+. Therefore,
-    // if you do not want to bother building the Qt libraries(6+ hours of time at least), then comment out
-    // all instances of setObsolete and it should work. However, if you are interested, download the source
-    // code and cherry-pick the patch at: https://codereview.qt-project.org/#/c/178852/
-    //if (scaling == 0.0f)
-    //    setObsolete(true);
-
-    return true;
-}
-
 // CoronalScaleCommand
 // --------------------------------------------------------------------------------------------------------------------
-CoronalScaleCommand::CoronalScaleCommand(float scaling, CoronalSliceWidget *widget, QUndoCommand *parent) : QUndoCommand(parent),
-    scaling(scaling), widget(widget)
+CoronalScaleCommand::CoronalScaleCommand(float oldScaling, float newScaling, CoronalSliceWidget *widget, QUndoCommand *parent) : QUndoCommand(parent),
+    oldScaling(oldScaling), newScaling(newScaling), widget(widget), applied(true)
 {
     // Updates text that is shown on QUndoView
-    setText(QObject::tr("Scale coronal image by %1%").arg(int(scaling * 100.0f)));
+    setText(QObject::tr("Scale coronal image from %1% to %2%").arg(int(oldScaling * 100.0f)).arg(int(newScaling * 100.0f)));
 }
 
 void CoronalScaleCommand::undo()
 {
-    // Add the scaling to the total scaling to zoom in or out
-    widget->rscaling() -= scaling;
-
-    // Clamp it between 0.05f (5%) to 3.0f (300%)
-    widget->rscaling() = std::max(std::min(widget->rscaling(), 3.0f), 0.05f);
+    // The scaling factors are already clamped when the gesture occurs, so they are restored as is
+    widget->rscaling() = oldScaling;
 
     // Tell the screen to draw itself since the scene changed
     widget->update();
@@ -167,38 +124,19 @@ void CoronalScaleCommand::undo()
 
 void CoronalScaleCommand::redo()
 {
-    // Add the scaling to the total scaling to zoom in or out
-    widget->rscaling() += scaling;
+    // The widget was already scaled during the zoom gesture so skip the redo when the command is pushed
+    if (applied)
+    {
+        applied = false;
+        return;
+    }
 
-    // Clamp it between 0.05f (5%) to 3.0f (300%)
-    widget->rscaling() = std::max(std::min(widget->rscaling(), 3.0f), 0.05f);
+    widget->rscaling() = newScaling;
 
     // Tell the screen to draw itself since the scene changed
     widget->update();
 }
 
-bool CoronalScaleCommand::mergeWith(const QUndoCommand *command)
-{
-    const CoronalScaleCommand *scaleCommand = static_cast<const CoronalScaleCommand *>(command);
-
-    // Merge the two commands by adding the scaling component
-    scaling += scaleCommand->scaling;
-
-    // Updates text that is shown on QUndoView
-    setText(QObject::tr("Scale coronal image by %1%").arg(int(scaling*100.0f)));
-
-    // When building this executable, the setObsolete command requires a special patch in Qt to work
-    // correctly. It is something that I edited in the Qt source code and contributed to the Qt source
-    // code. It is likely that it will not become apart of the built libraries until Qt 5.9+. Therefore,
-    // if you do not want to bother building the Qt libraries(6+ hours of time at least), then comment out
-    // all instances of setObsolete and it should work. However, if you are interested, download the source
-    // code and cherry-pick the patch at: https://codereview.qt-project.org/#/c/178852/
-    //if (scaling == 0.0f)
-    //    setObsolete(true);
-
-    return true;
-}
-
 // ResetViewCommand
 // --------------------------------------------------------------------------------------------------------------------
 ResetViewCommand::ResetViewCommand(AxialSliceWidget *axialWidget, CoronalSliceWidget *coronalWidget, QUndoCommand *parent) : QUndoCommand(parent),
@@ -362,8 +300,8 @@ void LocationChangeCommand::redo()
         saggitalSpinBox->blockSignals(prev);
     }
 
-    //if (delta.isNull())
-    //    setObsolete(true);
+    if (delta.isNull())
+        setObsolete(true);
 }
 
 bool LocationChangeCommand::mergeWith(const QUndoCommand *command)
@@ -393,8 +331,8 @@ bool LocationChangeCommand::mergeWith(const QUndoCommand *command)
     str.remove(str.length() - 2, 2);
     setText(str);
 
-    //if (newLocation == oldLocation)
-    //    setObsolete(true);
+    if (newLocation == oldLocation)
+        setObsolete(true);
 
     return true;
 }
@@ -455,8 +393,8 @@ bool BrightnessChangeCommand::mergeWith(const QUndoCommand *command)
     // Updates text that is shown on QUndoView
     setText(QObject::tr("Brightness set to %1%").arg(int(newBrightness * 100.0f)));
 
-    //if (newBrightness == oldBrightness)
-    //   setObsolete(true);
+    if (newBrightness == oldBrightness)
+        setObsolete(true);
 
     return true;
 }
@@ -505,8 +443,8 @@ bool BrightnessThresChangeCommand::mergeWith(const QUndoCommand *command)
     // Updates text that is shown on QUndoView
     setText(QObject::tr("Brightness threshold set to %1%").arg(int(newThreshold * 100.0f)));
 
-    //if (newThreshold == oldThreshold)
-    //   setObsolete(true);
+    if (newThreshold == oldThreshold)
+        setObsolete(true);
 
     return true;
 }
@@ -567,8 +505,8 @@ bool ContrastChangeCommand::mergeWith(const QUndoCommand *command)
     // Updates text that is shown on QUndoView
     setText(QObject::tr("Contrast set to %1%").arg(int(newContrast * 100.0f)));
 
-    //if (newContrast == oldContrast)
-    //    setObsolete(true);
+    if (newContrast == oldContrast)
+        setObsolete(true);
 
     return true;
 }
@@ -695,8 +633,8 @@ bool PrimOpacityChangeCommand::mergeWith(const QUndoCommand *command)
     // Updates text that is shown on QUndoView
     setText(QObject::tr("Primary opacity set to %1%").arg(int(newOpacity * 100.0f)));
 
-    //if (newOpacity == oldOpacity)
-    //    setObsolete(true);
+    if (newOpacity == oldOpacity)
+        setObsolete(true);
 
     return true;
 }
@@ -757,8 +695,8 @@ bool SecdOpacityChangeCommand::mergeWith(const QUndoCommand *command)
     // Updates text that is shown on QUndoView
     setText(QObject::tr("Secondary opacity set to %1%").arg(int(newOpacity * 100.0f)));
 
-    //if (newOpacity == oldOpacity)
-    //    setObsolete(true);
+    if (newOpacity == oldOpacity)
+        setObsolete(true);
 
     return true;
 }
@@ -866,34 +804,144 @@ void TracingLayerVisibleChangeCommand::redo()
     widget->update();
 }
 
-// TracingPointsAddCommand
+// TracingHistory
 // --------------------------------------------------------------------------------------------------------------------
-TracingPointsAddCommand::TracingPointsAddCommand(AxialSliceWidget *widget, QUndoCommand *parent) : TracingCommand(parent),
-    widget(widget)
+size_t TracingHistory::memoryBudget = 256 * 1024 * 1024;
+
+void TracingHistory::add(TracingCommand *command)
 {
-    // Get a text string based on the layer that points are being added too (current layer)
-    QString str;
-    switch (widget->getTracingLayer())
+    commands.push_back(command);
+}
+
+void TracingHistory::remove(TracingCommand *command)
+{
+    // The undo stack deletes the newest commands when new ones are pushed, so the search starts from the back
+    auto it = std::find(commands.rbegin(), commands.rend(), command);
+    if (it != commands.rend())
+        commands.erase(std::next(it).base());
+}
+
+size_t TracingHistory::totalMemoryUsage() const
+{
+    size_t total = 0;
+    for (const TracingCommand *command : commands)
+        total += command->memoryUsage();
+
+    return total;
+}
+
+void TracingHistory::enforceMemoryBudget()
+{
+    // QUndoStack does not allow removing the oldest commands directly. Instead, the oldest commands release their data until the
+    // total memory usage is within the budget and are marked obsolete, see TracingCommand::expire. The newest command is never
+    // expired
+    size_t total = totalMemoryUsage();
+
+    for (auto it = std::begin(commands); total > memoryBudget && it != std::end(commands) && *it != commands.back(); ++it)
     {
-        case TracingLayer::EAT: str = "EAT"; break;
-        case TracingLayer::IMAT: str = "IMAT"; break;
-        case TracingLayer::PAAT: str = "PAAT"; break;
-        case TracingLayer::PAT: str = "PAT"; break;
-        case TracingLayer::SCAT: str = "SCAT"; break;
-        case TracingLayer::VAT: str = "VAT"; break;
+        if ((*it)->isExpired())
+            continue;
+
+        const size_t usage = (*it)->memoryUsage();
+        (*it)->expire();
+        total -= usage - (*it)->memoryUsage();
     }
+}
+
+size_t TracingHistory::getMemoryBudget()
+{
+    return memoryBudget;
+}
+
+void TracingHistory::setMemoryBudget(size_t bytes)
+{
+    memoryBudget = bytes;
+}
+
+// TracingCommand
+// --------------------------------------------------------------------------------------------------------------------
+TracingCommand::TracingCommand(TracingHistory *history, QUndoCommand *parent) : QUndoCommand(parent),
+    history(history), expired(false)
+{
+    history->add(this);
+}
+
+TracingCommand::~TracingCommand()
+{
+    history->remove(this);
+}
+
+void TracingCommand::finish()
+{
+    // Sort the spans by row and then column so that adjacent runs can be merged, a stroke along a row becomes one run
+    std::sort(std::begin(spans), std::end(spans), [](const TracingSpan &a, const TracingSpan &b) {
+        return (a.y < b.y) || (a.y == b.y && a.x < b.x);
+    });
+
+    // Merge runs that are on the same row and touch each other. Each pixel is only changed once by the command so runs will never overlap
+    if (!spans.empty())
+    {
+        auto last = std::begin(spans);
+        for (auto it = std::next(last); it != std::end(spans); ++it)
+        {
+            if (it->y == last->y && last->x + last->length == it->x && last->length + it->length <= std::numeric_limits<unsigned short>::max())
+                last->length += it->length;
+            else
+                *(++last) = *it;
+        }
+
+        spans.erase(std::next(last), std::end(spans));
+    }
+
+    spans.shrink_to_fit();
+
+    history->enforceMemoryBudget();
+}
+
+void TracingCommand::expire()
+{
+    if (expired)
+        return;
+
+    std::vector<TracingSpan>().swap(spans);
+    expired = true;
+
+    // The command cannot be undone anymore, so QUndoStack removes it from the history the next time it reaches it instead of
+    // undoing it
+    setObsolete(true);
 
     // Updates text that is shown on QUndoView
-    setText(QObject::tr("Added points to %1 layer").arg(str));
+    setText(QObject::tr("%1 (expired)").arg(text()));
+}
+
+bool TracingCommand::isExpired() const
+{
+    return expired;
+}
+
+size_t TracingCommand::memoryUsage() const
+{
+    return sizeof(TracingCommand) + spans.capacity() * sizeof(TracingSpan);
+}
+
+// TracingPointsAddCommand
+// --------------------------------------------------------------------------------------------------------------------
+TracingPointsAddCommand::TracingPointsAddCommand(AxialSliceWidget *widget, QUndoCommand *parent) : TracingCommand(widget->getTracingHistory(), parent),
+    widget(widget)
+{
+    // Updates text that is shown on QUndoView, naming the layer that points are being changed on (current layer)
+    setText(QObject::tr("Added points to %1 layer").arg(tracingLayerName(widget->getTracingLayer())));
 }
 
 void TracingPointsAddCommand::undo()
 {
     const auto z = widget->getLocation().z();
 
-    for (QPoint point : points)
-        widget->getTraceSlices().reset(point.x(), point.y(), z);
+    // Each span was completely cleared before it was added
+    for (const TracingSpan &span : spans)
+        widget->getTraceSlices().resetSpan(z, span);
 
+    widget->spansChanged(z, spans);
     widget->setDirty(Dirty::Trace(widget->getTracingLayer()));
     widget->update();
 }
@@ -902,41 +950,32 @@ void TracingPointsAddCommand::redo()
 {
     const auto z = widget->getLocation().z();
 
-    for (QPoint point : points)
-        widget->getTraceSlices().set(point.x(), point.y(), z);
+    for (const TracingSpan &span : spans)
+        widget->getTraceSlices().setSpan(z, span);
 
+    widget->spansChanged(z, spans);
     widget->setDirty(Dirty::Trace(widget->getTracingLayer()));
     widget->update();
 }
 
 // TracingPointsEraseCommand
 // --------------------------------------------------------------------------------------------------------------------
-TracingPointsEraseCommand::TracingPointsEraseCommand(AxialSliceWidget *widget, QUndoCommand *parent) : TracingCommand(parent),
+TracingPointsEraseCommand::TracingPointsEraseCommand(AxialSliceWidget *widget, QUndoCommand *parent) : TracingCommand(widget->getTracingHistory(), parent),
     widget(widget)
 {
-    // Get a text string based on the layer that points are being added too (current layer)
-    QString str;
-    switch (widget->getTracingLayer())
-    {
-        case TracingLayer::EAT: str = "EAT"; break;
-        case TracingLayer::IMAT: str = "IMAT"; break;
-        case TracingLayer::PAAT: str = "PAAT"; break;
-        case TracingLayer::PAT: str = "PAT"; break;
-        case TracingLayer::SCAT: str = "SCAT"; break;
-        case TracingLayer::VAT: str = "VAT"; break;
-    }
-
-    // Updates text that is shown on QUndoView
-    setText(QObject::tr("Erased points from %1 layer").arg(str));
+    // Updates text that is shown on QUndoView, naming the layer that points are being changed on (current layer)
+    setText(QObject::tr("Erased points from %1 layer").arg(tracingLayerName(widget->getTracingLayer())));
 }
 
 void TracingPointsEraseCommand::undo()
 {
     const auto z = widget->getLocation().z();
 
-    for (QPoint point : points)
-        widget->getTraceSlices().set(point.x(), point.y(), z);
+    // Each span was completely set before it was erased
+    for (const TracingSpan &span : spans)
+        widget->getTraceSlices().setSpan(z, span);
 
+    widget->spansChanged(z, spans);
     widget->setDirty(Dirty::Trace(widget->getTracingLayer()));
     widget->update();
 }
@@ -945,13 +984,76 @@ void TracingPointsEraseCommand::redo()
 {
     const auto z = widget->getLocation().z();
 
-    for (QPoint point : points)
-        widget->getTraceSlices().reset(point.x(), point.y(), z);
+    for (const TracingSpan &span : spans)
+        widget->getTraceSlices().resetSpan(z, span);
 
+    widget->spansChanged(z, spans);
     widget->setDirty(Dirty::Trace(widget->getTracingLayer()));
     widget->update();
 }
 
+// TracingMorphologyCommand
+// --------------------------------------------------------------------------------------------------------------------
+TracingMorphologyCommand::TracingMorphologyCommand(AxialSliceWidget *widget, TracingLayer layer, MorphologyOperation operation,
+                                                   std::vector<MorphologySliceSpans> &changes, QUndoCommand *parent) :
+    TracingCommand(widget->getTracingHistory(), parent),
+    widget(widget), layer(layer), slices()
+{
+    size_t count = 0;
+    for (const auto &change : changes)
+        count += change.set.size() + change.cleared.size();
+
+    spans.reserve(count);
+    slices.reserve(changes.size());
+
+    for (auto &change : changes)
+    {
+        addSpans(change.set);
+        const size_t setEnd = spans.size();
+        addSpans(change.cleared);
+
+        slices.push_back({change.z, setEnd, spans.size()});
+    }
+
+    // Updates text that is shown on QUndoView
+    setText(QObject::tr("%1 on %2 layer (%3 slices)").arg(TracingMorphology::operationName(operation)).arg(tracingLayerName(layer)).arg(slices.size()));
+}
+
+void TracingMorphologyCommand::apply(bool forward)
+{
+    // Once the spans are released, the change can no longer be applied
+    if (isExpired())
+        return;
+
+    TracingLayerData &layerData = widget->getTraceSlices(layer);
+    size_t start = 0;
+
+    for (const SliceRange &slice : slices)
+    {
+        for (size_t i = start; i < slice.setEnd; ++i)
+            forward ? layerData.setSpan(slice.z, spans[i]) : layerData.resetSpan(slice.z, spans[i]);
+
+        for (size_t i = slice.setEnd; i < slice.end; ++i)
+            forward ? layerData.resetSpan(slice.z, spans[i]) : layerData.setSpan(slice.z, spans[i]);
+
+        widget->spansChanged(slice.z, spans.data() + start, spans.data() + slice.end);
+        start = slice.end;
+    }
+
+    widget->setDirty(Dirty::Trace(layer));
+    widget->update();
+}
+
+void TracingMorphologyCommand::undo()
+{
+    apply(false);
+}
+
+void TracingMorphologyCommand::redo()
+{
+    apply(true);
+}
+
 // DrawModeChangeCommand
 // --------------------------------------------------------------------------------------------------------------------
 DrawModeChangeCommand::DrawModeChangeCommand(DrawMode newDrawMode, AxialSliceWidget *widget, QStackedWidget *stackWidget, QPushButton *oldBtn, QPushButton *newBtn, QString str, QUndoCommand *parent) : QUndoCommand(parent),
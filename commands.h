@@ -12,8 +12,11 @@
 #include <QPushButton>
 #include <QCheckBox>
 #include <QStackedWidget>
+#include <list>
 
 #include "displayinfo.h"
+#include "tracing.h"
+#include "tracingmorphology.h"
 
 // Since AxialSliceWidget and MainWindow include this file in its header, it would be an infinite loop if this file included them in their header
 // To get around this, the classes are simply declared here and the headers for these classes are included in the source file
@@ -24,13 +27,7 @@ class MainWindow;
 // These command IDs are used for merging commands. Only commands with the same ID will be merged.
 enum class CommandID : int
 {
-    AxialMove = 1,
-    AxialMoveEnd = 10,
-    CoronalMove = 11,
-    CoronalMoveEnd = 20,
-    AxialScale,
-    CoronalScale,
-    ResetView,
+    ResetView = 1,
     LocationChange,
     BrightnessChange,
     BrightnessThresChange,
@@ -39,20 +36,22 @@ enum class CommandID : int
     SecdOpacityChange
 };
 
+/* Note: Pan and zoom are applied to the widget directly while the user is dragging or scrolling and one command is pushed
+ * for the entire gesture once it is finished. Since the view has already been changed when the command is pushed, the first
+ * call to redo (which is called by QUndoStack::push) does nothing.
+ */
 class AxialMoveCommand : public QUndoCommand
 {
 private:
     QVector3D delta;
     AxialSliceWidget *widget;
-    CommandID ID;
+    bool applied;
 
 public:
-    AxialMoveCommand(QPointF delta, AxialSliceWidget *widget, CommandID ID, QUndoCommand *parent = NULL);
+    AxialMoveCommand(QPointF delta, AxialSliceWidget *widget, QUndoCommand *parent = NULL);
 
     void undo() override;
     void redo() override;
-    bool mergeWith(const QUndoCommand *command) override;
-    int id() const override { return (int)ID; }
 };
 
 class CoronalMoveCommand : public QUndoCommand
@@ -60,45 +59,43 @@ class CoronalMoveCommand : public QUndoCommand
 private:
     QVector3D delta;
     CoronalSliceWidget *widget;
-    CommandID ID;
+    bool applied;
 
 public:
-    CoronalMoveCommand(QPointF delta, CoronalSliceWidget *widget, CommandID ID, QUndoCommand *parent = NULL);
+    CoronalMoveCommand(QPointF delta, CoronalSliceWidget *widget, QUndoCommand *parent = NULL);
 
     void undo() override;
     void redo() override;
-    bool mergeWith(const QUndoCommand *command) override;
-    int id() const override { return (int)ID; }
 };
 
 class AxialScaleCommand : public QUndoCommand
 {
 private:
-    float scaling;
+    float oldScaling;
+    float newScaling;
     AxialSliceWidget *widget;
+    bool applied;
 
 public:
-    AxialScaleCommand(float scaling, AxialSliceWidget *widget, QUndoCommand *parent = NULL);
+    AxialScaleCommand(float oldScaling, float newScaling, AxialSliceWidget *widget, QUndoCommand *parent = NULL);
 
     void undo() override;
     void redo() override;
-    bool mergeWith(const QUndoCommand *command) override;
-    int id() const override { return (int)CommandID::AxialScale; }
 };
 
 class CoronalScaleCommand : public QUndoCommand
 {
 private:
-    float scaling;
+    float oldScaling;
+    float newScaling;
     CoronalSliceWidget *widget;
+    bool applied;
 
 public:
-    CoronalScaleCommand(float scaling, CoronalSliceWidget *widget, QUndoCommand *parent = NULL);
+    CoronalScaleCommand(float oldScaling, float newScaling, CoronalSliceWidget *widget, QUndoCommand *parent = NULL);
 
     void undo() override;
     void redo() override;
-    bool mergeWith(const QUndoCommand *command) override;
-    int id() const override { return (int)CommandID::CoronalScale; }
 };
 
 class ResetViewCommand : public QUndoCommand
@@ -316,16 +313,56 @@ public:
     void redo() override;
 };
 
+class TracingCommand;
+
+/* TracingHistory keeps the tracing commands of one undo stack in the order they were created, each view owns one next to its
+ * undo stack. When the commands use more memory than the budget, the oldest commands release their data, see
+ * TracingCommand::expire. The budget is the same for every history and a new budget is applied the next time a command is
+ * finished.
+ */
+class TracingHistory
+{
+private:
+    static size_t memoryBudget;
+
+    std::list<TracingCommand *> commands;
+
+public:
+    void add(TracingCommand *command);
+    void remove(TracingCommand *command);
+
+    size_t totalMemoryUsage() const;
+    void enforceMemoryBudget();
+
+    static size_t getMemoryBudget();
+    static void setMemoryBudget(size_t bytes);
+};
+
 class TracingCommand : public QUndoCommand
 {
+private:
+    TracingHistory *history;
+    bool expired;
+
 protected:
-    std::vector<QPoint> points;
+    // Runs of pixels that were changed by the command on the current slice and layer
+    std::vector<TracingSpan> spans;
 
 public:
-    TracingCommand(QUndoCommand *parent = NULL) : QUndoCommand(parent) { }
+    TracingCommand(TracingHistory *history, QUndoCommand *parent = NULL);
+    ~TracingCommand();
+
+    void addSpans(std::vector<TracingSpan> &newSpans) { spans.insert(std::end(spans), std::begin(newSpans), std::end(newSpans)); }
+
+    // Called when the mouse is released. Merges adjacent spans together and then releases the oldest commands if the memory budget
+    // is exceeded
+    void finish();
 
-    void addPoint(QPoint newPoint) { points.push_back(newPoint); }
-    void addPoint(std::vector<QPoint> &newPoints) { points.insert(std::end(points), std::begin(newPoints), std::end(newPoints)); }
+    // Releases the spans of this command and marks it obsolete, so the undo stack deletes it the next time it is undone or redone
+    void expire();
+    bool isExpired() const;
+
+    size_t memoryUsage() const;
 };
 
 /* Note: This class will assume that the layer and axial slice that is being drawn on is the current layer and axial slice.
@@ -357,6 +394,36 @@ public:
     void redo() override;
 };
 
+/* TracingMorphologyCommand is a morphological operation on a slab of one tracing layer. The runs of voxels that the operation
+ * set and cleared are stored for each axial slice that changed, so undo and redo only touch the voxels that changed. Unlike
+ * the other tracing commands, the slices and the layer are not assumed to be the current ones.
+ */
+class TracingMorphologyCommand : public TracingCommand
+{
+private:
+    // The spans of each slice are stored in order in spans. The spans from the end of the previous slice to setEnd were set
+    // and the spans from setEnd to end were cleared
+    struct SliceRange
+    {
+        int z;
+        size_t setEnd;
+        size_t end;
+    };
+
+    AxialSliceWidget *widget;
+    TracingLayer layer;
+    std::vector<SliceRange> slices;
+
+    void apply(bool forward);
+
+public:
+    TracingMorphologyCommand(AxialSliceWidget *widget, TracingLayer layer, MorphologyOperation operation,
+                             std::vector<MorphologySliceSpans> &changes, QUndoCommand *parent = NULL);
+
+    void undo() override;
+    void redo() override;
+};
+
 class DrawModeChangeCommand : public QUndoCommand
 {
 private:
@@ -0,0 +1,208 @@
+#include "connectedcomponents.h"
+
+static int findRoot(std::vector<int> &parent, int label)
+{
+    while (parent[label] != label)
+    {
+        parent[label] = parent[parent[label]];
+        label = parent[label];
+    }
+
+    return label;
+}
+
+ConnectedComponents::ConnectedComponents() : sliceLabels(), offsets(), components(), stats()
+{
+}
+
+/* compute labels the components of volume. Each slice is labeled in parallel by OpenCV. In 3D, each pair of adjacent
+ * slices is then scanned in parallel for the labels that touch. Consecutive voxels usually give the same pair, so only
+ * the distinct pairs are kept and joined with union-find afterwards.
+ */
+void ConnectedComponents::compute(const cv::Mat &volume, bool threeD)
+{
+    clear();
+
+    const int zDim = volume.size[0];
+    const int yDim = volume.size[1];
+    const int xDim = volume.size[2];
+    const int dims[] = { yDim, xDim };
+
+    sliceLabels.resize(zDim);
+    std::vector<cv::Mat> sliceStats(zDim);
+
+    cv::parallel_for_(cv::Range(0, zDim), [&](const cv::Range &range)
+    {
+        cv::Mat centroids;
+
+        for (int z = range.start; z < range.end; ++z)
+        {
+            const cv::Range region[] = { cv::Range(z, z + 1), cv::Range::all(), cv::Range::all() };
+            cv::connectedComponentsWithStats(cv::Mat(volume, region).reshape(0, 2, dims), sliceLabels[z], sliceStats[z],
+                                             centroids, 8, CV_32S);
+        }
+    });
+
+    offsets.assign(zDim + 1, 0);
+    for (int z = 0; z < zDim; ++z)
+        offsets[z + 1] = offsets[z] + sliceStats[z].rows;
+
+    std::vector<int> parent(offsets[zDim]);
+    std::iota(std::begin(parent), std::end(parent), 0);
+
+    if (threeD && zDim > 1)
+    {
+        // Pairs of labels that touch between slice z and z + 1
+        std::vector<std::vector<std::pair<int, int>>> pairs(zDim - 1);
+
+        cv::parallel_for_(cv::Range(0, zDim - 1), [&](const cv::Range &range)
+        {
+            for (int z = range.start; z < range.end; ++z)
+            {
+                std::vector<std::pair<int, int>> &slicePairs = pairs[z];
+
+                for (int y = 0; y < yDim; ++y)
+                {
+                    const int *lower = sliceLabels[z].ptr<int>(y);
+                    const int *upper = sliceLabels[z + 1].ptr<int>(y);
+
+                    for (int x = 0; x < xDim; ++x)
+                    {
+                        if (!lower[x] || !upper[x])
+                            continue;
+
+                        const std::pair<int, int> pair(offsets[z] + lower[x], offsets[z + 1] + upper[x]);
+                        if (slicePairs.empty() || slicePairs.back() != pair)
+                            slicePairs.push_back(pair);
+                    }
+                }
+
+                std::sort(std::begin(slicePairs), std::end(slicePairs));
+                slicePairs.erase(std::unique(std::begin(slicePairs), std::end(slicePairs)), std::end(slicePairs));
+            }
+        });
+
+        for (const auto &slicePairs : pairs)
+        {
+            for (const auto &pair : slicePairs)
+            {
+                const int a = findRoot(parent, pair.first);
+                const int b = findRoot(parent, pair.second);
+
+                if (a != b)
+                    parent[std::max(a, b)] = std::min(a, b);
+            }
+        }
+    }
+
+    // Each root is a component, the statistics of its labels on each slice are combined
+    components.assign(parent.size(), -1);
+    std::vector<int> rootComponent(parent.size(), -1);
+
+    for (int z = 0; z < zDim; ++z)
+    {
+        const cv::Mat &labelStats = sliceStats[z];
+
+        for (int label = 1; label < labelStats.rows; ++label)
+        {
+            const int root = findRoot(parent, offsets[z] + label);
+            const int left = labelStats.at<int>(label, cv::CC_STAT_LEFT);
+            const int top = labelStats.at<int>(label, cv::CC_STAT_TOP);
+            const int width = labelStats.at<int>(label, cv::CC_STAT_WIDTH);
+            const int height = labelStats.at<int>(label, cv::CC_STAT_HEIGHT);
+
+            // The first voxel of the label is on the top row of its bounding box
+            const int *row = sliceLabels[z].ptr<int>(top);
+            int firstX = left;
+            while (row[firstX] != label)
+                ++firstX;
+
+            if (rootComponent[root] < 0)
+            {
+                rootComponent[root] = (int)stats.size();
+
+                Component component;
+                component.size = 0;
+                component.xMin = component.yMin = component.zMin = std::numeric_limits<int>::max();
+                component.xMax = component.yMax = component.zMax = std::numeric_limits<int>::lowest();
+                component.x = firstX;
+                component.y = top;
+                component.z = z;
+                stats.push_back(component);
+            }
+
+            Component &component = stats[rootComponent[root]];
+            component.size += labelStats.at<int>(label, cv::CC_STAT_AREA);
+            component.xMin = std::min(component.xMin, left);
+            component.xMax = std::max(component.xMax, left + width - 1);
+            component.yMin = std::min(component.yMin, top);
+            component.yMax = std::max(component.yMax, top + height - 1);
+            component.zMin = std::min(component.zMin, z);
+            component.zMax = std::max(component.zMax, z);
+
+            if (z == component.z && (top < component.y || (top == component.y && firstX < component.x)))
+            {
+                component.x = firstX;
+                component.y = top;
+            }
+
+            components[offsets[z] + label] = rootComponent[root];
+        }
+    }
+}
+
+void ConnectedComponents::clear()
+{
+    sliceLabels.clear();
+    offsets.clear();
+    components.clear();
+    stats.clear();
+}
+
+int ConnectedComponents::count() const
+{
+    return (int)stats.size();
+}
+
+const Component &ConnectedComponents::at(int index) const
+{
+    return stats[index];
+}
+
+const std::vector<Component> &ConnectedComponents::getComponents() const
+{
+    return stats;
+}
+
+int ConnectedComponents::componentAt(int x, int y, int z) const
+{
+    if (z < 0 || z >= (int)sliceLabels.size())
+        return -1;
+
+    const int label = sliceLabels[z].at<int>(y, x);
+    return label ? components[offsets[z] + label] : -1;
+}
+
+void ConnectedComponents::removeComponents(cv::Mat &volume, const std::vector<unsigned char> &remove) const
+{
+    const int yDim = volume.size[1];
+    const int xDim = volume.size[2];
+
+    cv::parallel_for_(cv::Range(0, (int)sliceLabels.size()), [&](const cv::Range &range)
+    {
+        for (int z = range.start; z < range.end; ++z)
+        {
+            for (int y = 0; y < yDim; ++y)
+            {
+                const int *label = sliceLabels[z].ptr<int>(y);
+                unsigned char *voxel = volume.ptr<unsigned char>(z, y);
+
+                for (int x = 0; x < xDim; ++x)
+                {
+                    if (label[x] && remove[components[offsets[z] + label[x]]])
+                        voxel[x] = 0;
+                }
+            }
+        }
+    });
+}
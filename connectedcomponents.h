@@ -0,0 +1,62 @@
+#ifndef CONNECTEDCOMPONENTS_H
+#define CONNECTEDCOMPONENTS_H
+
+#include <QDebug>
+#include <vector>
+#include <numeric>
+#include <limits>
+
+#include <opencv2/opencv.hpp>
+
+// Connected set of traced voxels in a volume
+struct Component
+{
+    size_t size;
+
+    // Bounding box of the component, the maximums are inclusive
+    int xMin, xMax;
+    int yMin, yMax;
+    int zMin, zMax;
+
+    // First voxel of the component in the order of the volume, which is always inside the component
+    int x, y, z;
+};
+
+/* ConnectedComponents labels the connected components of the voxels that are not zero in a {z, y, x} volume of type CV_8U.
+ * Voxels are connected to their 8 neighbors on the same axial slice and, in 3D, to the voxels directly above and below.
+ *
+ * The labeling is done with a block-based union-find where each axial slice is a block. The slices are labeled in
+ * parallel, then the labels of each pair of adjacent slices that touch are found in parallel and joined with union-find.
+ * The statistics of each component are the combined statistics of its labels on each slice.
+ */
+class ConnectedComponents
+{
+private:
+    // Labels of each slice from OpenCV, label 0 is the background
+    std::vector<cv::Mat> sliceLabels;
+    // Labels of slice z are numbered from offsets[z] in the union of all slices
+    std::vector<int> offsets;
+    // Component index of each label in the union of all slices, -1 for the background
+    std::vector<int> components;
+
+    std::vector<Component> stats;
+
+public:
+    ConnectedComponents();
+
+    // Labels the components of volume. If threeD is false, each slice is labeled on its own
+    void compute(const cv::Mat &volume, bool threeD = true);
+    void clear();
+
+    int count() const;
+    const Component &at(int index) const;
+    const std::vector<Component> &getComponents() const;
+
+    // Returns the index of the component at the voxel or -1 if the voxel is not traced
+    int componentAt(int x, int y, int z) const;
+
+    // Sets the voxels of volume that are in a component with a non-zero entry in remove to 0
+    void removeComponents(cv::Mat &volume, const std::vector<unsigned char> &remove) const;
+};
+
+#endif // CONNECTEDCOMPONENTS_H
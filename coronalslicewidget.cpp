@@ -2,19 +2,30 @@
 #include "commands.h"
 
 CoronalSliceWidget::CoronalSliceWidget(QWidget *parent) : QOpenGLWidget(parent),
-    displayType(SliceDisplayType::FatOnly), fatImage(NULL), waterImage(NULL),
-    sliceTexture(0), location(0, 0, 0, 0), startPan(false), moveID(CommandID::CoronalMove)
+    displayType(SliceDisplayType::FatOnly), windowMode(WindowMode::PerSlice), fatImage(NULL), waterImage(NULL), tracingData(NULL),
+    tracingLayerColors({ Qt::blue, Qt::darkCyan, Qt::cyan, Qt::magenta, Qt::yellow, Qt::green }), dirty(0),
+    quadVertexObject(0), sliceTexture(NULL), levelBias(0), traceVolumeTexture(0), sliceScheduler(new SliceScheduler(this)), location(0, 0, 0, 0), startPan(false), startZoom(false), zoomGestureStartScaling(1.0f),
+    zoomGestureTimer(new QTimer(this)), recordViewHistory(true)
 {
+    this->tracingLayerVisible.fill(true);
 
+    // Each wheel event restarts the timer, the zoom gesture is finished when it times out
+    zoomGestureTimer->setSingleShot(true);
+    zoomGestureTimer->setInterval(500);
+    connect(zoomGestureTimer, SIGNAL(timeout()), this, SLOT(finishZoomGesture()));
+
+    // Draw again when a slice is ready so it is uploaded on the next frame
+    connect(sliceScheduler, SIGNAL(resultAvailable()), this, SLOT(update()));
 }
 
-void CoronalSliceWidget::setup(NIFTImage *fat, NIFTImage *water)
+void CoronalSliceWidget::setup(NIFTImage *fat, NIFTImage *water, TracingData *tracing)
 {
-    if (!fat || !water)
+    if (!fat || !water || !tracing)
         return;
 
     fatImage = fat;
     waterImage = water;
+    tracingData = tracing;
 
     location = QVector4D(0, 0, 0, 0);
 }
@@ -26,20 +37,30 @@ bool CoronalSliceWidget::isLoaded() const
 
 void CoronalSliceWidget::imageLoaded()
 {
-    sliceTextureInit = false;
+    // Any slice that is in progress is from the old image
+    sliceScheduler->cancel();
 
-    dirty |= Dirty::Slice;
+    // The buffers for the slices are allocated once here and reused for every slice of the image. The coronal slice is only
+    // the fat image so there is no secondary matrix
+    bufferPool.reserve(fatImage->getZDim(), fatImage->getXDim(), false);
+
+    dirty |= Dirty::Slice | Dirty::TracesAll;
     update();
 }
 
 void CoronalSliceWidget::readSettings(QSettings &settings)
 {
-    (void)settings;
+    settings.beginGroup("coronalSliceWidget");
+    // The transposed copy makes each coronal slice contiguous at the cost of a second copy of the fat image in memory
+    NIFTImage::setTransposeEnabled(settings.value("transposedVolume", true).toBool());
+    settings.endGroup();
 }
 
 void CoronalSliceWidget::writeSettings(QSettings &settings)
 {
-    (void)settings;
+    settings.beginGroup("coronalSliceWidget");
+    settings.setValue("transposedVolume", NIFTImage::getTransposeEnabled());
+    settings.endGroup();
 }
 
 void CoronalSliceWidget::setLocation(QVector4D location)
@@ -95,6 +116,67 @@ void CoronalSliceWidget::setDisplayType(SliceDisplayType type)
     update();
 }
 
+WindowMode CoronalSliceWidget::getWindowMode() const
+{
+    return windowMode;
+}
+
+void CoronalSliceWidget::setWindowMode(WindowMode mode)
+{
+    // If the window mode is out of the acceptable range, then do nothing
+    if (mode < WindowMode::PerSlice || mode > WindowMode::AutoPercentile)
+    {
+        qWarning() << "Invalid window mode was specified for CoronalSliceWidget: " << (int)mode;
+        return;
+    }
+
+    // Nothing to do if the window mode is unchanged, this prevents the slice from being prepared and uploaded again
+    if (mode == windowMode)
+        return;
+
+    windowMode = mode;
+
+    // This will recreate the texture because the window that is mapped to the color map has changed
+    dirty |= Dirty::Slice;
+    update();
+}
+
+int CoronalSliceWidget::getLevelBias() const
+{
+    return levelBias;
+}
+
+void CoronalSliceWidget::setLevelBias(int bias)
+{
+    if (bias < 0)
+    {
+        qWarning() << "Invalid level bias was specified for CoronalSliceWidget: " << bias;
+        return;
+    }
+
+    levelBias = bias;
+
+    // The textures are created once the widget is initialized, the bias is applied to them then
+    if (sliceTexture)
+    {
+        sliceTexture->setLevelBias(levelBias);
+    }
+
+    // Only the level that is drawn changes, the slice does not need to be prepared again
+    dirty |= Dirty::Scene;
+    update();
+}
+
+void CoronalSliceWidget::setTracingLayerVisible(int layer, bool visible)
+{
+    if (layer < 0 || layer >= (int)TracingLayer::Count)
+        return;
+
+    tracingLayerVisible[layer] = visible;
+    dirty |= Dirty::Scene;
+    update();
+}
+
 float &CoronalSliceWidget::rscaling()
 {
     return scaling;
@@ -105,6 +187,11 @@ QVector3D &CoronalSliceWidget::rtranslation()
     return translation;
 }
 
+const SliceBufferPool &CoronalSliceWidget::getBufferPool() const
+{
+    return bufferPool;
+}
+
 QMatrix4x4 CoronalSliceWidget::getMVPMatrix() const
 {
     // Calculate the ModelViewProjection (MVP) matrix to transform the location of the axial slices
@@ -170,6 +257,43 @@ void CoronalSliceWidget::resetView()
     update();
 }
 
+bool CoronalSliceWidget::getRecordViewHistory() const
+{
+    return recordViewHistory;
+}
+
+void CoronalSliceWidget::setRecordViewHistory(bool record)
+{
+    recordViewHistory = record;
+}
+
+void CoronalSliceWidget::finishPanGesture()
+{
+    if (!startPan)
+        return;
+
+    startPan = false;
+
+    // The view was already moved, the command is only pushed so the entire pan can be undone
+    if (recordViewHistory && !panGestureDelta.isNull())
+        undoStack->push(new CoronalMoveCommand(panGestureDelta, this));
+
+    panGestureDelta = QPointF();
+}
+
+void CoronalSliceWidget::finishZoomGesture()
+{
+    if (!startZoom)
+        return;
+
+    zoomGestureTimer->stop();
+    startZoom = false;
+
+    // The view was already scaled, the command is only pushed so the entire zoom can be undone
+    if (recordViewHistory && scaling != zoomGestureStartScaling)
+        undoStack->push(new CoronalScaleCommand(zoomGestureStartScaling, scaling, this));
+}
+
 void CoronalSliceWidget::initializeGL()
 {
     if (!initializeOpenGLFunctions())
@@ -186,13 +310,9 @@ void CoronalSliceWidget::initializeGL()
     scaling = 1.0f;
     translation = QVector3D(0.0f, 0.0f, 0.0f);
 
-    program = new QOpenGLShaderProgram();
-    program->addShaderFromSourceFile(QOpenGLShader::Vertex, ":/shaders/coronalslice.vert");
-    program->addShaderFromSourceFile(QOpenGLShader::Fragment, ":/shaders/coronalslice.frag");
-    program->link();
-    program->bind();
-
-    program->setUniformValue("tex", 0);
+    // Shader programs, quad buffers and color maps are created by the first slice widget and shared with the others
+    resources = GLResources::acquire();
+    quadVertexObject = resources->createQuadVertexArray();
 
     initializeSliceView();
 }
@@ -210,88 +330,214 @@ void CoronalSliceWidget::initializeSliceView()
     qDebug() << "                    GLSL VERSION: " << (const char*)glGetString(GL_SHADING_LANGUAGE_VERSION);
     qDebug() << "";
 
-    sliceTextureInit = false;
-
-    // Setup the axial slice vertices
-    sliceVertices.clear();
-    sliceVertices.append(VertexPT(QVector3D(-1.0f, -1.0f, 0.0f), QVector2D(0.0f, 0.0f)));
-    sliceVertices.append(VertexPT(QVector3D(-1.0f, 1.0f, 0.0f), QVector2D(0.0f, 1.0f)));
-    sliceVertices.append(VertexPT(QVector3D(1.0f, -1.0f, 0.0f), QVector2D(1.0f, 0.0f)));
-    sliceVertices.append(VertexPT(QVector3D(1.0f, 1.0f, 0.0f), QVector2D(1.0f, 1.0f)));
-
-    // Setup the axial slice indices
-    sliceIndices.clear();
-    sliceIndices.append({ 0, 1, 2, 3});
-
-    // Generate vertex buffer for the axial slice. The sliceVertices data is uploaded to the VBO
-    glGenBuffers(1, &sliceVertexBuf);
-    glBindBuffer(GL_ARRAY_BUFFER, sliceVertexBuf);
-    glBufferData(GL_ARRAY_BUFFER, sliceVertices.size() * sizeof(VertexPT), sliceVertices.constData(), GL_STATIC_DRAW);
-
-    // Generate index buffer for the axial slice. The sliceIndices data is uploaded to the IBO
-    glGenBuffers(1, &sliceIndexBuf);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, sliceIndexBuf);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sliceIndices.size() * sizeof(GLushort), sliceIndices.constData(), GL_STATIC_DRAW);
-
-    // Generate VAO for the axial slice vertices uploaded. Location 0 is the position and location 1 is the texture position
-    glGenVertexArrays(1, &sliceVertexObject);
-    glBindVertexArray(sliceVertexObject);
-    glEnableVertexAttribArray(0);
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(0, VertexPT::PosTupleSize, GL_FLOAT, true, VertexPT::stride(), static_cast<const char *>(0) + VertexPT::posOffset());
-    glVertexAttribPointer(1, VertexPT::TexPosTupleSize, GL_FLOAT, true, VertexPT::stride(), static_cast<const char *>(0) + VertexPT::texPosOffset());
-
-    // Generate a blank texture for the axial slice
-    glGenTextures(1, &this->sliceTexture);
-
-    // Release (unbind) all
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+    // The slice is linearly interpolated when stretching or shrinking to the screen which smooths out the pixel values
+    // instead of making it look blocky. The internal format is 32 bit floats with one channel for red
+    sliceTexture = new TiledTexture(GL_R32F, GL_LINEAR);
+    sliceTexture->setLevelBias(levelBias);
+}
+
+SliceResult CoronalSliceWidget::prepareSlice(cv::Mat fatVolume, cv::Mat fatTransposed, IntensityWindow fatWindow, int y, SliceBuffers buffers)
+{
+    SliceResult result;
+    result.slice = y;
+
+    if (y < 0 || y >= fatVolume.size[1])
+    {
+        qWarning() << "Unable to retrieve coronal slice " << y << " from the fat image. Slice is out of range.";
+        return result;
+    }
+
+    // Convert the slice to a 32-bit float where the window is mapped to 0.0f to 1.0f. The window is looked up from the
+    // statistics of the image so this is a single pass over the slice. The output is one of the buffers from the pool so
+    // this does not affect the original 3D matrix
+    const double alpha = (fatWindow.max > fatWindow.min) ? 1.0 / (fatWindow.max - fatWindow.min) : 0.0;
+
+    if (!fatTransposed.empty())
+    {
+        // The slice is one contiguous block of z by x in the transposed volume
+        const cv::Range region[] = { cv::Range(y, y + 1), cv::Range::all(), cv::Range::all() };
+        int dims[] = { fatTransposed.size[1], fatTransposed.size[2] };
+
+        cv::Mat(fatTransposed, region).reshape(0, 2, dims).convertTo(buffers.primMatrix, CV_32FC1, alpha, -fatWindow.min * alpha);
+    }
+    else
+    {
+        // The rows of the slice are one axial slice apart, so the slice is viewed as a 2D matrix with that step
+        const cv::Mat slice(fatVolume.size[0], fatVolume.size[2], fatVolume.type(), fatVolume.ptr(0, y), fatVolume.step[0]);
+        slice.convertTo(buffers.primMatrix, CV_32FC1, alpha, -fatWindow.min * alpha);
+    }
+
+    result.primMatrix = buffers.primMatrix;
+
+    // The smaller levels are built here as well so the GUI thread only has to upload the level that is visible
+    TiledTexture::buildPyramid(result.primMatrix, buffers.primPyramid);
+    result.primPyramid = buffers.primPyramid;
+
+    return result;
 }
 
-void CoronalSliceWidget::updateTexture()
+void CoronalSliceWidget::requestSlice()
 {
-    cv::Mat matrix;
-    // Get the slice for the fat image. If the result is empty then there was an error retrieving the slice
-    matrix = fatImage->getCoronalSlice(location.y(), true);
-    if (matrix.empty())
+    // Everything the job needs is copied since it runs on another thread. The volume is a shallow copy which keeps the data
+    // alive if a new image is loaded while the job is running
+    const cv::Mat fatVolume = fatImage->getRegion({ cv::Range::all(), cv::Range::all(), cv::Range::all() });
+    // This starts building the transposed volume the first time, the slices are read from the fat volume until it is ready
+    const cv::Mat fatTransposed = fatImage->getTransposedData();
+    const int y = location.y();
+    const IntensityWindow fatWindow = fatImage->getCoronalWindow(y, windowMode);
+    // The job keeps the buffers in use until its result is no longer displayed
+    const SliceBuffers buffers = bufferPool.acquire();
+
+    sliceScheduler->request([=]()
     {
-        qWarning() << "Unable to retrieve coronal slice " << location.y() << " from the fat image. Matrix returned empty.";
+        return prepareSlice(fatVolume, fatTransposed, fatWindow, y, buffers);
+    });
+
+    dirty &= ~Dirty::Slice;
+}
+
+void CoronalSliceWidget::updateTexture(const SliceResult &result)
+{
+    // An empty result means there was an error preparing the slice, the warning is shown in prepareSlice
+    if (result.primMatrix.empty())
         return;
+
+    // The tiles are uploaded from the matrix the next time they are drawn and visible
+    sliceTexture->setImage(result.primPyramid);
+}
+
+cv::Mat CoronalSliceWidget::packTraceRows(int z, int yStart, int yEnd) const
+{
+    const int xDim = fatImage->getXDim();
+    cv::Mat packed(yEnd - yStart, xDim, CV_8UC1, cv::Scalar(0));
+
+    const cv::Range region[] = { cv::Range(z, z + 1), cv::Range(yStart, yEnd), cv::Range::all() };
+    int dims[] = { yEnd - yStart, xDim };
+
+    // Each layer sets its bit wherever it is traced, the layer itself is used as the mask
+    for (int i = 0; i < (int)TracingLayer::Count; ++i)
+    {
+        const cv::Mat rows = cv::Mat((*tracingData)[i].data, region).reshape(0, 2, dims);
+        cv::bitwise_or(packed, cv::Scalar(1 << i), packed, rows);
     }
 
-    // The normalize function does quite a bit here. It converts the matrix to a 32-bit float and normalizes it
-    // between 0.0f to 1.0f based on the min/max value. This does not affect the original 3D matrix in fatImage
-    cv::normalize(matrix.clone(), matrix, 0.0f, 1.0f, cv::NORM_MINMAX, CV_32FC1);
-
-    // Bind the texture and setup the parameters for it
-    glBindTexture(GL_TEXTURE_2D, sliceTexture);
-    // These parameters basically say the pixel value is equal to the average of the nearby pixel values when magnifying or minifying the values
-    // Essentially, when stretching or shrinking the texture to the screen, it will smooth out the pixel values instead of making it look blocky
-    // like GL_NEAREST would.
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glCheckError();
+    return packed;
+}
+
+void CoronalSliceWidget::updateTraceVolume()
+{
+    dirty &= ~Dirty::TracesAll;
+    traceRowQueue.clear();
+
+    if (!tracingData || !(*tracingData)[TracingLayer::EAT].isLoaded())
+        return;
 
-    // Get the OpenGL datatype of the matrix
-    auto dataType = NumericType::OpenCV(matrix.type());
-    // Upload the texture data from the matrix to the texture. The internal format is 32 bit floats with one channel for red
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_R32F, fatImage->getXDim(), fatImage->getZDim(), 0, dataType->openGLFormat, dataType->openGLType, matrix.data);
+    const int xDim = fatImage->getXDim();
+    const int yDim = fatImage->getYDim();
+    const int zDim = fatImage->getZDim();
 
-    // If it hasnt been initialized yet or needs to be reinitialized to a different size, use glTexImage2D, otherwise use
-    // the quicker method glTexSubImage2D which just overwrites old data
-    if (!sliceTextureInit)
+    GLint max3DTextureSize;
+    glGetIntegerv(GL_MAX_3D_TEXTURE_SIZE, &max3DTextureSize);
+    if (xDim > max3DTextureSize || yDim > max3DTextureSize || zDim > max3DTextureSize)
     {
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_R32F, fatImage->getXDim(), fatImage->getZDim(), 0, dataType->openGLFormat, dataType->openGLType, matrix.data);
-        sliceTextureInit = true;
+        qWarning() << "Unable to show traces in the coronal view. The volume is larger than the maximum 3D texture size of "
+                   << max3DTextureSize;
+
+        glDeleteTextures(1, &traceVolumeTexture);
+        traceVolumeTexture = 0;
+        return;
+    }
+
+    if (!traceVolumeTexture)
+    {
+        glGenTextures(1, &traceVolumeTexture);
+        glBindTexture(GL_TEXTURE_3D, traceVolumeTexture);
+
+        // Integer textures can not be filtered, each fragment reads the bits of the nearest voxel
+        glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
     }
     else
-        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, fatImage->getXDim(), fatImage->getZDim(), dataType->openGLFormat, dataType->openGLType, matrix.data);
+    {
+        glBindTexture(GL_TEXTURE_3D, traceVolumeTexture);
+    }
+
+    // Allocate the volume and then upload it one axial slice at a time so that only one packed slice is in memory
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage3D(GL_TEXTURE_3D, 0, GL_R8UI, xDim, yDim, zDim, 0, GL_RED_INTEGER, GL_UNSIGNED_BYTE, NULL);
 
+    for (int z = 0; z < zDim; ++z)
+    {
+        const cv::Mat packed = packTraceRows(z, 0, yDim);
+        glTexSubImage3D(GL_TEXTURE_3D, 0, 0, 0, z, xDim, yDim, 1, GL_RED_INTEGER, GL_UNSIGNED_BYTE, packed.data);
+    }
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glBindTexture(GL_TEXTURE_3D, 0);
     glCheckError();
+}
 
-    dirty &= ~Dirty::Slice;
+void CoronalSliceWidget::updateTraceRows()
+{
+    if (!traceVolumeTexture)
+    {
+        traceRowQueue.clear();
+        return;
+    }
+
+    const int xDim = fatImage->getXDim();
+    const int yDim = fatImage->getYDim();
+
+    // Strokes queue the same rows many times, sorting them also puts adjacent rows of a slice next to each other
+    std::sort(std::begin(traceRowQueue), std::end(traceRowQueue));
+    traceRowQueue.erase(std::unique(std::begin(traceRowQueue), std::end(traceRowQueue)), std::end(traceRowQueue));
+
+    glBindTexture(GL_TEXTURE_3D, traceVolumeTexture);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    // Adjacent rows of the same axial slice are uploaded together
+    for (size_t i = 0; i < traceRowQueue.size();)
+    {
+        const int z = traceRowQueue[i] / yDim;
+        const int yStart = traceRowQueue[i] % yDim;
+        int yEnd = yStart + 1;
+
+        for (++i; i < traceRowQueue.size() && traceRowQueue[i] == z * yDim + yEnd; ++i)
+            ++yEnd;
+
+        const cv::Mat packed = packTraceRows(z, yStart, yEnd);
+        glTexSubImage3D(GL_TEXTURE_3D, 0, 0, yStart, z, xDim, yEnd - yStart, 1, GL_RED_INTEGER, GL_UNSIGNED_BYTE, packed.data);
+    }
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glBindTexture(GL_TEXTURE_3D, 0);
+    glCheckError();
+
+    traceRowQueue.clear();
+}
+
+void CoronalSliceWidget::queueTraceRows(int z, int yStart, int yEnd)
+{
+    if (!isLoaded())
+        return;
+
+    const int yDim = fatImage->getYDim();
+    for (int y = std::max(yStart, 0); y < std::min(yEnd, yDim); ++y)
+        traceRowQueue.push_back(z * yDim + y);
+
+    // The rows are always uploaded on the next frame but the view only needs to be drawn again if the coronal slice that is
+    // shown was edited
+    if (location.y() >= yStart && location.y() < yEnd)
+        update();
+}
+
+void CoronalSliceWidget::queueTraceVolume()
+{
+    dirty |= Dirty::TracesAll;
+    update();
 }
 
 void CoronalSliceWidget::resizeGL(int w, int h)
@@ -313,9 +559,20 @@ void CoronalSliceWidget::paintGL()
     if (!isLoaded())
         return;
 
-    // Update relevant OpenGL objects if dirty
+    // The slice is prepared on a worker thread when it changes. The texture is updated on the frame after it is ready and
+    // older requests that were not started are dropped, so the display catches up to the latest slice without lagging behind
     if (dirty & Dirty::Slice)
-        updateTexture();
+        requestSlice();
+
+    SliceResult sliceResult;
+    if (sliceScheduler->takeResult(sliceResult))
+        updateTexture(sliceResult);
+
+    // The entire trace volume is only uploaded when the image or tracing data is loaded, otherwise just the edited rows are
+    if (dirty & Dirty::TracesAll)
+        updateTraceVolume();
+    else if (!traceRowQueue.empty())
+        updateTraceRows();
 
     // After updating, begin rendering
     QPainter painter(this);
@@ -327,32 +584,63 @@ void CoronalSliceWidget::paintGL()
     // Calculate the ModelViewProjection (MVP) matrix to transform the location of the axial slices
     QMatrix4x4 mvpMatrix = getMVPMatrix();
 
-    program->bind();
-    program->setUniformValue("MVP", mvpMatrix);
+    // The slice program shared with the axial widget is used, the coronal slice is always drawn with the gray color map
+    QOpenGLShaderProgram *sliceProgram = resources->getSliceProgram();
+    sliceProgram->bind();
+    sliceProgram->setUniformValue("opacity", 1.0f);
 
-    // Bind the VAO, bind texture to GL_TEXTURE0, bind VBO, bind IBO
-    // The program that is bound is the index of the curColorMap.
-    glBindVertexArray(sliceVertexObject);
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, sliceTexture);
-    glBindBuffer(GL_ARRAY_BUFFER, sliceVertexBuf);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, sliceIndexBuf);
+    // Bind the VAO (the VBO and IBO are bound by the VAO), bind color map to GL_TEXTURE1
+    // The tiles of the slice are bound to GL_TEXTURE0 when drawing
+    glBindVertexArray(quadVertexObject);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_1D, resources->getColorMapTexture(ColorMap::Gray));
     glCheckError();
 
-    // Draw a triangle strip of 4 elements which is two triangles. The indices are unsigned shorts
-    glDrawElements(GL_TRIANGLE_STRIP, 4, GL_UNSIGNED_SHORT, 0);
+    // Draw the tiles of the slice that are visible
+    sliceTexture->draw(sliceProgram, mvpMatrix);
+
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_1D, 0);
+    glActiveTexture(GL_TEXTURE0);
+    sliceProgram->release();
     glCheckError();
 
+    // Draw the traces of every layer on top of the slice. The trace volume covers the entire slice so the quad is drawn once
+    // with the MVP matrix of the slice
+    if (traceVolumeTexture)
+    {
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+        std::array<QVector4D, (size_t)TracingLayer::Count> traceColors;
+        GLuint visibleLayers = 0;
+        for (int i = 0; i < (int)TracingLayer::Count; ++i)
+        {
+            traceColors[i] = QVector4D(tracingLayerColors[i].redF(), tracingLayerColors[i].greenF(), tracingLayerColors[i].blueF(), tracingLayerColors[i].alphaF());
+            if (tracingLayerVisible[i])
+                visibleLayers |= (1u << i);
+        }
+
+        QOpenGLShaderProgram *traceProgram = resources->getCoronalTraceProgram();
+        traceProgram->bind();
+        traceProgram->setUniformValue("MVP", mvpMatrix);
+        traceProgram->setUniformValue("texTransform", QVector4D(0.0f, 0.0f, 1.0f, 1.0f));
+        traceProgram->setUniformValue("slice", (int)location.y());
+        traceProgram->setUniformValueArray("traceColors", traceColors.data(), (int)traceColors.size());
+        traceProgram->setUniformValue("visibleLayers", visibleLayers);
+
+        glBindTexture(GL_TEXTURE_3D, traceVolumeTexture);
+        glDrawElements(GL_TRIANGLE_STRIP, 4, GL_UNSIGNED_SHORT, 0);
+        glBindTexture(GL_TEXTURE_3D, 0);
+
+        traceProgram->release();
+        glCheckError();
+    }
+
     // Release (unbind) the binded objects in reverse order
     // This is a simple protocol to prevent anything happening to the objects outside of this function without
     // explicitly binding the objects
     glBindVertexArray(0);
-    glBindTexture(GL_TEXTURE_2D, 0);
-    glBindTexture(GL_TEXTURE_1D, 0);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-    program->release();
-    glCheckError();
 
     painter.endNativePainting();
 
@@ -386,9 +674,10 @@ void CoronalSliceWidget::mouseMoveEvent(QMouseEvent *eventMove)
         // Get the delta
         QPointF delta = (curMousePos - lastMousePos_);
 
-        // Push a new move command on the undoStack. This will call the command but also keep track
-        // of it if an undo or redo action is called. redo function is called immediately.
-        undoStack->push(new CoronalMoveCommand(delta, this, moveID));
+        // Move the view directly, the move command for the entire pan is pushed in finishPanGesture
+        translation += QVector3D(delta);
+        panGestureDelta += delta;
+        update();
 
         // Set last mouse position to this one
         lastMousePos = eventMove->pos();
@@ -407,12 +696,17 @@ void CoronalSliceWidget::mousePressEvent(QMouseEvent *eventPress)
     // Since multiple buttons down does not have functionality, the button() function
     // is used and if an additional button is down with functionality, the old button
     // is turned off and the new takes place.
+    // A zoom gesture that is still waiting on its timer is finished so that it is recorded before anything else
+    finishZoomGesture();
+
     if (eventPress->button() == Qt::LeftButton || eventPress->button() == Qt::MiddleButton)
     {
+        // Pressing the other button while panning starts a new pan gesture
+        finishPanGesture();
+
         // Flag to indicate that panning is occuring
         // The starting position is stored so to know how much movement has occurred
         startPan = true;
-        moveID = (((int)moveID + 1) > (int)CommandID::CoronalMoveEnd) ? CommandID::CoronalMove : (CommandID)((int)moveID + 1);
         lastMousePos = eventPress->pos();
     }
 }
@@ -424,7 +718,7 @@ void CoronalSliceWidget::mouseReleaseEvent(QMouseEvent *eventRelease)
 
     if ((eventRelease->button() == Qt::LeftButton || eventRelease->button() == Qt::MiddleButton) && startPan)
     {
-        startPan = false;
+        finishPanGesture();
     }
 }
 
@@ -442,23 +736,39 @@ void CoronalSliceWidget::wheelEvent(QWheelEvent *event)
         // Zoom in 5% every 15 degrees which is one step on most mouses
         float scaleDelta = numDegrees.y() * (0.05f / 15);
 
-        // Clamp the scaleDelta so that the resulting scaling factor is between 0.05f to 3.0f
-        scaleDelta = std::max(std::min((scaling + scaleDelta), 3.0f), 0.05f) - scaling;
+        // Store the scaling at the start of the gesture so the entire zoom can be undone at once
+        if (!startZoom)
+        {
+            zoomGestureStartScaling = scaling;
+            startZoom = true;
+        }
 
-        // Push a new scale command on the undo stack which will immediately call redo for an action.
-        // This keeps track of it if an undo or redo command is called
-        // Only push to the stack if there is a delta
-        if (scaleDelta != 0.0f)
-            undoStack->push(new CoronalScaleCommand(scaleDelta, this));
+        // Clamp the resulting scaling factor between 0.05f to 3.0f and apply it directly to the view
+        scaling = std::max(std::min((scaling + scaleDelta), 3.0f), 0.05f);
+        update();
+
+        // Restart the timer, the scale command is pushed once the wheel has not moved for the timer interval
+        zoomGestureTimer->start();
     }
 }
 
 CoronalSliceWidget::~CoronalSliceWidget()
 {
-    // Destroy the VAO, VBO, and IBO
-    glDeleteVertexArrays(1, &sliceVertexObject);
-    glDeleteBuffers(1, &sliceVertexBuf);
-    glDeleteBuffers(1, &sliceIndexBuf);
-    glDeleteTextures(1, &sliceTexture);
-    delete program;
+    // OpenGL objects are only created once the widget is shown. A widget that was never shown, such as the placeholder from the
+    // UI file that is replaced when switching views, has nothing to destroy
+    if (!resources)
+        return;
+
+    // The context must be current to destroy the OpenGL objects
+    makeCurrent();
+
+    // Destroy the VAO and texture
+    glDeleteVertexArrays(1, &quadVertexObject);
+    delete sliceTexture;
+    glDeleteTextures(1, &traceVolumeTexture);
+
+    // Release the shared resources, these are destroyed if this is the last widget using them
+    resources.reset();
+
+    doneCurrent();
 }
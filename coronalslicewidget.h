@@ -14,6 +14,8 @@
 #include <QMatrix4x4>
 #include <QUndoStack>
 #include <QPainter>
+#include <QTimer>
+#include <array>
 
 #include <nifti1.h>
 #include <nifti1_io.h>
@@ -24,6 +26,11 @@
 #include "vertex.h"
 #include "commands.h"
 #include "displayinfo.h"
+#include "tracing.h"
+#include "slicescheduler.h"
+#include "glresources.h"
+#include "tiledtexture.h"
+#include "slicebufferpool.h"
 
 class CoronalSliceWidget : public QOpenGLWidget, protected QOpenGLFunctions_3_3_Core
 {
@@ -31,20 +38,41 @@ class CoronalSliceWidget : public QOpenGLWidget, protected QOpenGLFunctions_3_3_
 
 private:
     SliceDisplayType displayType;
+    WindowMode windowMode;
 
     NIFTImage *fatImage;
     NIFTImage *waterImage;
+    TracingData *tracingData;
+
+    std::array<QColor, (size_t)TracingLayer::Count> tracingLayerColors;
+    // Layers that are hidden in the axial view are hidden here as well, see AxialSliceWidget::tracingLayerVisibleChanged
+    std::array<bool, (size_t)TracingLayer::Count> tracingLayerVisible;
 
     // Each bit represents whether the specified item in Dirty enum needs to be updated on drawing
     int dirty;
 
-    QOpenGLShaderProgram *program;
-    GLuint sliceVertexBuf, sliceIndexBuf;
-    GLuint sliceVertexObject;
-    GLuint sliceTexture;
-    QVector<VertexPT> sliceVertices;
-    QVector<unsigned short> sliceIndices;
-    bool sliceTextureInit;
+    // Shader programs, quad buffers and color maps shared with the other slice widgets
+    std::shared_ptr<GLResources> resources;
+
+    // VAO for the shared quad
+    GLuint quadVertexObject;
+
+    // The coronal slice is split into tiles because the X by Z slice of a stitched volume can be larger than the maximum
+    // texture size
+    TiledTexture *sliceTexture;
+    // Number of levels of detail the slice is drawn below the level that matches the screen, see TiledTexture
+    int levelBias;
+
+    // Every tracing layer packed into one bit of each voxel (x, y, z), the coronal slice is sampled from it in the shader so
+    // moving the coronal location does not upload anything. Rows of the axial slices that were edited are queued as
+    // z * yDim + y and only those rows are uploaded before the next frame. The texture is zero if the volume is too large
+    GLuint traceVolumeTexture;
+    std::vector<int> traceRowQueue;
+
+    // Prepares the slice texture on a worker thread, only the latest requested slice is kept when scrubbing through slices
+    SliceScheduler *sliceScheduler;
+    // Matrices that the slices are prepared into, these are reused so scrubbing through slices does not allocate
+    SliceBufferPool bufferPool;
 
     // Location of where the user is viewing.
     // The format is (X, Y, Z, T) where T is time
@@ -52,7 +80,17 @@ private:
 
     bool startPan;
     QPoint lastMousePos;
-    CommandID moveID;
+
+    // Pan and zoom change the view directly and one command is pushed for the entire gesture once it is finished. The pan
+    // gesture delta is the total movement since the button was pressed. A zoom gesture is finished once no wheel events
+    // have been received for the interval of the zoom gesture timer
+    QPointF panGestureDelta;
+    bool startZoom;
+    float zoomGestureStartScaling;
+    QTimer *zoomGestureTimer;
+
+    // If false, pan, zoom and reset view are not recorded in the undo history
+    bool recordViewHistory;
 
     QMatrix4x4 projectionMatrix;
     QMatrix4x4 viewMatrix;
@@ -74,7 +112,7 @@ public:
     QVector4D getLocation() const;
     QVector4D transformLocation(QVector4D location) const;
 
-    void setup(NIFTImage *fat, NIFTImage *water);
+    void setup(NIFTImage *fat, NIFTImage *water, TracingData *tracing);
     bool isLoaded() const;
 
     // Performs actions when a new image is loaded
@@ -83,11 +121,25 @@ public:
     SliceDisplayType getDisplayType() const;
     void setDisplayType(SliceDisplayType type);
 
+    WindowMode getWindowMode() const;
+    void setWindowMode(WindowMode mode);
+
+    int getLevelBias() const;
+    void setLevelBias(int bias);
+
     void resetView();
 
+    bool getRecordViewHistory() const;
+    void setRecordViewHistory(bool record);
+
+    void finishPanGesture();
+
     float &rscaling();
     QVector3D &rtranslation();
 
+    // Counters of the slice buffers, the steady state is to only reuse the sets that were reserved
+    const SliceBufferPool &getBufferPool() const;
+
     QMatrix4x4 getMVPMatrix() const;
 
     QMatrix4x4 getWindowToNIFTIMatrix(bool includeMVP = true) const;
@@ -98,7 +150,24 @@ public:
 
     void setDirty(int bit);
 
-    void updateTexture();
+    // The transposed volume is the {y, z, x} copy from NIFTImage::getTransposedData and is used instead of the fat volume if
+    // it is not empty
+    static SliceResult prepareSlice(cv::Mat fatVolume, cv::Mat fatTransposed, IntensityWindow fatWindow, int y, SliceBuffers buffers);
+    void requestSlice();
+    void updateTexture(const SliceResult &result);
+
+    // Packs the tracing layers of rows yStart to yEnd (exclusive) of axial slice z into one byte per voxel
+    cv::Mat packTraceRows(int z, int yStart, int yEnd) const;
+    void updateTraceVolume();
+    void updateTraceRows();
+
+public slots:
+    void finishZoomGesture();
+
+    void queueTraceRows(int z, int yStart, int yEnd);
+    void queueTraceVolume();
+
+    void setTracingLayerVisible(int layer, bool visible);
 
 protected:
     void initializeGL();
@@ -0,0 +1,296 @@
+#include "depotstatistics.h"
+
+constexpr int DepotSums::histogramBins;
+
+DepotSums &DepotSums::operator+=(const DepotSums &other)
+{
+    count += other.count;
+    fatSum += other.fatSum;
+    fractionSum += other.fractionSum;
+    fractionSumSq += other.fractionSumSq;
+
+    for (int i = 0; i < histogramBins; ++i)
+        histogram[i] += other.histogram[i];
+
+    return *this;
+}
+
+/* sumSlice adds the voxels of each layer mask on the fat and water slices to sums, which has one entry per layer. The
+ * fat fraction of each row is computed once and the masks are applied as 0 or 1 multipliers so that the inner loops do
+ * not branch.
+ */
+template <typename T>
+static void sumSlice(const cv::Mat &fat, const cv::Mat &water, const std::array<cv::Mat, (int)TracingLayer::Count> &masks,
+                     DepotSums *sums)
+{
+    const int yDim = fat.rows;
+    const int xDim = fat.cols;
+
+    std::vector<float> fatRow(xDim);
+    std::vector<float> fraction(xDim);
+
+    for (int y = 0; y < yDim; ++y)
+    {
+        const T *fatPtr = fat.ptr<T>(y);
+        const T *waterPtr = water.ptr<T>(y);
+
+        bool anyMasked = false;
+        for (const cv::Mat &mask : masks)
+        {
+            const unsigned char *maskPtr = mask.ptr<unsigned char>(y);
+            anyMasked = anyMasked || (std::find_if(maskPtr, maskPtr + xDim, [](unsigned char v) { return v != 0; }) != maskPtr + xDim);
+        }
+
+        // Most rows are outside of every depot
+        if (!anyMasked)
+            continue;
+
+        for (int x = 0; x < xDim; ++x)
+        {
+            const float fatValue = (float)fatPtr[x];
+            const float total = fatValue + (float)waterPtr[x];
+
+            fatRow[x] = fatValue;
+            fraction[x] = (total > 0.0f) ? std::min(std::max(fatValue / total, 0.0f), 1.0f) : 0.0f;
+        }
+
+        for (int i = 0; i < (int)TracingLayer::Count; ++i)
+        {
+            const unsigned char *maskPtr = masks[i].ptr<unsigned char>(y);
+
+            int count = 0;
+            float fatSum = 0.0f;
+            float fractionSum = 0.0f;
+            float fractionSumSq = 0.0f;
+
+            for (int x = 0; x < xDim; ++x)
+            {
+                const int set = maskPtr[x] & 1;
+                const float weight = (float)set;
+
+                count += set;
+                fatSum += weight * fatRow[x];
+                fractionSum += weight * fraction[x];
+                fractionSumSq += weight * fraction[x] * fraction[x];
+            }
+
+            if (count == 0)
+                continue;
+
+            DepotSums &layerSums = sums[i];
+            layerSums.count += count;
+            layerSums.fatSum += fatSum;
+            layerSums.fractionSum += fractionSum;
+            layerSums.fractionSumSq += fractionSumSq;
+
+            for (int x = 0; x < xDim; ++x)
+            {
+                if (maskPtr[x])
+                    ++layerSums.histogram[std::min((int)(fraction[x] * DepotSums::histogramBins), DepotSums::histogramBins - 1)];
+            }
+        }
+    }
+}
+
+DepotStatistics::DepotStatistics() : fatImage(NULL), waterImage(NULL), tracingData(NULL), voxelVolume(0.0), slices(), totals()
+{
+}
+
+void DepotStatistics::setup(NIFTImage *fat, NIFTImage *water, TracingData *tracing)
+{
+    fatImage = fat;
+    waterImage = water;
+    tracingData = tracing;
+    clear();
+}
+
+/* compute finds the sums of every tracing layer on every axial slice. The slices are split up and computed in parallel.
+ *
+ * Returns:
+ *      true - No error occurred and the statistics were computed
+ *      false - No image is loaded or the fat and water images do not match the tracing data
+ */
+bool DepotStatistics::compute()
+{
+    if (!fatImage || !fatImage->isLoaded() || !waterImage->isLoaded() || !fatImage->compatible(waterImage) ||
+            (*tracingData)[0].getZDim() != fatImage->getZDim())
+    {
+        clear();
+        return false;
+    }
+
+    const nifti_image *image = fatImage->getUpperImage();
+    voxelVolume = std::fabs(image->dx * image->dy * image->dz) / 1000.0;
+
+    slices.assign((size_t)fatImage->getZDim() * (int)TracingLayer::Count, DepotSums());
+
+    cv::parallel_for_(cv::Range(0, fatImage->getZDim()), [&](const cv::Range &range)
+    {
+        for (int z = range.start; z < range.end; ++z)
+            computeSlice(z);
+    });
+
+    updateTotals();
+
+    return true;
+}
+
+void DepotStatistics::update(int zStart, int zEnd)
+{
+    if (!isComputed())
+        return;
+
+    zStart = std::max(zStart, 0);
+    zEnd = std::min(zEnd, getZDim());
+
+    for (int z = zStart; z < zEnd; ++z)
+    {
+        std::fill(slices.begin() + z * (int)TracingLayer::Count, slices.begin() + (z + 1) * (int)TracingLayer::Count, DepotSums());
+        computeSlice(z);
+    }
+
+    updateTotals();
+}
+
+void DepotStatistics::clear()
+{
+    slices.clear();
+    totals.fill(DepotSums());
+}
+
+void DepotStatistics::computeSlice(int z)
+{
+    const int dims[] = { fatImage->getYDim(), fatImage->getXDim() };
+
+    const cv::Mat fat = fatImage->getAxialSlice(z).reshape(0, 2, dims);
+    cv::Mat water = waterImage->getAxialSlice(z).reshape(0, 2, dims);
+
+    // The loops are instantiated for one voxel type, so the water slice is converted if its type is different
+    if (water.type() != fat.type())
+        water.convertTo(water, fat.type());
+
+    std::array<cv::Mat, (int)TracingLayer::Count> masks;
+    for (int i = 0; i < (int)TracingLayer::Count; ++i)
+        masks[i] = (*tracingData)[i].getAxialSlice(z).reshape(0, 2, dims);
+
+    DepotSums *sums = &slices[z * (int)TracingLayer::Count];
+
+    switch (fat.depth())
+    {
+        case CV_8U: sumSlice<uint8_t>(fat, water, masks, sums); break;
+        case CV_8S: sumSlice<int8_t>(fat, water, masks, sums); break;
+        case CV_16U: sumSlice<uint16_t>(fat, water, masks, sums); break;
+        case CV_16S: sumSlice<int16_t>(fat, water, masks, sums); break;
+        case CV_32S: sumSlice<int32_t>(fat, water, masks, sums); break;
+        case CV_32F: sumSlice<float>(fat, water, masks, sums); break;
+        case CV_64F: sumSlice<double>(fat, water, masks, sums); break;
+
+        default:
+            qWarning() << "Unable to compute depot statistics for images of type " << fat.type();
+            break;
+    }
+}
+
+void DepotStatistics::updateTotals()
+{
+    totals.fill(DepotSums());
+
+    for (size_t i = 0; i < slices.size(); ++i)
+        totals[i % (int)TracingLayer::Count] += slices[i];
+}
+
+bool DepotStatistics::isComputed() const
+{
+    return !slices.empty();
+}
+
+int DepotStatistics::getZDim() const
+{
+    return (int)(slices.size() / (int)TracingLayer::Count);
+}
+
+DepotSummary DepotStatistics::getSlice(TracingLayer layer, int z) const
+{
+    if (z < 0 || z >= getZDim())
+        return summarize(DepotSums(), voxelVolume);
+
+    return summarize(slices[z * (int)TracingLayer::Count + (int)layer], voxelVolume);
+}
+
+DepotSummary DepotStatistics::getVolume(TracingLayer layer) const
+{
+    return summarize(totals[(int)layer], voxelVolume);
+}
+
+/* writeTable writes a header line and a row for each layer of the volume followed by a row for each layer of each slice
+ * that has traced voxels. The slice column is "All" for the rows of the volume. The last columns are the fat fraction
+ * histogram.
+ */
+void DepotStatistics::writeTable(QTextStream &stream) const
+{
+    stream << "Layer,Slice,Voxels,Volume (mL),Fat Signal,Mean Fat Fraction,Median Fat Fraction,Std Dev Fat Fraction";
+    for (int i = 0; i < DepotSums::histogramBins; ++i)
+        stream << "," << QString("FF %1-%2%").arg(i * 100 / DepotSums::histogramBins).arg((i + 1) * 100 / DepotSums::histogramBins);
+    stream << "\n";
+
+    auto writeRow = [&](int layer, QString slice, const DepotSummary &summary)
+    {
+        stream << tracingLayerName((TracingLayer)layer) << "," << slice << "," << summary.count << "," << summary.volume << "," << summary.fatSignal << ","
+               << summary.meanFatFraction << "," << summary.medianFatFraction << "," << summary.stddevFatFraction;
+
+        for (int bin : summary.histogram)
+            stream << "," << bin;
+        stream << "\n";
+    };
+
+    for (int i = 0; i < (int)TracingLayer::Count; ++i)
+        writeRow(i, "All", getVolume((TracingLayer)i));
+
+    for (int z = 0; z < getZDim(); ++z)
+    {
+        for (int i = 0; i < (int)TracingLayer::Count; ++i)
+        {
+            if (slices[z * (int)TracingLayer::Count + i].count > 0)
+                writeRow(i, QString::number(z), getSlice((TracingLayer)i, z));
+        }
+    }
+}
+
+/* summarize computes the statistics of a depot from its sums. The standard deviation is of the population. If the depot
+ * has no voxels, the statistics are zero.
+ */
+DepotSummary DepotStatistics::summarize(const DepotSums &sums, double voxelVolume)
+{
+    DepotSummary summary;
+    summary.count = sums.count;
+    summary.volume = sums.count * voxelVolume;
+    summary.fatSignal = sums.fatSum;
+    summary.histogram = sums.histogram;
+    summary.meanFatFraction = 0.0;
+    summary.medianFatFraction = 0.0;
+    summary.stddevFatFraction = 0.0;
+
+    if (sums.count == 0)
+        return summary;
+
+    const double count = (double)sums.count;
+    summary.meanFatFraction = sums.fractionSum / count;
+    summary.stddevFatFraction = std::sqrt(std::max(sums.fractionSumSq / count - summary.meanFatFraction * summary.meanFatFraction, 0.0));
+
+    // Walk the cumulative histogram to the bin with the middle voxel and interpolate within the bin
+    const double half = count / 2.0;
+    double before = 0.0;
+
+    for (int i = 0; i < DepotSums::histogramBins; ++i)
+    {
+        if (before + sums.histogram[i] >= half)
+        {
+            summary.medianFatFraction = (i + (half - before) / sums.histogram[i]) / DepotSums::histogramBins;
+            break;
+        }
+
+        before += sums.histogram[i];
+    }
+
+    return summary;
+}
@@ -0,0 +1,101 @@
+#ifndef DEPOTSTATISTICS_H
+#define DEPOTSTATISTICS_H
+
+#include <QDebug>
+#include <QString>
+#include <QTextStream>
+#include <vector>
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+#include <opencv2/opencv.hpp>
+
+#include "displayinfo.h"
+#include "niftimage.h"
+#include "tracing.h"
+
+// Sums of the voxels of one tracing layer on one axial slice, or on the whole volume when the slices are added together
+struct DepotSums
+{
+    // Number of bins of the fat fraction histogram from 0 to 1
+    static constexpr int histogramBins = 100;
+
+    size_t count;
+    double fatSum;
+    double fractionSum;
+    double fractionSumSq;
+    std::array<int, histogramBins> histogram;
+
+    DepotSums() : count(0), fatSum(0.0), fractionSum(0.0), fractionSumSq(0.0) { histogram.fill(0); }
+
+    DepotSums &operator+=(const DepotSums &other);
+};
+
+// Statistics of one depot on one axial slice or on the whole volume. The fat fraction is fat / (fat + water) from 0 to 1
+struct DepotSummary
+{
+    size_t count;
+    // Volume of the depot in mL
+    double volume;
+    // Sum of the fat intensities of the depot
+    double fatSignal;
+
+    double meanFatFraction;
+    double medianFatFraction;
+    double stddevFatFraction;
+
+    std::array<int, DepotSums::histogramBins> histogram;
+};
+
+/* DepotStatistics computes the fat signal and fat fraction statistics of each tracing layer (depot) on the stitched fat
+ * and water images. The sums are kept for each layer of each axial slice, so when a slice is edited only that slice is
+ * computed again and the statistics of the volume are the sums of the slices.
+ *
+ * The slices are computed in parallel. For each row, the fat fraction is computed once into a buffer and then the masked
+ * sums of each layer are taken over the buffer with the mask as a 0 or 1 multiplier instead of a branch, so the loops can
+ * be vectorized. The loops are instantiated for each voxel type of the images.
+ *
+ * The median is read from the histogram and is interpolated within its bin, so it is accurate to 1 / histogramBins.
+ */
+class DepotStatistics
+{
+private:
+    NIFTImage *fatImage;
+    NIFTImage *waterImage;
+    TracingData *tracingData;
+
+    // Volume of one voxel in mL
+    double voxelVolume;
+
+    // Sums for each axial slice stored as zDim x TracingLayer::Count
+    std::vector<DepotSums> slices;
+    std::array<DepotSums, (int)TracingLayer::Count> totals;
+
+    void computeSlice(int z);
+    void updateTotals();
+
+public:
+    DepotStatistics();
+
+    void setup(NIFTImage *fat, NIFTImage *water, TracingData *tracing);
+
+    // Computes the sums of every slice. Returns false if no image is loaded
+    bool compute();
+    // Computes the sums of slices zStart to zEnd (exclusive) again after they were edited
+    void update(int zStart, int zEnd);
+    void clear();
+
+    bool isComputed() const;
+    int getZDim() const;
+
+    DepotSummary getSlice(TracingLayer layer, int z) const;
+    DepotSummary getVolume(TracingLayer layer) const;
+
+    // Writes the statistics of each layer for the volume and each traced slice as comma-separated values
+    void writeTable(QTextStream &stream) const;
+
+    static DepotSummary summarize(const DepotSums &sums, double voxelVolume);
+};
+
+#endif // DEPOTSTATISTICS_H
@@ -0,0 +1,154 @@
+#include "depotstatisticspanel.h"
+
+DepotStatisticsPanel::DepotStatisticsPanel(QWidget *parent) : QWidget(parent), statistics(), table(NULL), saveButton(NULL),
+    slice(0), dirtyStart(0), dirtyEnd(0), stale(true), updateTimer()
+{
+    setWindowTitle(tr("Depot Statistics"));
+
+    table = new QTableWidget((int)TracingLayer::Count, 10, this);
+    table->setHorizontalHeaderLabels({ tr("Slice Volume (mL)"), tr("Slice Fat Signal"), tr("Slice Mean FF"),
+                                       tr("Slice Median FF"), tr("Slice Std Dev FF"), tr("Volume (mL)"), tr("Fat Signal"),
+                                       tr("Mean FF"), tr("Median FF"), tr("Std Dev FF") });
+    table->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    table->horizontalHeader()->setSectionResizeMode(QHeaderView::ResizeToContents);
+
+    for (int i = 0; i < (int)TracingLayer::Count; ++i)
+    {
+        table->setVerticalHeaderItem(i, new QTableWidgetItem(tracingLayerName((TracingLayer)i)));
+
+        for (int j = 0; j < table->columnCount(); ++j)
+        {
+            QTableWidgetItem *item = new QTableWidgetItem();
+            item->setTextAlignment(Qt::AlignRight | Qt::AlignVCenter);
+            table->setItem(i, j, item);
+        }
+    }
+
+    saveButton = new QPushButton(tr("Save Table..."), this);
+
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    layout->addWidget(table);
+    layout->addWidget(saveButton, 0, Qt::AlignRight);
+
+    // Edits are collected until no slice has been edited for this long
+    updateTimer.setSingleShot(true);
+    updateTimer.setInterval(100);
+
+    connect(&updateTimer, SIGNAL(timeout()), this, SLOT(updateTimer_timeout()));
+    connect(saveButton, SIGNAL(clicked()), this, SLOT(saveButton_clicked()));
+
+    resize(900, 260);
+}
+
+void DepotStatisticsPanel::setup(NIFTImage *fat, NIFTImage *water, TracingData *tracing)
+{
+    statistics.setup(fat, water, tracing);
+    tracesReset();
+}
+
+void DepotStatisticsPanel::setSlice(int z)
+{
+    slice = z;
+
+    if (isVisible())
+        updateTable();
+}
+
+void DepotStatisticsPanel::traceRowsChanged(int z, int yStart, int yEnd)
+{
+    (void)yStart;
+    (void)yEnd;
+
+    if (stale)
+        return;
+
+    if (dirtyStart >= dirtyEnd)
+    {
+        dirtyStart = z;
+        dirtyEnd = z + 1;
+    }
+    else
+    {
+        dirtyStart = std::min(dirtyStart, z);
+        dirtyEnd = std::max(dirtyEnd, z + 1);
+    }
+
+    updateTimer.start();
+}
+
+void DepotStatisticsPanel::tracesReset()
+{
+    stale = true;
+    updateTimer.stop();
+    dirtyStart = dirtyEnd = 0;
+
+    if (isVisible())
+    {
+        statistics.compute();
+        stale = false;
+        updateTable();
+    }
+}
+
+void DepotStatisticsPanel::showEvent(QShowEvent *event)
+{
+    QWidget::showEvent(event);
+
+    // Edits made while the panel was hidden were not tracked
+    if (stale || !statistics.isComputed())
+        tracesReset();
+}
+
+void DepotStatisticsPanel::updateTimer_timeout()
+{
+    if (!isVisible())
+    {
+        stale = true;
+        return;
+    }
+
+    statistics.update(dirtyStart, dirtyEnd);
+    dirtyStart = dirtyEnd = 0;
+
+    updateTable();
+}
+
+void DepotStatisticsPanel::updateTable()
+{
+    for (int i = 0; i < (int)TracingLayer::Count; ++i)
+    {
+        const DepotSummary summaries[] = { statistics.getSlice((TracingLayer)i, slice), statistics.getVolume((TracingLayer)i) };
+
+        for (int j = 0; j < 2; ++j)
+        {
+            const DepotSummary &summary = summaries[j];
+            const int column = j * 5;
+
+            table->item(i, column)->setText(QString::number(summary.volume, 'f', 2));
+            table->item(i, column + 1)->setText(QString::number(summary.fatSignal, 'g', 6));
+            table->item(i, column + 2)->setText(QString::number(summary.meanFatFraction, 'f', 3));
+            table->item(i, column + 3)->setText(QString::number(summary.medianFatFraction, 'f', 3));
+            table->item(i, column + 4)->setText(QString::number(summary.stddevFatFraction, 'f', 3));
+        }
+    }
+}
+
+void DepotStatisticsPanel::saveButton_clicked()
+{
+    if (!statistics.isComputed())
+        return;
+
+    QString filename = QFileDialog::getSaveFileName(this, "Save Depot Statistics", QString(), "Comma-Separated Values (*.csv)");
+    if (filename.isNull())
+        return;
+
+    QFile file(filename);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text))
+    {
+        qWarning() << "Unable to open depot statistics file: " << filename;
+        return;
+    }
+
+    QTextStream stream(&file);
+    statistics.writeTable(stream);
+}
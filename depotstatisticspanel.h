@@ -0,0 +1,61 @@
+#ifndef DEPOTSTATISTICSPANEL_H
+#define DEPOTSTATISTICSPANEL_H
+
+#include <QWidget>
+#include <QTableWidget>
+#include <QHeaderView>
+#include <QPushButton>
+#include <QVBoxLayout>
+#include <QFileDialog>
+#include <QTimer>
+#include <QDebug>
+
+#include "depotstatistics.h"
+
+/* DepotStatisticsPanel is a tool window that shows the statistics of each depot on the current axial slice and on the
+ * whole volume. It is kept live by connecting the traceRowsChanged and tracesReset signals of the axial slice widget to
+ * it. The edited slices are collected and computed again shortly after the last edit, so drawing a stroke does not
+ * compute the slice for every point.
+ *
+ * The statistics are only computed while the panel is visible. When it is shown again the whole volume is computed.
+ */
+class DepotStatisticsPanel : public QWidget
+{
+    Q_OBJECT
+
+private:
+    DepotStatistics statistics;
+
+    QTableWidget *table;
+    QPushButton *saveButton;
+
+    int slice;
+
+    // Range of slices (exclusive end) edited since the statistics were last updated
+    int dirtyStart;
+    int dirtyEnd;
+    bool stale;
+    QTimer updateTimer;
+
+    void updateTable();
+
+protected:
+    void showEvent(QShowEvent *event);
+
+public:
+    explicit DepotStatisticsPanel(QWidget *parent = NULL);
+
+    void setup(NIFTImage *fat, NIFTImage *water, TracingData *tracing);
+
+public slots:
+    void setSlice(int z);
+
+    void traceRowsChanged(int z, int yStart, int yEnd);
+    void tracesReset();
+
+private slots:
+    void updateTimer_timeout();
+    void saveButton_clicked();
+};
+
+#endif // DEPOTSTATISTICSPANEL_H
@@ -1,6 +1,8 @@
 #ifndef DISPLAYINFO_H
 #define DISPLAYINFO_H
 
+#include <QString>
+
 enum class SliceDisplayType : int
 {
     FatOnly,
@@ -34,28 +36,6 @@ enum class ColorMap : int
     Count
 };
 
-static QString colorMapImageName[(int)ColorMap::Count] =
-{
-    ":/colormaps/MATLAB_autumn.png",
-    ":/colormaps/MATLAB_bone.png",
-    ":/colormaps/MATLAB_cool.png",
-    ":/colormaps/MATLAB_copper.png",
-    ":/colormaps/MATLAB_gray.png",
-    ":/colormaps/MATLAB_hot.png",
-    ":/colormaps/MATLAB_hsv.png",
-    ":/colormaps/MATLAB_jet.png",
-    ":/colormaps/MATLAB_parula.png",
-    ":/colormaps/MATLAB_pink.png",
-    ":/colormaps/MATLAB_spring.png",
-    ":/colormaps/MATLAB_summer.png",
-    ":/colormaps/MATLAB_winter.png",
-    ":/colormaps/red.png",
-    ":/colormaps/green.png",
-    ":/colormaps/blue.png",
-    ":/colormaps/redWhite.png",
-    ":/colormaps/greenWhite.png"
-};
-
 enum Location : int
 {
     NoChange = -1
@@ -72,12 +52,28 @@ enum class TracingLayer : int
     Count
 };
 
+// Abbreviation of a tracing layer, used for table headers, CSV output and label filenames
+inline QString tracingLayerName(TracingLayer layer)
+{
+    switch (layer)
+    {
+        case TracingLayer::EAT: return "EAT";
+        case TracingLayer::IMAT: return "IMAT";
+        case TracingLayer::PAAT: return "PAAT";
+        case TracingLayer::PAT: return "PAT";
+        case TracingLayer::SCAT: return "SCAT";
+        case TracingLayer::VAT: return "VAT";
+        default: return QString();
+    }
+}
+
 namespace Dirty
 {
-    constexpr int Slice                 = 1 << 1,
+    constexpr int Scene                 = 1 << 0, // Cached composite of the slice and traces needs to be rendered again
+                  Slice                 = 1 << 1,
                   TracesStart           = 1 << 2,
                   TracesEnd             = 1 << (2 + (int)TracingLayer::Count),
-                  TracesAll             = (2^((int)TracingLayer::Count) - 1) << 2; // Updates each layer (Typically used when loading trace data)
+                  TracesAll             = ((1 << (int)TracingLayer::Count) - 1) << 2; // Updates each layer (Typically used when loading trace data)
 
     constexpr int Trace(TracingLayer layer)
     {
@@ -94,7 +90,22 @@ enum class WindowViewType : int
 enum class DrawMode : int
 {
     Points = 0,
-    Erase
+    Erase,
+    LiveWire
+};
+
+// Range of intensities that is mapped to the color map when a slice is displayed
+enum class WindowMode : int
+{
+    PerSlice = 0,   // Minimum to maximum of the slice
+    Global,         // Minimum to maximum of the volume
+    AutoPercentile  // 1st to 99th percentile of the volume
+};
+
+enum class BrushShape : int
+{
+    Square = 0,
+    Round
 };
 
 #endif // DISPLAYINFO_H
@@ -0,0 +1,195 @@
+#include "glresources.h"
+#include "colormaps.h"
+
+std::weak_ptr<GLResources> GLResources::instance;
+
+GLResources::GLResources() : sliceProgram(NULL), traceProgram(NULL), coronalTraceProgram(NULL), quadVertexBuf(0), quadIndexBuf(0)
+{
+    std::fill(std::begin(colorMapTexture), std::end(colorMapTexture), 0);
+
+    if (!initializeOpenGLFunctions())
+    {
+        qCritical() << "Unable to initialize OpenGL functions for GLResources";
+        return;
+    }
+
+    initializePrograms();
+    initializeQuad();
+}
+
+std::shared_ptr<GLResources> GLResources::acquire()
+{
+    std::shared_ptr<GLResources> resources = instance.lock();
+
+    // Create the resources if this is the first widget or every other widget has released them
+    if (!resources)
+    {
+        resources = std::shared_ptr<GLResources>(new GLResources());
+        instance = resources;
+    }
+
+    return resources;
+}
+
+void GLResources::initializePrograms()
+{
+    // The compiled program binaries are cached on disk by Qt if the driver supports it, so the shaders are only compiled from
+    // source the first time the application is run or when the shaders or driver change
+    sliceProgram = new QOpenGLShaderProgram();
+    sliceProgram->addCacheableShaderFromSourceFile(QOpenGLShader::Vertex, ":/shaders/axialslice.vert");
+    sliceProgram->addCacheableShaderFromSourceFile(QOpenGLShader::Fragment, ":/shaders/axialslice.frag");
+    sliceProgram->link();
+    sliceProgram->bind();
+    if (!sliceProgram->log().isEmpty())
+        qDebug() << "Slice Program Log: " << sliceProgram->log();
+    glCheckError();
+
+    sliceProgram->setUniformValue("tex", 0);
+    sliceProgram->setUniformValue("mappingTexture", 1);
+    sliceProgram->release();
+
+    traceProgram = new QOpenGLShaderProgram();
+    traceProgram->addCacheableShaderFromSourceFile(QOpenGLShader::Vertex, ":/shaders/fattraces.vert");
+    traceProgram->addCacheableShaderFromSourceFile(QOpenGLShader::Fragment, ":/shaders/fattraces.frag");
+    traceProgram->link();
+    traceProgram->bind();
+    if (!traceProgram->log().isEmpty())
+        qDebug() << "Trace Program Log: " << traceProgram->log();
+    glCheckError();
+
+    traceProgram->setUniformValue("tex", 0);
+    traceProgram->release();
+
+    // The coronal traces are sampled from a 3D texture of every layer, the vertex shader is the same as the axial traces
+    coronalTraceProgram = new QOpenGLShaderProgram();
+    coronalTraceProgram->addCacheableShaderFromSourceFile(QOpenGLShader::Vertex, ":/shaders/fattraces.vert");
+    coronalTraceProgram->addCacheableShaderFromSourceFile(QOpenGLShader::Fragment, ":/shaders/coronaltraces.frag");
+    coronalTraceProgram->link();
+    coronalTraceProgram->bind();
+    if (!coronalTraceProgram->log().isEmpty())
+        qDebug() << "Coronal Trace Program Log: " << coronalTraceProgram->log();
+    glCheckError();
+
+    coronalTraceProgram->setUniformValue("traces", 0);
+    coronalTraceProgram->release();
+}
+
+void GLResources::initializeQuad()
+{
+    // Setup the quad vertices, this covers the entire OpenGL coordinate system and is transformed by the MVP matrix of each widget
+    QVector<VertexPT> vertices;
+    vertices.append(VertexPT(QVector3D(-1.0f, -1.0f, 0.0f), QVector2D(0.0f, 0.0f)));
+    vertices.append(VertexPT(QVector3D(-1.0f, 1.0f, 0.0f), QVector2D(0.0f, 1.0f)));
+    vertices.append(VertexPT(QVector3D(1.0f, -1.0f, 0.0f), QVector2D(1.0f, 0.0f)));
+    vertices.append(VertexPT(QVector3D(1.0f, 1.0f, 0.0f), QVector2D(1.0f, 1.0f)));
+
+    // Setup the quad indices
+    QVector<unsigned short> indices;
+    indices.append({ 0, 1, 2, 3});
+
+    // Generate vertex buffer for the quad. The vertices data is uploaded to the VBO
+    glGenBuffers(1, &quadVertexBuf);
+    glBindBuffer(GL_ARRAY_BUFFER, quadVertexBuf);
+    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(VertexPT), vertices.constData(), GL_STATIC_DRAW);
+    glCheckError();
+
+    // Generate index buffer for the quad. The indices data is uploaded to the IBO
+    glGenBuffers(1, &quadIndexBuf);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, quadIndexBuf);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLushort), indices.constData(), GL_STATIC_DRAW);
+    glCheckError();
+
+    // Release (unbind) all
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+}
+
+QOpenGLShaderProgram *GLResources::getSliceProgram() const
+{
+    return sliceProgram;
+}
+
+QOpenGLShaderProgram *GLResources::getTraceProgram() const
+{
+    return traceProgram;
+}
+
+QOpenGLShaderProgram *GLResources::getCoronalTraceProgram() const
+{
+    return coronalTraceProgram;
+}
+
+GLuint GLResources::getColorMapTexture(ColorMap map)
+{
+    if (map < ColorMap::Autumn || map >= ColorMap::Count)
+    {
+        qWarning() << "Invalid color map was specified: " << (int)map;
+        return 0;
+    }
+
+    GLuint &texture = colorMapTexture[(int)map];
+    if (texture)
+        return texture;
+
+    // The color map is uploaded the first time it is used. The texture is bound to whatever texture unit is active, which is
+    // the unit the caller is going to bind it to anyway
+    initializeOpenGLFunctions();
+
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_1D, texture);
+    // These parameters say that the color value for a pixel will be chosen based on the nearest pixel value. This creates a more blocky effect
+    // since it will not be linearly interpolated like GL_LINEAR
+    glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    // This parameter will clamp points to [0.0, 1.0]. This means that anything above 1.0 will become 1.0
+    // and anything below 0.0 will become 0.0
+    glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glCheckError();
+
+    // The color maps are 8-bit so they are stored as 8-bit in the GPU as well
+    glTexImage1D(GL_TEXTURE_1D, 0, GL_RGBA8, colorMapSize, 0, GL_RGBA, GL_UNSIGNED_BYTE, colorMapData[(int)map]);
+    glCheckError();
+
+    return texture;
+}
+
+GLuint GLResources::createQuadVertexArray()
+{
+    // The function pointers are resolved for the context that created the resources. Resolve them again in case this
+    // is a different context
+    initializeOpenGLFunctions();
+
+    // Generate VAO for the quad. Location 0 is the position and location 1 is the texture position
+    // The index buffer binding is stored in the VAO so it only needs to be bound once here
+    GLuint vertexObject;
+    glGenVertexArrays(1, &vertexObject);
+    glBindVertexArray(vertexObject);
+    glBindBuffer(GL_ARRAY_BUFFER, quadVertexBuf);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, quadIndexBuf);
+    glEnableVertexAttribArray(0);
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(0, VertexPT::PosTupleSize, GL_FLOAT, true, VertexPT::stride(), static_cast<const char *>(0) + VertexPT::posOffset());
+    glVertexAttribPointer(1, VertexPT::TexPosTupleSize, GL_FLOAT, true, VertexPT::stride(), static_cast<const char *>(0) + VertexPT::texPosOffset());
+    glCheckError();
+
+    // Release (unbind) the VAO first so that the index buffer binding is kept in it
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+    return vertexObject;
+}
+
+GLResources::~GLResources()
+{
+    // The functions are resolved again since the context that is current may be different than the one that created the resources
+    initializeOpenGLFunctions();
+
+    glDeleteBuffers(1, &quadVertexBuf);
+    glDeleteBuffers(1, &quadIndexBuf);
+    // Color maps that were never used have a texture of zero which is silently ignored by glDeleteTextures
+    glDeleteTextures((int)ColorMap::Count, &colorMapTexture[0]);
+    delete sliceProgram;
+    delete traceProgram;
+    delete coronalTraceProgram;
+}
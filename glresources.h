@@ -0,0 +1,63 @@
+#ifndef GLRESOURCES_H
+#define GLRESOURCES_H
+
+#include <QOpenGLFunctions_3_3_Core>
+#include <QOpenGLShaderProgram>
+#include <QDebug>
+#include <QVector>
+#include <memory>
+#include <algorithm>
+#include <iterator>
+
+#include "vertex.h"
+#include "displayinfo.h"
+#include "util.h"
+
+/* GLResources owns the OpenGL objects that are identical for every slice widget: the shader programs, the unit quad
+ * VBO/IBO and the color map textures. Color map textures are uploaded from colormaps.h the first time they are used. Qt::AA_ShareOpenGLContexts is set in main so that every QOpenGLWidget is in the
+ * same share group, which allows these objects to be created once per process and used by each widget.
+ *
+ * Widgets hold a std::shared_ptr returned by acquire. The resources are created by the first widget to acquire them and
+ * destroyed when the last widget releases its handle.
+ *
+ * Note: Vertex array objects are container objects and are NOT shared between contexts. Each widget must create its own
+ * VAO for the quad with createQuadVertexArray.
+ *
+ * Note: acquire and releasing the last handle must be done while an OpenGL context of a widget is current.
+ */
+class GLResources : protected QOpenGLFunctions_3_3_Core
+{
+private:
+    static std::weak_ptr<GLResources> instance;
+
+    QOpenGLShaderProgram *sliceProgram;
+    QOpenGLShaderProgram *traceProgram;
+    QOpenGLShaderProgram *coronalTraceProgram;
+
+    GLuint quadVertexBuf, quadIndexBuf;
+
+    // Zero until the color map is used for the first time
+    GLuint colorMapTexture[(int)ColorMap::Count];
+
+    GLResources();
+
+    void initializePrograms();
+    void initializeQuad();
+
+public:
+    ~GLResources();
+
+    static std::shared_ptr<GLResources> acquire();
+
+    QOpenGLShaderProgram *getSliceProgram() const;
+    QOpenGLShaderProgram *getTraceProgram() const;
+    QOpenGLShaderProgram *getCoronalTraceProgram() const;
+
+    // Uploads the color map if this is the first time it is used
+    GLuint getColorMapTexture(ColorMap map);
+
+    // Creates a VAO in the current context for the shared quad. The caller is responsible for deleting it
+    GLuint createQuadVertexArray();
+};
+
+#endif // GLRESOURCES_H
@@ -0,0 +1,327 @@
+#include "labelvolume.h"
+
+constexpr size_t LabelVolume::compressBlockSize;
+
+// Splits filename into the part before the NIFTI extension and the extension (.nii or .nii.gz)
+static void splitExtension(QString filename, QString &base, QString &extension)
+{
+    for (const QString &ext : { QString(".nii.gz"), QString(".nii") })
+    {
+        if (filename.endsWith(ext, Qt::CaseInsensitive))
+        {
+            base = filename.left(filename.length() - ext.length());
+            extension = filename.right(ext.length());
+            return;
+        }
+    }
+
+    base = filename;
+    extension = ".nii.gz";
+}
+
+/* createVolume creates a NIFTI-1 file in memory with a uint8 volume on the grid of the stitched image. The returned buffer
+ * has the header followed by the voxels and labels is set to a {z, y, x} matrix of the voxels in the buffer, all zero.
+ */
+std::vector<unsigned char> LabelVolume::createVolume(const NIFTImage *image, cv::Mat &labels)
+{
+    const int xDim = image->getXDim();
+    const int yDim = image->getYDim();
+    const int zDim = image->getZDim();
+
+    int niftiDims[8] = { 3, xDim, yDim, zDim, 1, 1, 1, 1 };
+    nifti_image *nim = nifti_make_new_nim(niftiDims, DT_UINT8, 0);
+
+    const mat44 transform = image->getStitchedTransform();
+    nim->dx = nim->pixdim[1] = transform.m[0][0];
+    nim->dy = nim->pixdim[2] = transform.m[1][1];
+    nim->dz = nim->pixdim[3] = transform.m[2][2];
+
+    nim->qform_code = NIFTI_XFORM_SCANNER_ANAT;
+    nim->sform_code = NIFTI_XFORM_SCANNER_ANAT;
+    nim->qto_xyz = transform;
+    nim->sto_xyz = transform;
+    nifti_mat44_to_quatern(transform, &nim->quatern_b, &nim->quatern_c, &nim->quatern_d, &nim->qoffset_x, &nim->qoffset_y,
+                           &nim->qoffset_z, NULL, NULL, NULL, &nim->qfac);
+
+    if (image->getUpperImage())
+        nim->xyz_units = image->getUpperImage()->xyz_units;
+
+    nim->nifti_type = NIFTI_FTYPE_NIFTI1_1;
+    nim->cal_min = 0.0f;
+    nim->cal_max = (float)TracingLayer::Count;
+    std::strncpy(nim->descrip, "SIUE Fat Segmentation Tool tracing labels", sizeof(nim->descrip) - 1);
+
+    nifti_1_header header = nifti_convert_nim2nhdr(nim);
+    nifti_image_free(nim);
+
+    // The header is followed by 4 bytes of zeros that indicate there are no extensions
+    const size_t voxelOffset = sizeof(nifti_1_header) + 4;
+    header.vox_offset = (float)voxelOffset;
+
+    std::vector<unsigned char> volume(voxelOffset + (size_t)xDim * yDim * zDim, 0);
+    std::memcpy(volume.data(), &header, sizeof(header));
+
+    const int dims[] = { zDim, yDim, xDim };
+    labels = cv::Mat(3, dims, CV_8UC1, volume.data() + voxelOffset);
+
+    return volume;
+}
+
+/* exportLabels writes every tracing layer into one label volume at filename. Layer i is stored as label i + 1 and where
+ * layers overlap the last layer is stored.
+ *
+ * Returns:
+ *      true - No error occurred and the file was written
+ *      false - No image is loaded or the file could not be written
+ */
+bool LabelVolume::exportLabels(QString filename, TracingData &tracingData, const NIFTImage *image)
+{
+    if (!image->isLoaded())
+        return false;
+
+    cv::Mat labels;
+    std::vector<unsigned char> volume = createVolume(image, labels);
+    const int dims[] = { labels.size[1], labels.size[2] };
+
+    cv::parallel_for_(cv::Range(0, labels.size[0]), [&](const cv::Range &range)
+    {
+        for (int z = range.start; z < range.end; ++z)
+        {
+            const cv::Range region[] = { cv::Range(z, z + 1), cv::Range::all(), cv::Range::all() };
+            cv::Mat slice = cv::Mat(labels, region).reshape(0, 2, dims);
+
+            for (int i = 0; i < (int)TracingLayer::Count; ++i)
+                slice.setTo(i + 1, cv::Mat(tracingData[i].data, region).reshape(0, 2, dims));
+        }
+    });
+
+    if (!write(filename, volume))
+        return false;
+
+    return true;
+}
+
+/* exportLayers writes each tracing layer into its own volume, the file of a layer is named by layerFilename. Traced voxels
+ * are stored as 1.
+ *
+ * Returns:
+ *      true - No error occurred and the files were written
+ *      false - No image is loaded or a file could not be written
+ */
+bool LabelVolume::exportLayers(QString filename, TracingData &tracingData, const NIFTImage *image)
+{
+    if (!image->isLoaded())
+        return false;
+
+    cv::Mat labels;
+    std::vector<unsigned char> volume = createVolume(image, labels);
+    const int dims[] = { labels.size[1], labels.size[2] };
+
+    for (int i = 0; i < (int)TracingLayer::Count; ++i)
+    {
+        cv::parallel_for_(cv::Range(0, labels.size[0]), [&](const cv::Range &range)
+        {
+            for (int z = range.start; z < range.end; ++z)
+            {
+                const cv::Range region[] = { cv::Range(z, z + 1), cv::Range::all(), cv::Range::all() };
+                cv::Mat slice = cv::Mat(labels, region).reshape(0, 2, dims);
+
+                cv::min(cv::Mat(tracingData[i].data, region).reshape(0, 2, dims), 1, slice);
+            }
+        });
+
+        if (!write(layerFilename(filename, (TracingLayer)i), volume))
+            return false;
+    }
+
+    return true;
+}
+
+/* importVolume reads the label volume at filename into the tracing data. If the file is named after a layer (see
+ * layerFilename), every voxel that is not zero is set in that layer and the other layers are not changed. Otherwise the file
+ * is read as a multi-label volume and replaces every layer.
+ *
+ * The volume is flipped to RAS in the same way as the subject images, so volumes written by other tools in a different
+ * orientation are read correctly as long as they have the dimensions of the subject.
+ *
+ * Returns:
+ *      true - No error occurred and the layers were read
+ *      false - The file could not be read or does not match the dimensions of the tracing data
+ */
+bool LabelVolume::importVolume(QString filename, TracingData &tracingData)
+{
+    nifti_image *nim = nifti_image_read(filename.toLocal8Bit().constData(), 1);
+    if (!nim || !nim->data)
+    {
+        qWarning() << "Unable to read label volume: " << filename;
+        if (nim) nifti_image_free(nim);
+        return false;
+    }
+
+    const TracingLayerData &firstLayer = tracingData[0];
+    const NumericType *type = NumericType::NIFTI(nim->datatype);
+
+    if (!type || nim->nx != firstLayer.getXDim() || nim->ny != firstLayer.getYDim() || nim->nz != firstLayer.getZDim() || nim->nt > 1)
+    {
+        qWarning() << "Label volume does not match the dimensions of the subject or has an unsupported type: " << filename;
+        nifti_image_free(nim);
+        return false;
+    }
+
+    const int volumeDims[] = { nim->nz, nim->ny, nim->nx };
+    cv::Mat volume(3, volumeDims, CV_MAKETYPE(type->openCVTypeNoChannel, 1), nim->data);
+    NIFTImage::orientImage(nim, volume);
+
+    cv::Mat labels;
+    volume.convertTo(labels, CV_8U);
+    nifti_image_free(nim);
+
+    // A layer volume is named after its layer
+    int fileLayer = -1;
+    QString base, extension;
+    splitExtension(filename, base, extension);
+
+    for (int i = 0; i < (int)TracingLayer::Count; ++i)
+    {
+        if (base.endsWith("_" + tracingLayerName((TracingLayer)i), Qt::CaseInsensitive))
+            fileLayer = i;
+    }
+
+    const int dims[] = { labels.size[1], labels.size[2] };
+
+    cv::parallel_for_(cv::Range(0, labels.size[0]), [&](const cv::Range &range)
+    {
+        for (int z = range.start; z < range.end; ++z)
+        {
+            const cv::Range region[] = { cv::Range(z, z + 1), cv::Range::all(), cv::Range::all() };
+            const cv::Mat slice = cv::Mat(labels, region).reshape(0, 2, dims);
+
+            for (int i = 0; i < (int)TracingLayer::Count; ++i)
+            {
+                if (fileLayer >= 0 && i != fileLayer)
+                    continue;
+
+                cv::Mat layerSlice = cv::Mat(tracingData[i].data, region).reshape(0, 2, dims);
+
+                if (fileLayer >= 0)
+                    cv::compare(slice, 0, layerSlice, cv::CMP_NE);
+                else
+                    cv::compare(slice, i + 1, layerSlice, cv::CMP_EQ);
+            }
+        }
+    });
+
+    return true;
+}
+
+QString LabelVolume::layerFilename(QString filename, TracingLayer layer)
+{
+    QString base, extension;
+    splitExtension(filename, base, extension);
+
+    return base + "_" + tracingLayerName(layer) + extension;
+}
+
+bool LabelVolume::write(QString filename, const std::vector<unsigned char> &volume)
+{
+    QFile file(filename);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        qWarning() << "Unable to open label volume file: " << filename;
+        return false;
+    }
+
+    bool success;
+    if (filename.endsWith(".gz", Qt::CaseInsensitive))
+        success = writeCompressed(file, volume);
+    else
+        success = (file.write((const char *)volume.data(), volume.size()) == (qint64)volume.size());
+
+    if (!success)
+        qWarning() << "Unable to write label volume file: " << filename;
+
+    return success;
+}
+
+/* writeCompressed writes volume to file as a gzip stream. The volume is split into blocks of compressBlockSize bytes that
+ * are deflated in parallel, each block is a separate deflate stream. Every block except the last one is ended with a sync
+ * flush instead of finishing the stream, so the blocks end on a byte boundary and can be joined into one deflate stream.
+ * The CRC of the blocks is combined for the gzip trailer.
+ *
+ * Since the blocks do not share a dictionary, the file is slightly larger than if it was compressed as one stream.
+ */
+bool LabelVolume::writeCompressed(QFile &file, const std::vector<unsigned char> &volume)
+{
+    const size_t blockCount = (volume.size() + compressBlockSize - 1) / compressBlockSize;
+
+    std::vector<std::vector<unsigned char>> blocks(blockCount);
+    std::vector<uLong> blockCRCs(blockCount);
+    std::vector<char> blockErrors(blockCount, 0);
+
+    cv::parallel_for_(cv::Range(0, (int)blockCount), [&](const cv::Range &range)
+    {
+        for (int i = range.start; i < range.end; ++i)
+        {
+            const size_t start = i * compressBlockSize;
+            const size_t length = std::min(compressBlockSize, volume.size() - start);
+            const bool last = (i == (int)blockCount - 1);
+
+            // A negative window size writes a raw deflate stream without the zlib header
+            z_stream stream;
+            std::memset(&stream, 0, sizeof(stream));
+            if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+            {
+                blockErrors[i] = 1;
+                continue;
+            }
+
+            // The bound is for finishing the stream, the sync flush marker is 5 bytes more at most
+            std::vector<unsigned char> &block = blocks[i];
+            block.resize(deflateBound(&stream, (uLong)length) + 16);
+
+            stream.next_in = const_cast<Bytef *>(volume.data() + start);
+            stream.avail_in = (uInt)length;
+            stream.next_out = block.data();
+            stream.avail_out = (uInt)block.size();
+
+            int result = deflate(&stream, last ? Z_FINISH : Z_SYNC_FLUSH);
+            if ((last && result != Z_STREAM_END) || (!last && result != Z_OK) || stream.avail_in != 0)
+                blockErrors[i] = 1;
+
+            block.resize(block.size() - stream.avail_out);
+            deflateEnd(&stream);
+
+            blockCRCs[i] = crc32(crc32(0L, Z_NULL, 0), volume.data() + start, (uInt)length);
+        }
+    });
+
+    if (std::find(std::begin(blockErrors), std::end(blockErrors), 1) != std::end(blockErrors))
+        return false;
+
+    uLong crc = crc32(0L, Z_NULL, 0);
+    for (size_t i = 0; i < blockCount; ++i)
+    {
+        const size_t length = std::min(compressBlockSize, volume.size() - i * compressBlockSize);
+        crc = crc32_combine(crc, blockCRCs[i], (z_off_t)length);
+    }
+
+    // Header with no file name or modification time, OS is unknown (255)
+    const unsigned char header[] = { 0x1f, 0x8b, 8, 0, 0, 0, 0, 0, 0, 255 };
+    if (file.write((const char *)header, sizeof(header)) != sizeof(header))
+        return false;
+
+    for (const auto &block : blocks)
+    {
+        if (file.write((const char *)block.data(), block.size()) != (qint64)block.size())
+            return false;
+    }
+
+    // Trailer is the CRC and the uncompressed size modulo 2^32, both little endian
+    const uint32_t size = (uint32_t)volume.size();
+    const unsigned char trailer[] = {
+        (unsigned char)(crc & 0xFF), (unsigned char)((crc >> 8) & 0xFF), (unsigned char)((crc >> 16) & 0xFF), (unsigned char)((crc >> 24) & 0xFF),
+        (unsigned char)(size & 0xFF), (unsigned char)((size >> 8) & 0xFF), (unsigned char)((size >> 16) & 0xFF), (unsigned char)((size >> 24) & 0xFF)
+    };
+
+    return (file.write((const char *)trailer, sizeof(trailer)) == sizeof(trailer));
+}
@@ -0,0 +1,53 @@
+#ifndef LABELVOLUME_H
+#define LABELVOLUME_H
+
+#include <QDebug>
+#include <QString>
+#include <QFile>
+#include <QFileInfo>
+#include <vector>
+#include <cstring>
+
+#include <opencv2/opencv.hpp>
+#include <zlib.h>
+
+#include <nifti1.h>
+#include <nifti1_io.h>
+
+#include "niftimage.h"
+#include "numerictype.h"
+#include "tracing.h"
+
+/* LabelVolume exports the tracing layers as NIFTI label volumes that other tools such as ITK-SNAP can read and imports them
+ * again. The volumes are on the grid of the stitched image (see NIFTImage::getStitchedTransform), so the voxel size and
+ * orientation of the subject are kept.
+ *
+ * A multi-label volume stores layer i as label i + 1 (EAT = 1, IMAT = 2, ..., VAT = 6). A voxel can only have one label, so
+ * where layers overlap the last layer is stored. A layer volume stores one layer as 0 and 1 and is named after the layer,
+ * such as subject_EAT.nii.gz, so it is imported into that layer again.
+ *
+ * Files ending in .gz are compressed with gzip. The volume is split into blocks that are deflated in parallel and the blocks
+ * are joined into one gzip stream, which any gzip reader can read.
+ */
+class LabelVolume
+{
+private:
+    static constexpr size_t compressBlockSize = 256 * 1024;
+
+    static std::vector<unsigned char> createVolume(const NIFTImage *image, cv::Mat &labels);
+    static bool write(QString filename, const std::vector<unsigned char> &volume);
+    static bool writeCompressed(QFile &file, const std::vector<unsigned char> &volume);
+
+public:
+    // Writes one multi-label volume with every layer
+    static bool exportLabels(QString filename, TracingData &tracingData, const NIFTImage *image);
+    // Writes one volume for each layer, the name of the layer is appended to the filename
+    static bool exportLayers(QString filename, TracingData &tracingData, const NIFTImage *image);
+
+    // Reads a multi-label volume or a layer volume into the tracing data. The drawing times of the layers are kept
+    static bool importVolume(QString filename, TracingData &tracingData);
+
+    static QString layerFilename(QString filename, TracingLayer layer);
+};
+
+#endif // LABELVOLUME_H
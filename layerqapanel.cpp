@@ -0,0 +1,124 @@
+#include "layerqapanel.h"
+
+LayerQAPanel::LayerQAPanel(QWidget *parent) : QWidget(parent), fatImage(NULL), tracingData(NULL), components()
+{
+    setWindowTitle(tr("Layer QA"));
+
+    layerComboBox = new QComboBox(this);
+    for (int i = 0; i < (int)TracingLayer::Count; ++i)
+        layerComboBox->addItem(tracingLayerName((TracingLayer)i));
+
+    threeDCheckBox = new QCheckBox(tr("3D"), this);
+    threeDCheckBox->setChecked(true);
+    threeDCheckBox->setToolTip(tr("Connect components across axial slices"));
+
+    refreshButton = new QPushButton(tr("Refresh"), this);
+    summaryLabel = new QLabel(this);
+
+    table = new QTableWidget(0, 5, this);
+    table->setHorizontalHeaderLabels({ tr("Voxels"), tr("Volume (mL)"), tr("Slices"), tr("Bounding Box (X, Y)"), tr("Location") });
+    table->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    table->setSelectionBehavior(QAbstractItemView::SelectRows);
+    table->setSelectionMode(QAbstractItemView::SingleSelection);
+    table->verticalHeader()->setVisible(false);
+    table->horizontalHeader()->setSectionResizeMode(QHeaderView::ResizeToContents);
+    table->horizontalHeader()->setStretchLastSection(true);
+
+    QHBoxLayout *controlsLayout = new QHBoxLayout();
+    controlsLayout->addWidget(new QLabel(tr("Layer:"), this));
+    controlsLayout->addWidget(layerComboBox);
+    controlsLayout->addWidget(threeDCheckBox);
+    controlsLayout->addStretch();
+    controlsLayout->addWidget(refreshButton);
+
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    layout->addLayout(controlsLayout);
+    layout->addWidget(summaryLabel);
+    layout->addWidget(table);
+
+    connect(layerComboBox, SIGNAL(currentIndexChanged(int)), this, SLOT(refresh()));
+    connect(threeDCheckBox, SIGNAL(toggled(bool)), this, SLOT(refresh()));
+    connect(refreshButton, SIGNAL(clicked()), this, SLOT(refresh()));
+    connect(table, SIGNAL(cellClicked(int, int)), this, SLOT(table_cellClicked(int, int)));
+
+    resize(600, 400);
+}
+
+void LayerQAPanel::setup(NIFTImage *fat, TracingData *tracing)
+{
+    fatImage = fat;
+    tracingData = tracing;
+}
+
+void LayerQAPanel::setLayer(TracingLayer layer)
+{
+    // Changing the index refreshes the panel
+    layerComboBox->setCurrentIndex((int)layer);
+}
+
+void LayerQAPanel::showEvent(QShowEvent *event)
+{
+    QWidget::showEvent(event);
+    refresh();
+}
+
+void LayerQAPanel::refresh()
+{
+    if (!isVisible())
+        return;
+
+    components.clear();
+    table->setRowCount(0);
+
+    if (!fatImage || !fatImage->isLoaded())
+    {
+        summaryLabel->setText(tr("No subject is loaded."));
+        return;
+    }
+
+    const TracingLayer layer = (TracingLayer)layerComboBox->currentIndex();
+    ConnectedComponents labeling;
+    labeling.compute((*tracingData)[layer].data, threeDCheckBox->isChecked());
+
+    // The smallest components are the most likely to be stray islands, so they are listed first
+    components = labeling.getComponents();
+    std::sort(std::begin(components), std::end(components), [](const Component &a, const Component &b) {
+        return a.size < b.size;
+    });
+
+    const nifti_image *image = fatImage->getUpperImage();
+    const double voxelVolume = std::fabs(image->dx * image->dy * image->dz) / 1000.0;
+
+    size_t total = 0;
+    table->setRowCount((int)components.size());
+
+    for (int i = 0; i < (int)components.size(); ++i)
+    {
+        const Component &component = components[i];
+        total += component.size;
+
+        const QString slices = (component.zMin == component.zMax) ? QString::number(component.zMin) :
+                                                                    QString("%1 - %2").arg(component.zMin).arg(component.zMax);
+
+        table->setItem(i, 0, new QTableWidgetItem(QString::number(component.size)));
+        table->setItem(i, 1, new QTableWidgetItem(QString::number(component.size * voxelVolume, 'f', 3)));
+        table->setItem(i, 2, new QTableWidgetItem(slices));
+        table->setItem(i, 3, new QTableWidgetItem(QString("%1 - %2, %3 - %4").arg(component.xMin).arg(component.xMax)
+                                                  .arg(component.yMin).arg(component.yMax)));
+        table->setItem(i, 4, new QTableWidgetItem(QString("(%1, %2, %3)").arg(component.x).arg(component.y).arg(component.z)));
+    }
+
+    summaryLabel->setText(tr("%1 components, %2 voxels (%3 mL)").arg(components.size()).arg(total)
+                          .arg(total * voxelVolume, 0, 'f', 2));
+}
+
+void LayerQAPanel::table_cellClicked(int row, int column)
+{
+    (void)column;
+
+    if (row < 0 || row >= (int)components.size())
+        return;
+
+    const Component &component = components[row];
+    emit locationRequested(QVector4D(component.x, component.y, component.z, Location::NoChange));
+}
@@ -0,0 +1,64 @@
+#ifndef LAYERQAPANEL_H
+#define LAYERQAPANEL_H
+
+#include <QWidget>
+#include <QTableWidget>
+#include <QHeaderView>
+#include <QComboBox>
+#include <QCheckBox>
+#include <QPushButton>
+#include <QLabel>
+#include <QHBoxLayout>
+#include <QVBoxLayout>
+#include <QVector4D>
+#include <QDebug>
+
+#include "connectedcomponents.h"
+#include "niftimage.h"
+#include "tracing.h"
+
+/* LayerQAPanel is a tool window that lists the connected components of a tracing layer so that stray islands can be found
+ * and cleaned up. The components are sorted from smallest to largest since the small ones are usually mistakes. Clicking
+ * a component emits locationRequested with the first voxel of the component.
+ *
+ * The components are found again when the panel is shown, when the layer is changed, when the tracing data is replaced
+ * and when refresh is called, such as after the tracing results are saved.
+ */
+class LayerQAPanel : public QWidget
+{
+    Q_OBJECT
+
+private:
+    NIFTImage *fatImage;
+    TracingData *tracingData;
+
+    std::vector<Component> components;
+
+    QComboBox *layerComboBox;
+    QCheckBox *threeDCheckBox;
+    QPushButton *refreshButton;
+    QLabel *summaryLabel;
+    QTableWidget *table;
+
+protected:
+    void showEvent(QShowEvent *event);
+
+public:
+    explicit LayerQAPanel(QWidget *parent = NULL);
+
+    void setup(NIFTImage *fat, TracingData *tracing);
+    void setLayer(TracingLayer layer);
+
+public slots:
+    // Labels the components of the selected layer again if the panel is visible
+    void refresh();
+
+private slots:
+    void table_cellClicked(int row, int column);
+
+signals:
+    // Location is (x, y, z) in the stitched image with the fourth component set to Location::NoChange
+    void locationRequested(QVector4D location);
+};
+
+#endif // LAYERQAPANEL_H
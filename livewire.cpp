@@ -0,0 +1,284 @@
+#include "livewire.h"
+
+constexpr int LiveWire::axisStep;
+constexpr int LiveWire::diagonalStep;
+constexpr int LiveWire::maxStepCost;
+constexpr size_t LiveWireCostCache::capacity;
+
+LiveWire::LiveWire() : cost(), anchor(), previous(), anchored(false)
+{
+}
+
+void LiveWire::setCostMap(const cv::Mat &cost)
+{
+    this->cost = cost;
+    clearAnchor();
+}
+
+bool LiveWire::hasCostMap() const
+{
+    return !cost.empty();
+}
+
+/* setAnchor finds the shortest path from anchor to every pixel of the cost map. The queue is a ring of buckets with one
+ * bucket for each distance, the ring is larger than the most expensive step so a pixel is never pushed into the bucket
+ * that is being emptied unless it has the same distance. Pixels are not removed from their old bucket when a shorter path
+ * is found, so a pixel is skipped if it was already finished.
+ */
+void LiveWire::setAnchor(QPoint anchor)
+{
+    const int xDim = cost.cols;
+    const int yDim = cost.rows;
+
+    if (cost.empty() || anchor.x() < 0 || anchor.y() < 0 || anchor.x() >= xDim || anchor.y() >= yDim)
+    {
+        clearAnchor();
+        return;
+    }
+
+    const int pixels = xDim * yDim;
+    const int ringSize = maxStepCost + 1;
+
+    std::vector<int> distance(pixels, std::numeric_limits<int>::max());
+    std::vector<unsigned char> finished(pixels, 0);
+    std::vector<std::vector<int>> buckets(ringSize);
+
+    previous.assign(pixels, -1);
+
+    const int start = anchor.y() * xDim + anchor.x();
+    distance[start] = 0;
+    buckets[0].push_back(start);
+
+    size_t queued = 1;
+    const unsigned char *costs = cost.ptr<unsigned char>();
+
+    for (int current = 0; queued > 0; ++current)
+    {
+        std::vector<int> &bucket = buckets[current % ringSize];
+
+        while (!bucket.empty())
+        {
+            const int index = bucket.back();
+            bucket.pop_back();
+            --queued;
+
+            if (finished[index])
+                continue;
+
+            finished[index] = 1;
+
+            const int x = index % xDim;
+            const int y = index / xDim;
+
+            for (int dy = -1; dy <= 1; ++dy)
+            {
+                const int ny = y + dy;
+                if (ny < 0 || ny >= yDim)
+                    continue;
+
+                for (int dx = -1; dx <= 1; ++dx)
+                {
+                    const int nx = x + dx;
+                    if ((dx == 0 && dy == 0) || nx < 0 || nx >= xDim)
+                        continue;
+
+                    const int neighbor = ny * xDim + nx;
+                    if (finished[neighbor])
+                        continue;
+
+                    const int newDistance = current + (costs[neighbor] + 1) * ((dx && dy) ? diagonalStep : axisStep);
+                    if (newDistance < distance[neighbor])
+                    {
+                        distance[neighbor] = newDistance;
+                        previous[neighbor] = index;
+                        buckets[newDistance % ringSize].push_back(neighbor);
+                        ++queued;
+                    }
+                }
+            }
+        }
+    }
+
+    this->anchor = anchor;
+    anchored = true;
+}
+
+void LiveWire::clearAnchor()
+{
+    anchored = false;
+    std::vector<int>().swap(previous);
+}
+
+bool LiveWire::isAnchored() const
+{
+    return anchored;
+}
+
+QPoint LiveWire::getAnchor() const
+{
+    return anchor;
+}
+
+std::vector<QPoint> LiveWire::pathTo(QPoint target) const
+{
+    std::vector<QPoint> path;
+
+    if (!anchored)
+        return path;
+
+    const int xDim = cost.cols;
+    const int x = std::min(std::max(target.x(), 0), xDim - 1);
+    const int y = std::min(std::max(target.y(), 0), cost.rows - 1);
+
+    for (int index = y * xDim + x; index >= 0; index = previous[index])
+        path.push_back(QPoint(index % xDim, index / xDim));
+
+    std::reverse(std::begin(path), std::end(path));
+    return path;
+}
+
+/* computeCostMap returns the cost of each pixel of a slice for the live-wire. The image is smoothed and then the cost is
+ * mostly from the gradient magnitude, which is low on strong edges, and partly from the zero crossings of the Laplacian,
+ * which are low right on the edge so the path follows the middle of the edge instead of its side.
+ */
+cv::Mat LiveWire::computeCostMap(const cv::Mat &fatSlice, const cv::Mat &waterSlice, LiveWireImage image)
+{
+    cv::Mat values;
+    fatSlice.convertTo(values, CV_32F);
+
+    if (image == LiveWireImage::FatFraction)
+    {
+        cv::Mat water;
+        waterSlice.convertTo(water, CV_32F);
+
+        // Voxels with no signal have a fat fraction of zero, newer versions of OpenCV give NaN for them otherwise
+        const cv::Mat total = values + water;
+        cv::divide(values, total, values);
+        values.setTo(0.0f, total == 0.0f);
+    }
+
+    cv::GaussianBlur(values, values, cv::Size(3, 3), 0);
+
+    cv::Mat dx, dy, magnitude, laplacian;
+    cv::Sobel(values, dx, CV_32F, 1, 0);
+    cv::Sobel(values, dy, CV_32F, 0, 1);
+    cv::magnitude(dx, dy, magnitude);
+    cv::Laplacian(values, laplacian, CV_32F, 3);
+
+    double maxMagnitude;
+    cv::minMaxLoc(magnitude, NULL, &maxMagnitude);
+    const float scale = (maxMagnitude > 0.0) ? (float)(1.0 / maxMagnitude) : 0.0f;
+
+    const int yDim = values.rows;
+    const int xDim = values.cols;
+    cv::Mat cost(yDim, xDim, CV_8UC1);
+
+    for (int y = 0; y < yDim; ++y)
+    {
+        const float *gradient = magnitude.ptr<float>(y);
+        const float *lap = laplacian.ptr<float>(y);
+        const float *lapBelow = laplacian.ptr<float>(std::min(y + 1, yDim - 1));
+        unsigned char *dst = cost.ptr<unsigned char>(y);
+
+        for (int x = 0; x < xDim; ++x)
+        {
+            const float right = lap[std::min(x + 1, xDim - 1)];
+            const bool zeroCrossing = (lap[x] * right < 0.0f) || (lap[x] * lapBelow[x] < 0.0f);
+
+            const float edgeCost = 0.3f * (zeroCrossing ? 0.0f : 1.0f) + 0.7f * (1.0f - gradient[x] * scale);
+            dst[x] = (unsigned char)std::min(std::max(edgeCost * 255.0f + 0.5f, 0.0f), 255.0f);
+        }
+    }
+
+    return cost;
+}
+
+LiveWireCostCache::LiveWireCostCache() : fatImage(NULL), waterImage(NULL), image(LiveWireImage::Fat), threadPool(), costMaps(),
+    recent()
+{
+    // One slice is shown at a time, so one thread is enough to stay ahead of the slices being viewed
+    threadPool.setMaxThreadCount(1);
+}
+
+void LiveWireCostCache::setup(NIFTImage *fat, NIFTImage *water)
+{
+    fatImage = fat;
+    waterImage = water;
+    clear();
+}
+
+LiveWireImage LiveWireCostCache::getImage() const
+{
+    return image;
+}
+
+void LiveWireCostCache::setImage(LiveWireImage image)
+{
+    if (this->image == image)
+        return;
+
+    this->image = image;
+    clear();
+}
+
+void LiveWireCostCache::touch(int z)
+{
+    recent.remove(z);
+    recent.push_front(z);
+
+    while (recent.size() > capacity)
+    {
+        costMaps.erase(recent.back());
+        recent.pop_back();
+    }
+}
+
+void LiveWireCostCache::prefetch(int z)
+{
+    if (!fatImage || !fatImage->isLoaded() || z < 0 || z >= fatImage->getZDim())
+        return;
+
+    if (costMaps.find(z) == costMaps.end())
+    {
+        const int dims[] = { fatImage->getYDim(), fatImage->getXDim() };
+        const cv::Mat fatSlice = fatImage->getAxialSlice(z, true).reshape(0, 2, dims);
+        const cv::Mat waterSlice = waterImage->getAxialSlice(z, true).reshape(0, 2, dims);
+
+        costMaps[z] = QtConcurrent::run(&threadPool, &LiveWire::computeCostMap, fatSlice, waterSlice, image);
+    }
+
+    touch(z);
+}
+
+/* search finds the shortest paths from anchor on slice z on the worker thread. The pool has one thread, so the cost map job
+ * of the slice was started before the search and is finished by the time the search reads it. The live-wire is not
+ * anchored if the images are not loaded.
+ */
+QFuture<LiveWire> LiveWireCostCache::search(int z, QPoint anchor)
+{
+    prefetch(z);
+
+    auto it = costMaps.find(z);
+    if (it == costMaps.end())
+        return QtConcurrent::run(&threadPool, []() { return LiveWire(); });
+
+    return QtConcurrent::run(&threadPool, [anchor](QFuture<cv::Mat> costMap)
+    {
+        LiveWire liveWire;
+        liveWire.setCostMap(costMap.result());
+        liveWire.setAnchor(anchor);
+        return liveWire;
+    }, it->second);
+}
+
+void LiveWireCostCache::clear()
+{
+    // Jobs that are running finish on their own and their results are dropped
+    costMaps.clear();
+    recent.clear();
+}
+
+LiveWireCostCache::~LiveWireCostCache()
+{
+    threadPool.waitForDone();
+}
@@ -0,0 +1,108 @@
+#ifndef LIVEWIRE_H
+#define LIVEWIRE_H
+
+#include <QPoint>
+#include <QDebug>
+#include <QFuture>
+#include <QThreadPool>
+#include <QtConcurrent>
+#include <vector>
+#include <list>
+#include <map>
+#include <limits>
+#include <algorithm>
+
+#include <opencv2/opencv.hpp>
+
+#include "niftimage.h"
+
+// Image that the edges of the live-wire are found on
+enum class LiveWireImage : int
+{
+    Fat = 0,
+    FatFraction
+};
+
+/* LiveWire finds the path along the strongest edges between two points of an axial slice (intelligent scissors). Each
+ * pixel has a cost from 0 to 255 that is low on edges, see computeCostMap. A step to a neighboring pixel costs the cost
+ * of that pixel plus one, scaled by 5 for a step along an axis and by 7 for a diagonal step.
+ *
+ * When an anchor is set, the shortest paths from the anchor to every pixel are found with Dijkstra's algorithm. Since the
+ * step costs are small integers, the priority queue is a ring of buckets, one for each distance, which makes each push and
+ * pop constant time. Moving the cursor afterwards only follows the path back from the cursor to the anchor. The search
+ * takes too long for the GUI thread on a large slice, see LiveWireCostCache::search.
+ */
+class LiveWire
+{
+public:
+    static constexpr int axisStep = 5;
+    static constexpr int diagonalStep = 7;
+    static constexpr int maxStepCost = 256 * diagonalStep;
+
+private:
+    cv::Mat cost;
+    QPoint anchor;
+
+    // Previous pixel on the shortest path from the anchor to each pixel, -1 for the anchor
+    std::vector<int> previous;
+    bool anchored;
+
+public:
+    LiveWire();
+
+    void setCostMap(const cv::Mat &cost);
+    bool hasCostMap() const;
+
+    // Finds the shortest paths from anchor to every pixel of the cost map
+    void setAnchor(QPoint anchor);
+    void clearAnchor();
+    bool isAnchored() const;
+    QPoint getAnchor() const;
+
+    // Returns the pixels of the path from the anchor to target, including both. Empty if no anchor is set
+    std::vector<QPoint> pathTo(QPoint target) const;
+
+    // Returns the cost map of a slice as CV_8U. The slices are {y, x} of any type
+    static cv::Mat computeCostMap(const cv::Mat &fatSlice, const cv::Mat &waterSlice, LiveWireImage image);
+};
+
+/* LiveWireCostCache keeps the cost maps of the most recently used axial slices. A cost map is computed on a worker thread
+ * when the slice is shown (see prefetch), so it is usually ready by the time the first anchor is placed. The slices are
+ * copied when the job is started, so the job does not read the images. The paths from an anchor are searched on the same
+ * worker thread after the cost map of the slice.
+ */
+class LiveWireCostCache
+{
+private:
+    static constexpr size_t capacity = 16;
+
+    NIFTImage *fatImage;
+    NIFTImage *waterImage;
+    LiveWireImage image;
+
+    QThreadPool threadPool;
+
+    // Cost map of each cached slice, the list is ordered from the most recently used slice
+    std::map<int, QFuture<cv::Mat>> costMaps;
+    std::list<int> recent;
+
+    void touch(int z);
+
+public:
+    LiveWireCostCache();
+    ~LiveWireCostCache();
+
+    void setup(NIFTImage *fat, NIFTImage *water);
+
+    LiveWireImage getImage() const;
+    void setImage(LiveWireImage image);
+
+    // Starts computing the cost map of slice z if it is not cached
+    void prefetch(int z);
+    // Returns a live-wire anchored at anchor on slice z, it is found on the worker thread
+    QFuture<LiveWire> search(int z, QPoint anchor);
+
+    void clear();
+};
+
+#endif // LIVEWIRE_H
@@ -0,0 +1,383 @@
+#include "logger.h"
+
+#ifdef Q_OS_WIN
+#include <io.h>
+#else // Q_OS_WIN
+#include <unistd.h>
+#endif // Q_OS_WIN
+
+Logger *globalLogger = NULL;
+
+constexpr size_t Logger::capacity;
+constexpr size_t Logger::emergencyBufferSize;
+constexpr qint64 Logger::maxFileSize;
+constexpr int Logger::backupCount;
+constexpr int Logger::flushInterval;
+
+Logger::Logger() : slots(new Slot[capacity]), pushPosition(0), popPosition(0), dropped(0), file(NULL),
+    emergencyFd(-1), emergencyBuffer(new char[emergencyBufferSize]), crashed(false), running(false)
+{
+    static_assert((capacity & (capacity - 1)) == 0, "Capacity of the log buffer must be a power of two");
+
+    // Each slot starts out empty for the position that will be pushed to it first
+    for (size_t i = 0; i < capacity; ++i)
+        slots[i].sequence.store(i, std::memory_order_relaxed);
+
+    for (RateLimit &limit : rateLimits)
+    {
+        limit.windowStart.store(0);
+        limit.count.store(0);
+        limit.suppressed.store(0);
+    }
+
+    clock.start();
+}
+
+bool Logger::start(QString path)
+{
+    this->path = path;
+
+    file = fopen(QFile::encodeName(path).constData(), "a");
+    emergencyFd = file ? fileno(file) : -1;
+
+    running = true;
+    writerThread = std::thread(&Logger::writerLoop, this);
+
+    return (file != NULL);
+}
+
+void Logger::stop()
+{
+    if (running.exchange(false))
+    {
+        wakeCondition.notify_one();
+        writerThread.join();
+    }
+
+    // Anything pushed after the writer thread stopped is written here
+    flush();
+
+    if (file)
+    {
+        emergencyFd = -1;
+        fclose(file);
+        file = NULL;
+    }
+}
+
+int Logger::getRateLimit(QtMsgType type)
+{
+    switch (type)
+    {
+        case QtDebugMsg: return 500;
+        case QtInfoMsg: return 200;
+        case QtWarningMsg: return 50;
+        case QtCriticalMsg: return 50;
+        case QtFatalMsg: return -1;
+    }
+
+    return -1;
+}
+
+bool Logger::push(QtMsgType type, const QString &message)
+{
+    // Count the messages of this type in the current one second window. The first thread to see that the window is over
+    // starts a new one
+    const int limit = getRateLimit(type);
+    if (limit >= 0 && type >= 0 && type < messageTypeCount)
+    {
+        RateLimit &rate = rateLimits[type];
+        const qint64 now = clock.elapsed();
+        qint64 windowStart = rate.windowStart.load(std::memory_order_relaxed);
+
+        if (now - windowStart >= 1000 && rate.windowStart.compare_exchange_strong(windowStart, now))
+            rate.count.store(0, std::memory_order_relaxed);
+
+        if (rate.count.fetch_add(1, std::memory_order_relaxed) >= limit)
+        {
+            rate.suppressed.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+    }
+
+    // Claim the next position in the buffer. The slot is free if its sequence is equal to the position, if it is less then
+    // the writer has not taken the message from the previous time around the buffer yet and the buffer is full
+    size_t position = pushPosition.load(std::memory_order_relaxed);
+    Slot *slot;
+
+    for (;;)
+    {
+        slot = &slots[position & (capacity - 1)];
+        const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        const intptr_t difference = (intptr_t)sequence - (intptr_t)position;
+
+        if (difference == 0)
+        {
+            if (pushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if (difference < 0)
+        {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        else
+        {
+            position = pushPosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->type = type;
+    slot->message = message;
+    slot->sequence.store(position + 1, std::memory_order_release);
+
+    // The writer thread wakes up on its own every flush interval, warnings and errors wake it up right away
+    if (type != QtDebugMsg && type != QtInfoMsg)
+        wakeCondition.notify_one();
+
+    return true;
+}
+
+bool Logger::pop(QtMsgType &type, QString &message)
+{
+    Slot &slot = slots[popPosition & (capacity - 1)];
+    if (slot.sequence.load(std::memory_order_acquire) != popPosition + 1)
+        return false;
+
+    type = slot.type;
+    message = std::move(slot.message);
+    slot.message = QString();
+
+    // Free the slot for the position one time around the buffer from now
+    slot.sequence.store(popPosition + capacity, std::memory_order_release);
+    ++popPosition;
+
+    return true;
+}
+
+void Logger::write()
+{
+    QByteArray fileBatch;
+    QByteArray outBatch;
+    QByteArray errBatch;
+
+    QtMsgType type;
+    QString message;
+
+    while (pop(type, message))
+    {
+        const QByteArray line = message.toLocal8Bit() + '\n';
+
+        fileBatch += line;
+        if (type == QtDebugMsg || type == QtInfoMsg)
+            outBatch += line;
+        else
+            errBatch += line;
+    }
+
+    // Report the messages that were not logged since the last batch
+    const int droppedCount = dropped.exchange(0);
+    if (droppedCount > 0)
+    {
+        const QByteArray line = QString("Log buffer was full, %1 messages were dropped\n").arg(droppedCount).toLocal8Bit();
+        fileBatch += line;
+        errBatch += line;
+    }
+
+    const char *typeNames[] = { "Debug", "Warn", "Crit", "Fatal", "Info" };
+    for (int i = 0; i < messageTypeCount; ++i)
+    {
+        // The count is only reported once the window is over, otherwise it is reported again for each batch
+        RateLimit &rate = rateLimits[i];
+        if (clock.elapsed() - rate.windowStart.load(std::memory_order_relaxed) < 1000)
+            continue;
+
+        const int suppressedCount = rate.suppressed.exchange(0);
+        if (suppressedCount > 0)
+        {
+            const QByteArray line = QString("Rate limit of %1 %2 messages per second was exceeded, %3 messages were suppressed\n")
+                                    .arg(getRateLimit((QtMsgType)i)).arg(typeNames[i]).arg(suppressedCount).toLocal8Bit();
+            fileBatch += line;
+            errBatch += line;
+        }
+    }
+
+    if (fileBatch.isEmpty())
+        return;
+
+    if (!outBatch.isEmpty())
+        std::cout.write(outBatch.constData(), outBatch.size()).flush();
+
+    if (!errBatch.isEmpty())
+        std::cerr.write(errBatch.constData(), errBatch.size()).flush();
+
+    if (file)
+    {
+        fwrite(fileBatch.constData(), 1, fileBatch.size(), file);
+        fflush(file);
+
+        if (ftell(file) > maxFileSize)
+            rotate();
+    }
+}
+
+void Logger::rotate()
+{
+    emergencyFd = -1;
+    fclose(file);
+
+    // Shift the old log files by one, the oldest one is overwritten
+    for (int i = backupCount - 1; i >= 1; --i)
+    {
+        const QString from = QString("%1.%2").arg(path).arg(i);
+        const QString to = QString("%1.%2").arg(path).arg(i + 1);
+
+        QFile::remove(to);
+        QFile::rename(from, to);
+    }
+
+    QFile::remove(path + ".1");
+    QFile::rename(path, path + ".1");
+
+    file = fopen(QFile::encodeName(path).constData(), "a");
+    emergencyFd = file ? fileno(file) : -1;
+    if (!file)
+        std::cerr << "Unable to open log file " << path.toStdString() << " after rotating it" << std::endl;
+}
+
+void Logger::flush(int timeout)
+{
+    // A critical message that is logged from the signal handler must not lock or allocate either
+    if (crashed)
+    {
+        emergencyFlush();
+        return;
+    }
+
+    // A thread that crashed while holding the lock would make this wait forever, so the lock is only tried until the timeout
+    std::unique_lock<std::mutex> lock(writeMutex, std::defer_lock);
+    QElapsedTimer timer;
+    timer.start();
+
+    while (!lock.try_lock())
+    {
+        if (timer.elapsed() >= timeout)
+            return;
+
+        std::this_thread::yield();
+    }
+
+    write();
+}
+
+/* emergencyFlush writes the messages in the buffer after the process crashed. The messages are read in place and encoded as
+ * UTF-8 into the emergency buffer, which is written to the log file and standard error whenever it is full. The writer
+ * thread is not waited for, a message it is writing at the same time may be written twice.
+ */
+void Logger::emergencyFlush()
+{
+    crashed = true;
+
+    char *buffer = emergencyBuffer.get();
+    size_t length = 0;
+
+    auto output = [&]()
+    {
+        writeAll(emergencyFd, buffer, length);
+        writeAll(2, buffer, length);
+        length = 0;
+    };
+
+    for (size_t position = popPosition; ; ++position)
+    {
+        Slot &slot = slots[position & (capacity - 1)];
+        if (slot.sequence.load(std::memory_order_acquire) != position + 1)
+            break;
+
+        const ushort *chars = slot.message.utf16();
+        const int size = slot.message.size();
+
+        for (int i = 0; i < size; ++i)
+        {
+            // Room for the longest character and the line ending
+            if (length + 5 > emergencyBufferSize)
+                output();
+
+            unsigned int code = chars[i];
+            if (code >= 0xD800 && code < 0xDC00 && i + 1 < size && chars[i + 1] >= 0xDC00 && chars[i + 1] < 0xE000)
+                code = 0x10000 + ((code - 0xD800) << 10) + (chars[++i] - 0xDC00);
+            else if (code >= 0xD800 && code < 0xE000)
+                code = '?';
+
+            if (code < 0x80)
+            {
+                buffer[length++] = (char)code;
+            }
+            else if (code < 0x800)
+            {
+                buffer[length++] = (char)(0xC0 | (code >> 6));
+                buffer[length++] = (char)(0x80 | (code & 0x3F));
+            }
+            else if (code < 0x10000)
+            {
+                buffer[length++] = (char)(0xE0 | (code >> 12));
+                buffer[length++] = (char)(0x80 | ((code >> 6) & 0x3F));
+                buffer[length++] = (char)(0x80 | (code & 0x3F));
+            }
+            else
+            {
+                buffer[length++] = (char)(0xF0 | (code >> 18));
+                buffer[length++] = (char)(0x80 | ((code >> 12) & 0x3F));
+                buffer[length++] = (char)(0x80 | ((code >> 6) & 0x3F));
+                buffer[length++] = (char)(0x80 | (code & 0x3F));
+            }
+        }
+
+        if (length + 1 > emergencyBufferSize)
+            output();
+        buffer[length++] = '\n';
+
+        // The string is left in the slot since freeing it would use the heap
+        slot.sequence.store(position + capacity, std::memory_order_release);
+        popPosition = position + 1;
+    }
+
+    if (length > 0)
+        output();
+}
+
+void Logger::writeAll(int fd, const char *data, size_t length)
+{
+    while (fd >= 0 && length > 0)
+    {
+#ifdef Q_OS_WIN
+        const int written = _write(fd, data, (unsigned int)length);
+#else // Q_OS_WIN
+        const ssize_t written = ::write(fd, data, length);
+#endif // Q_OS_WIN
+        if (written <= 0)
+            return;
+
+        data += written;
+        length -= (size_t)written;
+    }
+}
+
+void Logger::writerLoop()
+{
+    while (running)
+    {
+        {
+            std::unique_lock<std::mutex> lock(wakeMutex);
+            wakeCondition.wait_for(lock, std::chrono::milliseconds(flushInterval));
+        }
+
+        std::lock_guard<std::mutex> lock(writeMutex);
+        write();
+    }
+}
+
+Logger::~Logger()
+{
+    stop();
+}
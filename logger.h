@@ -0,0 +1,121 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <QString>
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QtGlobal>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <iostream>
+#include <cstdio>
+
+/* Logger writes the log messages to the log file and the console on a background thread so that logging does not block the
+ * thread that logs the message.
+ *
+ * Messages are pushed to a fixed size ring buffer that any number of threads can push to without locking. The writer thread
+ * takes every message in the buffer at once, writes them and then flushes the file one time for the entire batch. If the
+ * buffer is full the message is dropped and the number of dropped messages is written instead.
+ *
+ * Each message type is limited to a number of messages per second, the rest are counted and the count is written once the
+ * second is over. Fatal messages are never limited.
+ *
+ * The log file is rotated when it grows larger than maxFileSize. The current file is renamed to <path>.1, <path>.1 to
+ * <path>.2 and so on, keeping up to backupCount old files.
+ *
+ * Note: flush writes every message in the buffer from the calling thread. It is called for critical and fatal messages so
+ * that they are in the log file even if the application does not survive. The signal handler calls emergencyFlush instead,
+ * since the crash may have happened while the logger or the heap was locked. It does not lock or allocate, the messages are
+ * encoded into a buffer that was allocated up front and written with write(2) to the log file and the console.
+ */
+class Logger
+{
+private:
+    struct Slot
+    {
+        // Equal to the position in the buffer plus one when the slot has a message that has not been written, see push and pop
+        std::atomic<size_t> sequence;
+        QtMsgType type;
+        QString message;
+    };
+
+    struct RateLimit
+    {
+        std::atomic<qint64> windowStart;
+        std::atomic<int> count;
+        std::atomic<int> suppressed;
+    };
+
+    // Number of slots in the ring buffer, this must be a power of two
+    static constexpr size_t capacity = 4096;
+    static constexpr int messageTypeCount = QtInfoMsg + 1;
+
+    std::unique_ptr<Slot[]> slots;
+    std::atomic<size_t> pushPosition;
+    size_t popPosition;
+
+    std::atomic<int> dropped;
+    RateLimit rateLimits[messageTypeCount];
+    QElapsedTimer clock;
+
+    QString path;
+    FILE *file;
+
+    // Descriptor of the log file and the buffer that emergencyFlush writes with. Once it is called, the process has crashed
+    // and flush writes with it as well
+    static constexpr size_t emergencyBufferSize = 64 * 1024;
+    std::atomic<int> emergencyFd;
+    std::unique_ptr<char[]> emergencyBuffer;
+    std::atomic<bool> crashed;
+
+    // Only one thread can take messages from the buffer at a time. This is only locked by the writer thread and flush, the
+    // threads that push messages never lock it
+    std::mutex writeMutex;
+
+    std::thread writerThread;
+    std::atomic<bool> running;
+    std::mutex wakeMutex;
+    std::condition_variable wakeCondition;
+
+    bool pop(QtMsgType &type, QString &message);
+    void write();
+    void rotate();
+    void writerLoop();
+
+    static void writeAll(int fd, const char *data, size_t length);
+
+public:
+    static constexpr qint64 maxFileSize = 5 * 1024 * 1024;
+    static constexpr int backupCount = 3;
+    // Time between batches written by the writer thread in milliseconds
+    static constexpr int flushInterval = 100;
+
+    Logger();
+    ~Logger();
+
+    // Opens the log file in append mode and starts the writer thread. Messages are still written to the console if the file
+    // can not be opened
+    bool start(QString path);
+    // Writes the remaining messages, stops the writer thread and closes the log file
+    void stop();
+
+    // Returns false if the message was suppressed by the rate limit or dropped because the buffer is full
+    bool push(QtMsgType type, const QString &message);
+
+    // Writes every message in the buffer from the calling thread. If the writer thread is in the middle of writing, this
+    // waits for up to timeout milliseconds before giving up
+    void flush(int timeout = 1000);
+
+    // Writes every message in the buffer without locking or allocating so that it can be called from a signal handler
+    void emergencyFlush();
+
+    static int getRateLimit(QtMsgType type);
+};
+
+extern Logger *globalLogger;
+
+#endif // LOGGER_H
@@ -1,12 +1,39 @@
 #include "mainwindow.h"
 #include "application.h"
 #include "stacktrace.h"
+#include "logger.h"
+#include "tracingagreement.h"
 
+#include <QCommandLineParser>
+#include <QThread>
 #include <opencv2/opencv.hpp>
+#include <cmath>
 
 MainWindow *w = NULL;
 Application *app = NULL;
-FILE *logFh = NULL;
+QElapsedTimer startupTimer;
+
+/* showMessageBox shows a warning or critical message box for a message. Widgets can only be created on the GUI thread, so a
+ * message from a worker thread is shown once the event loop of the GUI thread gets to it.
+ */
+void showMessageBox(QtMsgType type, QString title, QString msg)
+{
+    if (!w)
+        return;
+
+    auto show = [type, title, msg]()
+    {
+        if (type == QtWarningMsg)
+            QMessageBox::warning(w, title, msg, QMessageBox::Ok);
+        else
+            QMessageBox::critical(w, title, msg, QMessageBox::Ok);
+    };
+
+    if (QThread::currentThread() == QCoreApplication::instance()->thread())
+        show();
+    else
+        QMetaObject::invokeMethod(w, show, Qt::QueuedConnection);
+}
 
 void messageLogger(QtMsgType type, const QMessageLogContext &context, const QString &msg)
 {
@@ -20,83 +47,198 @@ void messageLogger(QtMsgType type, const QMessageLogContext &context, const QStr
     }
 #endif
 
-    // Open the log file and write the formatted log message
-    QTextStream out(logFh, QIODevice::WriteOnly);
-    out << formattedMsg << endl;
-    out.flush(); // Flush so that the changes are seen immediately
+    // The message is written to the log file and console by the writer thread of the logger. Before the logger is started
+    // and after it is stopped, the message is written directly to the console
+    if (globalLogger)
+        globalLogger->push(type, formattedMsg);
+    else
+        std::cerr << formattedMsg.toStdString() << std::endl;
 
     switch (type)
     {
         case QtDebugMsg:
-            std::cout << formattedMsg.toStdString() << std::endl;
-            break;
-
         case QtInfoMsg:
-            std::cout << formattedMsg.toStdString() << std::endl;
             break;
 
         // For warning, critical, and fatal errors, show a message box to the user
         // Note: Displaying a message box before the window is initialized causes it to crash
         case QtWarningMsg:
-            std::cerr << formattedMsg.toStdString() << std::endl;
-            if (w)
-                QMessageBox::warning(w, QObject::tr("%1:%2").arg(context.function).arg(context.line), msg, QMessageBox::Ok);
+            showMessageBox(type, QObject::tr("%1:%2").arg(context.function).arg(context.line), msg);
             break;
 
+        // Critical and fatal errors are written right away since the application may not survive long enough for the
+        // writer thread to write them
         case QtCriticalMsg:
-            std::cerr << formattedMsg.toStdString() << std::endl;
-            if (w)
-                QMessageBox::critical(w, QObject::tr("%1:%2").arg(context.function).arg(context.line), msg, QMessageBox::Ok);
+            if (globalLogger)
+                globalLogger->flush();
+
+            showMessageBox(type, QObject::tr("%1:%2").arg(context.function).arg(context.line), msg);
             break;
 
         case QtFatalMsg:
-            std::cerr << formattedMsg.toStdString() << std::endl;
-            if (w)
+            if (globalLogger)
+                globalLogger->flush();
+
+            // The application is aborted before a message box from a worker thread could be shown, the message is only in
+            // the log then
+            if (w && QThread::currentThread() == QCoreApplication::instance()->thread())
                 QMessageBox::critical(w, QObject::tr("%1:%2").arg(context.function).arg(context.line), msg, QMessageBox::Ok);
             abort();
     }
 }
 
+/* compareTracingResults compares the tracing results files of a subject from the command line without showing the window,
+ * this is used to compute agreement tables for many subjects in a script. See the help text for the arguments.
+ *
+ * Returns:
+ *      int - Exit code of the application, 0 on success
+ */
+int compareTracingResults(const QStringList &arguments)
+{
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Compares the tracing results of a subject and writes a table of the agreement between each pair of results.");
+    parser.addHelpOption();
+    parser.addOption(QCommandLineOption("compare", "Compare tracing results without opening the window."));
+    parser.addOption(QCommandLineOption(QStringList() << "o" << "output", "Write the agreement table to <file> instead of the console.", "file"));
+    parser.addOption(QCommandLineOption("volume-only", "Only write the agreement of the whole volume and not of each slice."));
+    parser.addOption(QCommandLineOption("operation", "Combine the tracing results with <operation> (union, intersect, xor or difference).", "operation"));
+    parser.addOption(QCommandLineOption("combined", "Save the combined tracing results to <file>.", "file"));
+    parser.addPositionalArgument("subject", "Subject image (SDI) that was traced.");
+    parser.addPositionalArgument("results", "Two or more tracing results (SDT) files of the subject.", "results...");
+    parser.process(arguments);
+
+    const QStringList positional = parser.positionalArguments();
+    if (positional.size() < 3)
+    {
+        qWarning() << "A subject image and at least two tracing results files are required";
+        return -1;
+    }
+
+    // The image is only loaded for the dimensions and voxel size of the subject
+    WorklistItem item;
+    item.imagePath = positional[0];
+    std::shared_ptr<PreparedSubject> subject = Worklist::prepare(item);
+    if (!subject->loaded)
+        return -1;
+
+    const nifti_image *image = subject->fatImage.getUpperImage();
+    TracingAgreement agreement(subject->fatImage.getXDim(), subject->fatImage.getYDim(), subject->fatImage.getZDim(),
+                               std::fabs(image->dx), std::fabs(image->dy), std::fabs(image->dz));
+
+    for (int i = 1; i < positional.size(); ++i)
+    {
+        if (!agreement.addResults(QFileInfo(positional[i]).completeBaseName(), positional[i]))
+            return -1;
+    }
+
+    const std::vector<AgreementRow> rows = agreement.compute(!parser.isSet("volume-only"));
+
+    if (parser.isSet("output"))
+    {
+        QFile file(parser.value("output"));
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text))
+        {
+            qWarning() << "Unable to open agreement table file: " << parser.value("output");
+            return -1;
+        }
+
+        QTextStream stream(&file);
+        agreement.writeTable(stream, rows);
+    }
+    else
+    {
+        QTextStream stream(stdout);
+        agreement.writeTable(stream, rows);
+    }
+
+    if (parser.isSet("operation"))
+    {
+        SetOperation op;
+        if (!TracingAgreement::operationFromName(parser.value("operation"), op) || !parser.isSet("combined"))
+        {
+            qWarning() << "A valid operation and a file for the combined tracing results are required: " << parser.value("operation");
+            return -1;
+        }
+
+        // The result sets are combined in the order they are given
+        TracingData combined;
+        TracingAgreement::combine(agreement.getResults(0), agreement.getResults(1), op, combined);
+        for (int i = 2; i < agreement.count(); ++i)
+            TracingAgreement::combine(combined, agreement.getResults(i), op, combined);
+
+        if (!Worklist::save(parser.value("combined"), combined))
+            return -1;
+    }
+
+    return 0;
+}
+
 int main(int argc, char *argv[])
 {
+    startupTimer.start();
     int ret = -1;
 
     try
     {
-        // Open the log file that will record all information sent to the console
-        if (!(logFh = fopen("./error.log", "a")))
-            qWarning() << "Unable to open log file ./error.log. Errors will not be logged in a text file";
+        // Open the log file that will record all information sent to the console, the file is written on a background thread
+        globalLogger = new Logger();
+        bool logOpened = globalLogger->start("./error.log");
 
         qInstallMessageHandler(messageLogger);
         qSetMessagePattern("[%{time MM/dd/yyyy h:mm:ss}] [%{if-debug}Debug%{endif}%{if-info}Info%{endif}%{if-warning}Warn%{endif}%{if-critical}Crit%{endif}%{if-fatal}Fatal%{endif}] %{function}:%{line} - %{message}");
 
+        if (!logOpened)
+            qWarning() << "Unable to open log file ./error.log. Errors will not be logged in a text file";
+
         // Set globalProgramName for stack trace retriever. Set signal handler to print stack trace on exception
         globalProgramName = argv[0];
         setSignalHandler();
 
-        app = new Application(argc, argv);
-        QCoreApplication::setOrganizationName("Southern Illinois University Edwardsville");
-        QCoreApplication::setApplicationName("SIUE Fat Segmentation Tool");
-        QCoreApplication::setApplicationVersion(APP_VERSION);
+        // Tracing results can be compared from the command line without creating the window
+        bool compare = false;
+        for (int i = 1; i < argc; ++i)
+            compare |= (QString(argv[i]) == "--compare");
 
-        QSurfaceFormat format;
+        if (compare)
+        {
+            QCoreApplication coreApp(argc, argv);
+            QCoreApplication::setOrganizationName("Southern Illinois University Edwardsville");
+            QCoreApplication::setApplicationName("SIUE Fat Segmentation Tool");
+            QCoreApplication::setApplicationVersion(APP_VERSION);
+
+            ret = compareTracingResults(coreApp.arguments());
+        }
+        else
+        {
+            // Every QOpenGLWidget shares OpenGL objects with each other so that the shader programs, buffers and color maps are
+            // only created once. This must be set before the application is created
+            QCoreApplication::setAttribute(Qt::AA_ShareOpenGLContexts);
+
+            app = new Application(argc, argv);
+            QCoreApplication::setOrganizationName("Southern Illinois University Edwardsville");
+            QCoreApplication::setApplicationName("SIUE Fat Segmentation Tool");
+            QCoreApplication::setApplicationVersion(APP_VERSION);
+
+            QSurfaceFormat format;
 #ifdef Q_OS_MACOS
-        // Mac OS X only allows core profiles to be used
-        // QPainter is used in this application which is based off OpenGL 2.0 but the actual OpenGL used in the shaders
-        // for drawing slices is OpenGL 3.3.
-        // Luckily, Qt 5.9 provides support where it brings QPainter up to date in OpenGL (I think)
-        // To build on Mac, YOU MUST USE AT LEAST Qt 5.9!
-        format.setProfile(QSurfaceFormat::CoreProfile);
-        format.setVersion(3, 3);
+            // Mac OS X only allows core profiles to be used
+            // QPainter is used in this application which is based off OpenGL 2.0 but the actual OpenGL used in the shaders
+            // for drawing slices is OpenGL 3.3.
+            // Luckily, Qt 5.9 provides support where it brings QPainter up to date in OpenGL (I think)
+            // To build on Mac, YOU MUST USE AT LEAST Qt 5.9!
+            format.setProfile(QSurfaceFormat::CoreProfile);
+            format.setVersion(3, 3);
 #else // Q_OS_MACOS
-        format.setProfile(QSurfaceFormat::CompatibilityProfile);
+            format.setProfile(QSurfaceFormat::CompatibilityProfile);
 #endif // Q_OS_MACOS
-        QSurfaceFormat::setDefaultFormat(format);
+            QSurfaceFormat::setDefaultFormat(format);
 
-        w = new MainWindow();
-        w->show();
+            w = new MainWindow();
+            w->show();
+            qInfo() << "Main window created after" << startupTimer.elapsed() << "ms";
 
-        ret = app->exec();
+            ret = app->exec();
+        }
     }
     catch (const std::logic_error &e)
     {
@@ -127,8 +269,13 @@ int main(int argc, char *argv[])
     if (app)
         delete app;
 
-    if (logFh)
-        fclose(logFh);
+    // Write the remaining messages and close the log file
+    if (globalLogger)
+    {
+        globalLogger->stop();
+        delete globalLogger;
+        globalLogger = NULL;
+    }
 
     return ret;
 }
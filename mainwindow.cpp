@@ -1,11 +1,12 @@
 #include "mainwindow.h"
 #include "ui_mainwindow.h"
+#include "application.h"
 
 MainWindow::MainWindow(QWidget *parent) :
     QMainWindow(parent),
     ui(new Ui::MainWindow),
     fatImage(new NIFTImage()), waterImage(new NIFTImage()), subConfig(new SubjectConfig()), tracingData(new TracingData()),
-    imageZip(NULL), tracingResultsZip(NULL)
+    imageZip(NULL), tracingResultsZip(NULL), subjectCache(new SubjectCache()), worklist(new Worklist()), axialWidget(NULL), coronalWidget(NULL)
 {  
     this->fatImage->setSubjectConfig(subConfig);
     this->waterImage->setSubjectConfig(subConfig);
@@ -14,13 +15,14 @@ MainWindow::MainWindow(QWidget *parent) :
     readSettings();
 
     this->ui->setupUi(this);
+    this->ui->actionRecordViewHistory->setChecked(recordViewHistory);
 
     // Setup the initial view
     this->switchView(windowViewType);
 
-    // If updates have not been checked within the last day, then check for updates
-    if (QDateTime::currentDateTime() >= lastUpdateCheck.addDays(1))
-        this->checkForUpdates();
+    // Work that is not needed to show the window is done once the first frame has been drawn. The connection is queued so
+    // that it runs after the frame is finished
+    connect(axialWidget, SIGNAL(firstFrameRendered()), this, SLOT(finishStartup()), Qt::QueuedConnection);
 
     // Apply keyboard shortcuts to the menu items. The benefit of using a predefined
     // key sequence is that it has the list of valid shortcuts for each platform and
@@ -29,6 +31,8 @@ MainWindow::MainWindow(QWidget *parent) :
     this->ui->actionSave->setShortcut(util::getStandardSequence(QKeySequence::Save, QKeySequence("Ctrl+S")));
     this->ui->actionSaveAs->setShortcut(util::getStandardSequence(QKeySequence::SaveAs, QKeySequence("Ctrl+Shift+S")));
     this->ui->actionImportTracingData->setShortcut(QKeySequence("Ctrl+I"));
+    this->ui->actionNextSubject->setShortcut(QKeySequence("Ctrl+PgDown"));
+    this->ui->actionPreviousSubject->setShortcut(QKeySequence("Ctrl+PgUp"));
     this->ui->actionExit->setShortcut(util::getStandardSequence(QKeySequence::Close, QKeySequence("Alt+F4")));
     this->ui->actionUndo->setShortcut(util::getStandardSequence(QKeySequence::Undo, QKeySequence("Ctrl+Z")));
 
@@ -71,6 +75,10 @@ void MainWindow::readSettings()
     defaultSavePath = settings.value("defaultSavePath", QDir::homePath()).toString();
 
     lastUpdateCheck = settings.value("lastUpdateCheck", QDateTime::fromSecsSinceEpoch(1)).toDateTime();
+
+    recordViewHistory = settings.value("recordViewHistory", true).toBool();
+
+    subjectCache->setMemoryBudget((size_t)settings.value("subjectCacheBudget", 2048).toULongLong() * 1024 * 1024);
 }
 
 void MainWindow::writeSettings()
@@ -87,6 +95,10 @@ void MainWindow::writeSettings()
     settings.setValue("defaultSavePath", defaultSavePath);
 
     settings.setValue("lastUpdateCheck", lastUpdateCheck);
+
+    settings.setValue("recordViewHistory", ui->actionRecordViewHistory->isChecked());
+
+    settings.setValue("subjectCacheBudget", (qulonglong)(subjectCache->getMemoryBudget() / (1024 * 1024)));
 }
 
 void MainWindow::on_actionExit_triggered()
@@ -135,8 +147,6 @@ void MainWindow::switchView(WindowViewType type)
             auto newView = new viewAxialCoronalLoRes(this, fatImage, waterImage, subConfig, tracingData);
             this->setCentralWidget(newView);
             ui->actionAxialCoronalLoRes->setChecked(true);
-            newView->readSettings();
-            newView->setupDefaults();
         }
         break;
 
@@ -148,8 +158,6 @@ void MainWindow::switchView(WindowViewType type)
             auto newView = new viewAxialCoronalHiRes(this, fatImage, waterImage, subConfig, tracingData);
             this->setCentralWidget(newView);
             ui->actionAxialCoronalHiRes->setChecked(true);
-            newView->readSettings();
-            newView->setupDefaults();
         }
         break;
     }
@@ -157,6 +165,15 @@ void MainWindow::switchView(WindowViewType type)
     windowViewType = type;
 }
 
+void MainWindow::finishStartup()
+{
+    qInfo() << "Time to first frame:" << startupTimer.elapsed() << "ms";
+
+    // If updates have not been checked within the last day, then check for updates
+    if (QDateTime::currentDateTime() >= lastUpdateCheck.addDays(1))
+        this->checkForUpdates();
+}
+
 void MainWindow::checkForUpdates(bool userRequestedUpdate)
 {
     qDebug() << "Checking for updates...";
@@ -310,6 +327,10 @@ MainWindow::~MainWindow()
     delete waterImage;
     delete subConfig;
     delete tracingData;
+    delete subjectCache;
+
+    // Waits for the tracing data that is being saved
+    delete worklist;
 
     delete imageZip;
     delete tracingResultsZip;
@@ -27,6 +27,11 @@
 #include "exception.h"
 #include "subjectconfig.h"
 #include "tracing.h"
+#include "subjectcache.h"
+#include "worklist.h"
+
+#include "axialslicewidget.h"
+#include "coronalslicewidget.h"
 
 #include "view_axialcoronallores.h"
 #include "view_axialcoronalhires.h"
@@ -58,8 +63,21 @@ protected:
     QuaZip *imageZip;
     QuaZip *tracingResultsZip;
 
+    // Subjects that were opened before the current one, so switching back to them does not load the images again
+    SubjectCache *subjectCache;
+
+    // Subjects that are traced in sequence with the next and previous subject actions
+    Worklist *worklist;
+
     WindowViewType windowViewType;
 
+    // The slice widgets are created by the first view and moved into each new view when switching views. This keeps the OpenGL
+    // textures and view state of the widgets instead of creating and uploading them again
+    AxialSliceWidget *axialWidget;
+    CoronalSliceWidget *coronalWidget;
+
+    bool recordViewHistory;
+
     const QString updateURLString = "https://api.github.com/repos/addisonElliott/SIUE-Fat-Segmentation-Tool/releases/latest";
     const QString manualURLString = "https://github.com/addisonElliott/SIUE-Fat-Segmentation-Tool/releases/latest";
 
@@ -78,6 +96,9 @@ public:
     friend class viewAxialCoronalHiRes;
 
 private slots:
+    // Performs the startup work that is deferred until the first frame is drawn
+    void finishStartup();
+
     void networkManager_replyFinished(QNetworkReply *reply);
 
     void on_actionExit_triggered();
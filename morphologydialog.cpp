@@ -0,0 +1,118 @@
+#include "morphologydialog.h"
+
+// Range of slices that the operation is applied to
+enum MorphologyRange
+{
+    CurrentSlice = 0,
+    AllSlices,
+    SliceRange
+};
+
+MorphologyOptions MorphologyDialog::lastOptions;
+int MorphologyDialog::lastRange = CurrentSlice;
+
+MorphologyDialog::MorphologyDialog(int zDim, int currentZ, QWidget *parent) : QDialog(parent), currentZ(currentZ)
+{
+    setWindowTitle(tr("Morphology"));
+
+    operationComboBox = new QComboBox(this);
+    for (int i = 0; i < (int)MorphologyOperation::Count; ++i)
+        operationComboBox->addItem(TracingMorphology::operationName((MorphologyOperation)i));
+    operationComboBox->setCurrentIndex((int)lastOptions.operation);
+
+    radiusSpinBox = new QSpinBox(this);
+    radiusSpinBox->setRange(1, TracingMorphology::maxRadius);
+    radiusSpinBox->setValue(lastOptions.radius);
+
+    threeDCheckBox = new QCheckBox(tr("3D (across axial slices)"), this);
+    threeDCheckBox->setChecked(lastOptions.threeD);
+
+    minSizeSpinBox = new QSpinBox(this);
+    minSizeSpinBox->setRange(1, 1000000);
+    minSizeSpinBox->setSuffix(tr(" voxels"));
+    minSizeSpinBox->setValue(lastOptions.minComponentSize);
+
+    rangeComboBox = new QComboBox(this);
+    rangeComboBox->addItems({ tr("Current Slice"), tr("All Slices"), tr("Slices") });
+    rangeComboBox->setCurrentIndex(lastRange);
+
+    zStartSpinBox = new QSpinBox(this);
+    zStartSpinBox->setRange(0, zDim - 1);
+    zStartSpinBox->setValue(std::min(lastOptions.zStart, zDim - 1));
+
+    zEndSpinBox = new QSpinBox(this);
+    zEndSpinBox->setRange(0, zDim - 1);
+    zEndSpinBox->setValue(std::min(std::max(lastOptions.zEnd - 1, 0), zDim - 1));
+
+    QHBoxLayout *sliceLayout = new QHBoxLayout();
+    sliceLayout->addWidget(zStartSpinBox);
+    sliceLayout->addWidget(new QLabel(tr("to"), this));
+    sliceLayout->addWidget(zEndSpinBox);
+
+    QDialogButtonBox *buttonBox = new QDialogButtonBox(QDialogButtonBox::Ok | QDialogButtonBox::Cancel, this);
+
+    QFormLayout *layout = new QFormLayout(this);
+    layout->addRow(tr("Operation:"), operationComboBox);
+    layout->addRow(tr("Radius:"), radiusSpinBox);
+    layout->addRow(tr("Minimum Size:"), minSizeSpinBox);
+    layout->addRow(QString(), threeDCheckBox);
+    layout->addRow(tr("Apply To:"), rangeComboBox);
+    layout->addRow(tr("Slices:"), sliceLayout);
+    layout->addRow(buttonBox);
+
+    connect(operationComboBox, SIGNAL(currentIndexChanged(int)), this, SLOT(updateControls()));
+    connect(rangeComboBox, SIGNAL(currentIndexChanged(int)), this, SLOT(updateControls()));
+    connect(buttonBox, SIGNAL(accepted()), this, SLOT(accept()));
+    connect(buttonBox, SIGNAL(rejected()), this, SLOT(reject()));
+
+    updateControls();
+}
+
+void MorphologyDialog::updateControls()
+{
+    const MorphologyOperation operation = (MorphologyOperation)operationComboBox->currentIndex();
+    const bool structuringElement = (operation != MorphologyOperation::FillHoles && operation != MorphologyOperation::RemoveSmallComponents);
+
+    radiusSpinBox->setEnabled(structuringElement);
+    minSizeSpinBox->setEnabled(operation == MorphologyOperation::RemoveSmallComponents);
+
+    zStartSpinBox->setEnabled(rangeComboBox->currentIndex() == SliceRange);
+    zEndSpinBox->setEnabled(rangeComboBox->currentIndex() == SliceRange);
+}
+
+MorphologyOptions MorphologyDialog::getOptions() const
+{
+    MorphologyOptions options;
+    options.operation = (MorphologyOperation)operationComboBox->currentIndex();
+    options.radius = radiusSpinBox->value();
+    options.threeD = threeDCheckBox->isChecked();
+    options.minComponentSize = minSizeSpinBox->value();
+
+    switch (rangeComboBox->currentIndex())
+    {
+        case CurrentSlice:
+            options.zStart = currentZ;
+            options.zEnd = currentZ + 1;
+            break;
+
+        case AllSlices:
+            options.zStart = 0;
+            options.zEnd = zStartSpinBox->maximum() + 1;
+            break;
+
+        default:
+            options.zStart = std::min(zStartSpinBox->value(), zEndSpinBox->value());
+            options.zEnd = std::max(zStartSpinBox->value(), zEndSpinBox->value()) + 1;
+            break;
+    }
+
+    return options;
+}
+
+void MorphologyDialog::accept()
+{
+    lastOptions = getOptions();
+    lastRange = rangeComboBox->currentIndex();
+
+    QDialog::accept();
+}
@@ -0,0 +1,48 @@
+#ifndef MORPHOLOGYDIALOG_H
+#define MORPHOLOGYDIALOG_H
+
+#include <QDialog>
+#include <QComboBox>
+#include <QSpinBox>
+#include <QCheckBox>
+#include <QLabel>
+#include <QFormLayout>
+#include <QHBoxLayout>
+#include <QDialogButtonBox>
+
+#include "tracingmorphology.h"
+
+/* MorphologyDialog asks for the operation, structuring element and slab of a morphological operation on the current tracing
+ * layer. The options that were last accepted are shown again the next time the dialog is opened.
+ */
+class MorphologyDialog : public QDialog
+{
+    Q_OBJECT
+
+private:
+    QComboBox *operationComboBox;
+    QSpinBox *radiusSpinBox;
+    QCheckBox *threeDCheckBox;
+    QSpinBox *minSizeSpinBox;
+    QComboBox *rangeComboBox;
+    QSpinBox *zStartSpinBox;
+    QSpinBox *zEndSpinBox;
+
+    int currentZ;
+
+    static MorphologyOptions lastOptions;
+    static int lastRange;
+
+public:
+    // zDim is the number of axial slices and currentZ is the current axial slice
+    MorphologyDialog(int zDim, int currentZ, QWidget *parent = NULL);
+
+    MorphologyOptions getOptions() const;
+
+    void accept() override;
+
+private slots:
+    void updateControls();
+};
+
+#endif // MORPHOLOGYDIALOG_H
@@ -1,6 +1,10 @@
 #include "niftimage.h"
 
-NIFTImage::NIFTImage() : upper(NULL), lower(NULL), subConfig(NULL), xDim(0), yDim(0), zDim(0)
+constexpr int NIFTImage::histogramBins;
+
+bool NIFTImage::transposeEnabled = true;
+
+NIFTImage::NIFTImage() : upper(NULL), lower(NULL), subConfig(NULL), xDim(0), yDim(0), zDim(0), transposeRunning(false)
 {
 
 }
@@ -37,6 +41,9 @@ bool NIFTImage::setImage(nifti_image *upper, nifti_image *lower, SubjectConfig *
         return false;
     }
 
+    // The transposed copy belongs to the previous image, a build that is running still reads from the old data matrix
+    releaseTransposedData();
+
     // If there are previous upper and lower images, free the nifti files
     if (this->upper && this->lower)
     {
@@ -130,9 +137,113 @@ bool NIFTImage::setImage(nifti_image *upper, nifti_image *lower, SubjectConfig *
 //    opencv::flip(data, dataFlipped, 0);
 //    opencv::flip(dataFlipped, data, 1);
 
+    computeStatistics();
+
     return true;
 }
 
+/* computeStatistics calculates the histogram, percentiles and the minimum/maximum of each axial and coronal slice for
+ * the data matrix. This is done once when the image is set so that the slices can be windowed when displayed without
+ * scanning the voxels again.
+ *
+ * The work is split up by axial slices and done in parallel. The first pass finds the minimum/maximum of each row of each
+ * axial slice, which gives the axial windows directly and the coronal windows by combining the rows with the same Y. The
+ * second pass fills the histogram using the global minimum/maximum from the first pass.
+ */
+void NIFTImage::computeStatistics()
+{
+    if (data.empty())
+        return;
+
+    // Minimum/maximum of each row (Y) in each axial slice (Z) stored as zDim x yDim
+    std::vector<IntensityWindow> rowWindows(zDim * yDim);
+    const int dims[] = { yDim, xDim };
+
+    cv::parallel_for_(cv::Range(0, zDim), [&](const cv::Range &range)
+    {
+        for (int z = range.start; z < range.end; ++z)
+        {
+            const cv::Range region[] = { cv::Range(z, z + 1), cv::Range::all(), cv::Range::all() };
+            const cv::Mat slice = cv::Mat(data, region).reshape(0, 2, dims);
+
+            for (int y = 0; y < yDim; ++y)
+                cv::minMaxLoc(slice.row(y), &rowWindows[z * yDim + y].min, &rowWindows[z * yDim + y].max);
+        }
+    });
+
+    axialWindows.assign(zDim, IntensityWindow(std::numeric_limits<double>::max(), std::numeric_limits<double>::lowest()));
+    coronalWindows.assign(yDim, IntensityWindow(std::numeric_limits<double>::max(), std::numeric_limits<double>::lowest()));
+
+    for (int z = 0; z < zDim; ++z)
+    {
+        for (int y = 0; y < yDim; ++y)
+        {
+            const IntensityWindow &row = rowWindows[z * yDim + y];
+
+            axialWindows[z].min = std::min(axialWindows[z].min, row.min);
+            axialWindows[z].max = std::max(axialWindows[z].max, row.max);
+            coronalWindows[y].min = std::min(coronalWindows[y].min, row.min);
+            coronalWindows[y].max = std::max(coronalWindows[y].max, row.max);
+        }
+    }
+
+    globalWindow = IntensityWindow(std::numeric_limits<double>::max(), std::numeric_limits<double>::lowest());
+    for (const IntensityWindow &window : axialWindows)
+    {
+        globalWindow.min = std::min(globalWindow.min, window.min);
+        globalWindow.max = std::max(globalWindow.max, window.max);
+    }
+
+    // Each stripe fills its own histogram and then adds it to the total
+    histogram.assign(histogramBins, 0);
+    const double binScale = (globalWindow.max > globalWindow.min) ? histogramBins / (globalWindow.max - globalWindow.min) : 0.0;
+    std::mutex histogramMutex;
+
+    cv::parallel_for_(cv::Range(0, zDim), [&](const cv::Range &range)
+    {
+        std::vector<int> localHistogram(histogramBins, 0);
+        cv::Mat slice;
+
+        for (int z = range.start; z < range.end; ++z)
+        {
+            const cv::Range region[] = { cv::Range(z, z + 1), cv::Range::all(), cv::Range::all() };
+
+            // Convert the slice to bin indices. convertTo rounds to the nearest integer so half a bin is subtracted to floor it
+            cv::Mat(data, region).reshape(0, 2, dims).convertTo(slice, CV_32S, binScale, -globalWindow.min * binScale - 0.5);
+
+            for (int y = 0; y < yDim; ++y)
+            {
+                const int *bin = slice.ptr<int>(y);
+
+                for (int x = 0; x < xDim; ++x)
+                    ++localHistogram[std::min(std::max(bin[x], 0), histogramBins - 1)];
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(histogramMutex);
+        for (int i = 0; i < histogramBins; ++i)
+            histogram[i] += localHistogram[i];
+    });
+
+    // Walk the cumulative histogram to find the value at each percent. The value is the upper edge of the bin that
+    // contains the percentile
+    percentiles.assign(101, globalWindow.min);
+    const double total = (double)zDim * yDim * xDim;
+    const double binWidth = (globalWindow.max - globalWindow.min) / histogramBins;
+    long long count = 0;
+    int percent = 1;
+
+    for (int i = 0; i < histogramBins && percent <= 100; ++i)
+    {
+        count += histogram[i];
+
+        while (percent <= 100 && count >= total * percent / 100.0)
+            percentiles[percent++] = std::min(globalWindow.min + (i + 1) * binWidth, globalWindow.max);
+    }
+
+    percentiles[100] = globalWindow.max;
+}
+
 // Orient NIFTI image so the coordinate system is RAS
 void NIFTImage::orientImage(nifti_image *image, cv::Mat &mat)
 {
@@ -327,6 +438,92 @@ bool NIFTImage::isLoaded() const
     return (upper && lower);
 }
 
+/* swap exchanges the loaded image of this class with other. This is used to move a loaded subject in and out of the
+ * subject cache without copying the volumes. The subject configuration pointer is not swapped because it points to the
+ * configuration of the window and not of the subject, the caller swaps the contents of the configuration instead.
+ *
+ * The transposed copies are released, a build that is still running is waited on. They are built again when requested.
+ */
+void NIFTImage::swap(NIFTImage &other)
+{
+    if (this == &other)
+        return;
+
+    releaseTransposedData();
+    other.releaseTransposedData();
+
+    std::swap(upper, other.upper);
+    std::swap(lower, other.lower);
+
+    std::swap(xDim, other.xDim);
+    std::swap(yDim, other.yDim);
+    std::swap(zDim, other.zDim);
+
+    std::swap(data, other.data);
+
+    std::swap(globalWindow, other.globalWindow);
+    std::swap(histogram, other.histogram);
+    std::swap(percentiles, other.percentiles);
+    std::swap(axialWindows, other.axialWindows);
+    std::swap(coronalWindows, other.coronalWindows);
+}
+
+size_t NIFTImage::memoryUsage() const
+{
+    size_t bytes = data.total() * data.elemSize() + transposedData.total() * transposedData.elemSize();
+
+    if (upper)
+        bytes += upper->nvox * upper->nbyper;
+
+    if (lower)
+        bytes += lower->nvox * lower->nbyper;
+
+    return bytes;
+}
+
+/* getStitchedTransform returns the transform from an index (x, y, z) of the data matrix to world coordinates in mm. The
+ * upper and lower images are flipped to RAS when they are stitched, so the transform is only the voxel size and the origin.
+ * The origin is the world coordinate of the voxel of the lower image that is the first voxel of the data matrix.
+ *
+ * Returns:
+ *      mat44 - Transform of the data matrix. If no image is loaded, the identity matrix is returned.
+ */
+mat44 NIFTImage::getStitchedTransform() const
+{
+    mat44 transform;
+    for (int i = 0; i < 4; ++i)
+    {
+        for (int j = 0; j < 4; ++j)
+            transform.m[i][j] = (i == j) ? 1.0f : 0.0f;
+    }
+
+    if (!lower || !subConfig)
+        return transform;
+
+    const mat44 &lowerTransform = (lower->sform_code > 0) ? lower->sto_xyz : lower->qto_xyz;
+
+    int xOrienCode, yOrienCode, zOrienCode;
+    nifti_mat44_to_orientation(lower->sto_xyz, &xOrienCode, &yOrienCode, &zOrienCode);
+
+    // Index of the first voxel of the data matrix in the lower image before it was flipped
+    const float index[] = {
+        (xOrienCode == NIFTI_R2L) ? (float)(lower->nx - 1) : 0.0f,
+        (yOrienCode == NIFTI_A2P) ? (float)(lower->ny - 1) : 0.0f,
+        (zOrienCode == NIFTI_S2I) ? (float)(lower->nz - 1 - subConfig->imageLowerInferior) : (float)subConfig->imageLowerInferior
+    };
+
+    const float voxelSize[] = { std::fabs(lower->dx), std::fabs(lower->dy), std::fabs(lower->dz) };
+
+    for (int i = 0; i < 3; ++i)
+    {
+        transform.m[i][i] = voxelSize[i];
+        transform.m[i][3] = lowerTransform.m[i][0] * index[0] + lowerTransform.m[i][1] * index[1] + lowerTransform.m[i][2] * index[2] +
+                lowerTransform.m[i][3];
+    }
+
+    return transform;
+}
+
 /* getRegion returns a region of the data matrix. The region vector can be done using initializer
  * lists in C++11 which makes this a simple function to use. The number of items in the region
  * vector must be 3 because the dimension of the data matrix is 3. The clone parameter is whether
@@ -383,6 +580,15 @@ cv::Mat NIFTImage::getCoronalSlice(int y, bool clone)
     if (data.empty() || y < 0 || y >= yDim)
         return cv::Mat();
 
+    // A clone can be copied from the transposed copy where the slice is one contiguous block
+    if (clone && !getTransposedData().empty())
+    {
+        const cv::Range transposedRegion[] = { cv::Range(y, y + 1), cv::Range::all(), cv::Range::all() };
+        int transposedDims[] = { zDim, xDim };
+
+        return cv::Mat(transposedData, transposedRegion).reshape(0, 2, transposedDims).clone();
+    }
+
     const cv::Range region[] = { cv::Range::all(), cv::Range(y, y + 1), cv::Range::all() };
 
     cv::Mat ret;
@@ -419,6 +625,136 @@ cv::Mat NIFTImage::getSaggitalSlice(int x, bool clone)
     return ret.reshape(0, 2, dims);
 }
 
+/* getTransposedData returns a copy of the data matrix ordered {y, z, x}. The copy is built on a worker thread the first
+ * time this is called, so an empty matrix is returned until the build is finished and the caller should fall back to
+ * the data matrix. An empty matrix is also returned if the transposed copy is disabled.
+ */
+cv::Mat NIFTImage::getTransposedData()
+{
+    if (!transposeEnabled)
+    {
+        // Free the memory of a copy that was built before it was disabled
+        releaseTransposedData();
+        return cv::Mat();
+    }
+
+    if (transposeRunning && transposeFuture.isFinished())
+    {
+        transposedData = transposeFuture.result();
+        transposeRunning = false;
+    }
+
+    // The data matrix is a shallow copy so it stays alive for the job even if a new image is set
+    if (transposedData.empty() && !transposeRunning && !data.empty())
+    {
+        transposeFuture = QtConcurrent::run(&NIFTImage::transposeVolume, data);
+        transposeRunning = true;
+    }
+
+    return transposedData;
+}
+
+bool NIFTImage::getTransposeEnabled()
+{
+    return transposeEnabled;
+}
+
+void NIFTImage::setTransposeEnabled(bool enabled)
+{
+    transposeEnabled = enabled;
+}
+
+void NIFTImage::releaseTransposedData()
+{
+    if (transposeRunning)
+    {
+        transposeFuture.waitForFinished();
+        transposeRunning = false;
+    }
+
+    transposeFuture = QFuture<cv::Mat>();
+    transposedData.release();
+}
+
+/* transposeVolume reorders volume from {z, y, x} to {y, z, x}, so that each coronal slice is one contiguous block that is
+ * already ordered z by x. Every row of X is copied whole, so both the reads and the writes are contiguous. The Y planes
+ * are copied in parallel.
+ *
+ * Returns:
+ *      cv::Mat - Transposed matrix.
+ */
+cv::Mat NIFTImage::transposeVolume(cv::Mat volume)
+{
+    const int zDim = volume.size[0];
+    const int yDim = volume.size[1];
+    const size_t rowBytes = volume.size[2] * volume.elemSize();
+
+    cv::Mat transposed({ yDim, zDim, volume.size[2] }, volume.type());
+
+    cv::parallel_for_(cv::Range(0, yDim), [&](const cv::Range &range)
+    {
+        for (int y = range.start; y < range.end; ++y)
+            for (int z = 0; z < zDim; ++z)
+                std::memcpy(transposed.ptr(y, z), volume.ptr(z, y), rowBytes);
+    });
+
+    return transposed;
+}
+
+const std::vector<int> &NIFTImage::getHistogram() const
+{
+    return histogram;
+}
+
+/* getPercentile returns the value at the given percent of the volume from 0 to 100. This is looked up from the table
+ * computed when the image is set.
+ */
+double NIFTImage::getPercentile(int percent) const
+{
+    if (percentiles.empty() || percent < 0 || percent > 100)
+        return 0.0;
+
+    return percentiles[percent];
+}
+
+/* getAxialWindow returns the range of intensities that are mapped to 0.0f to 1.0f when displaying axial slice z. See
+ * WindowMode for the different modes available.
+ */
+IntensityWindow NIFTImage::getAxialWindow(int z, WindowMode mode) const
+{
+    switch (mode)
+    {
+        case WindowMode::PerSlice:
+            if (z >= 0 && z < (int)axialWindows.size())
+                return axialWindows[z];
+            break;
+
+        case WindowMode::Global: return globalWindow;
+        case WindowMode::AutoPercentile: return IntensityWindow(getPercentile(1), getPercentile(99));
+    }
+
+    return globalWindow;
+}
+
+/* getCoronalWindow returns the range of intensities that are mapped to 0.0f to 1.0f when displaying coronal slice y. See
+ * WindowMode for the different modes available.
+ */
+IntensityWindow NIFTImage::getCoronalWindow(int y, WindowMode mode) const
+{
+    switch (mode)
+    {
+        case WindowMode::PerSlice:
+            if (y >= 0 && y < (int)coronalWindows.size())
+                return coronalWindows[y];
+            break;
+
+        case WindowMode::Global: return globalWindow;
+        case WindowMode::AutoPercentile: return IntensityWindow(getPercentile(1), getPercentile(99));
+    }
+
+    return globalWindow;
+}
+
 /* getType returns a NumericType pointer that stores information about the valid data types
  * supported across the various libraries included. Some examples include OpenGL and OpenCV
  *
@@ -436,6 +772,8 @@ const NumericType *NIFTImage::getType() const
 
 NIFTImage::~NIFTImage()
 {
+    releaseTransposedData();
+
     if (upper && lower)
     {
         nifti_image_free(upper);
@@ -3,20 +3,43 @@
 
 #include <QDebug>
 #include <QFile>
+#include <QElapsedTimer>
+#include <QFuture>
+#include <QtConcurrent>
 
 #include <opencv2/opencv.hpp>
 #include "opencv.h"
 #include "util.h"
 #include "subjectconfig.h"
 #include "numerictype.h"
+#include "displayinfo.h"
+
+#include <vector>
+#include <mutex>
+#include <limits>
+#include <functional>
+#include <cmath>
+#include <cstring>
 
 #include <QOpenGLFunctions_3_3_Core>
 
 #include <nifti1.h>
 #include <nifti1_io.h>
 
+// Range of intensities that is mapped to 0.0f to 1.0f when a slice is displayed
+struct IntensityWindow
+{
+    double min;
+    double max;
+
+    IntensityWindow(double min = 0.0, double max = 1.0) : min(min), max(max) {}
+};
+
 class NIFTImage
 {
+public:
+    static constexpr int histogramBins = 4096;
+
 private:
     nifti_image *upper;
     nifti_image *lower;
@@ -29,6 +52,26 @@ private:
 
     cv::Mat data;
 
+    // Statistics that are computed once when the image is set so that a slice can be windowed without scanning its voxels
+    // again. The histogram has histogramBins bins from the minimum to the maximum value of the volume and the percentiles
+    // table has the value at each percent from 0% to 100%
+    IntensityWindow globalWindow;
+    std::vector<int> histogram;
+    std::vector<double> percentiles;
+
+    // Minimum and maximum value of each axial (Z) and coronal (Y) slice
+    std::vector<IntensityWindow> axialWindows;
+    std::vector<IntensityWindow> coronalWindows;
+
+    // Copy of the data matrix ordered {y, z, x} so that a coronal slice is one contiguous block instead of one row from each
+    // axial slice. It is built on a worker thread the first time it is requested and is empty until the build is finished.
+    // This doubles the memory used by the image, so it can be disabled
+    cv::Mat transposedData;
+    QFuture<cv::Mat> transposeFuture;
+    bool transposeRunning;
+
+    static bool transposeEnabled;
+
 public:
     NIFTImage();
     NIFTImage(nifti_image *upper, nifti_image *lower, SubjectConfig *config = NULL);
@@ -49,16 +92,44 @@ public:
 
     bool isLoaded() const;
 
+    // Exchanges the images, data matrix and statistics with other. The subject configuration of each image is kept
+    void swap(NIFTImage &other);
+
+    // Bytes used by the NIFTI images, the data matrix and its transposed copy
+    size_t memoryUsage() const;
+
+    // Transform from an index (x, y, z) of the data matrix to world coordinates in mm
+    mat44 getStitchedTransform() const;
+
     cv::Mat getRegion(std::vector<cv::Range> region, bool clone = false);
 
     cv::Mat getAxialSlice(int z, bool clone = false);
     cv::Mat getCoronalSlice(int y, bool clone = false);
     cv::Mat getSaggitalSlice(int x, bool clone = false);
 
+    // Returns the {y, z, x} copy of the data matrix. If it is not built yet, the build is started and an empty matrix is
+    // returned until it is finished
+    cv::Mat getTransposedData();
+
+    static bool getTransposeEnabled();
+    static void setTransposeEnabled(bool enabled);
+
     const NumericType *getType() const;
 
+    const std::vector<int> &getHistogram() const;
+    double getPercentile(int percent) const;
+
+    IntensityWindow getAxialWindow(int z, WindowMode mode) const;
+    IntensityWindow getCoronalWindow(int y, WindowMode mode) const;
+
+    // Flips mat, which holds the voxels of image ordered {z, y, x}, so that it is in RAS orientation
+    static void orientImage(nifti_image *image, cv::Mat &mat);
+
 private:
-    void orientImage(nifti_image *image, cv::Mat &mat);
+    void computeStatistics();
+    void releaseTransposedData();
+
+    static cv::Mat transposeVolume(cv::Mat volume);
 };
 
 #endif // NIFTIMAGE_H
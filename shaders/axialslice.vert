@@ -4,11 +4,13 @@ layout(location = 0) in vec3 pos;
 layout(location = 1) in vec2 texPos;
 
 uniform mat4 MVP;
+// Offset (xy) and scale (zw) of the texture coordinates, this selects the part of the texture that is drawn for tiled textures
+uniform vec4 texTransform;
 
 out vec2 texCoord;
 
 void main(void)
 {
     gl_Position = MVP * vec4(pos, 1.0);
-    texCoord = texPos;
+    texCoord = texTransform.xy + texPos * texTransform.zw;
 }
@@ -0,0 +1,28 @@
+#version 330
+
+// Each voxel of the trace volume has one bit for each tracing layer
+uniform usampler3D traces;
+// Coronal slice (Y) of the trace volume that is drawn
+uniform int slice;
+uniform vec4 traceColors[6];
+// One bit for each tracing layer that is visible, the same as the bits of the trace volume
+uniform uint visibleLayers;
+
+in vec2 texCoord;
+
+out vec4 colorOut;
+
+void main(void)
+{
+    ivec3 size = textureSize(traces, 0);
+    ivec2 voxel = clamp(ivec2(texCoord * vec2(size.xz)), ivec2(0), size.xz - 1);
+    uint bits = texelFetch(traces, ivec3(voxel.x, slice, voxel.y), 0).r & visibleLayers;
+
+    // The layers are drawn in order in the axial view, so the last layer that is set is on top
+    colorOut = vec4(0.0);
+    for (int i = 0; i < 6; ++i)
+    {
+        if ((bits & (1u << uint(i))) != 0u)
+            colorOut = vec4(traceColors[i].rgb, 1.0);
+    }
+}
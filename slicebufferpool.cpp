@@ -0,0 +1,112 @@
+#include "slicebufferpool.h"
+#include "tiledtexture.h"
+
+constexpr int SliceBufferPool::defaultSetCount;
+
+SliceBufferPool::SliceBufferPool() : rows(0), cols(0), secondary(false), sets(), allocationCount(0), allocatedBytes(0),
+    reuseCount(0)
+{
+
+}
+
+void SliceBufferPool::reserve(int rows, int cols, bool secondary, int setCount)
+{
+    this->rows = rows;
+    this->cols = cols;
+    this->secondary = secondary;
+
+    // The pool releases its references to the old sets. Any set that is still displayed is freed when it is replaced
+    sets.clear();
+    for (int i = 0; i < setCount; ++i)
+        sets.push_back(allocate());
+}
+
+SliceBuffers SliceBufferPool::allocate()
+{
+    SliceBuffers buffers;
+    if (rows <= 0 || cols <= 0)
+        return buffers;
+
+    buffers.primMatrix = cv::Mat(rows, cols, CV_32FC1);
+    buffers.fatTemp = cv::Mat(rows, cols, CV_32FC1);
+    buffers.waterTemp = cv::Mat(rows, cols, CV_32FC1);
+    buffers.mask = cv::Mat(rows, cols, CV_8UC1);
+
+    // Building the pyramid once creates the levels with the size that every slice will have
+    TiledTexture::buildPyramid(buffers.primMatrix, buffers.primPyramid);
+    buffers.primPyramid[0] = cv::Mat();
+
+    if (secondary)
+    {
+        buffers.secdMatrix = cv::Mat(rows, cols, CV_32FC1);
+        TiledTexture::buildPyramid(buffers.secdMatrix, buffers.secdPyramid);
+        buffers.secdPyramid[0] = cv::Mat();
+    }
+
+    size_t bytes = 0;
+    for (const cv::Mat *matrix : { &buffers.primMatrix, &buffers.secdMatrix, &buffers.fatTemp, &buffers.waterTemp, &buffers.mask })
+        bytes += matrix->total() * matrix->elemSize();
+    for (const auto *pyramid : { &buffers.primPyramid, &buffers.secdPyramid })
+        for (const cv::Mat &level : *pyramid)
+            bytes += level.total() * level.elemSize();
+
+    ++allocationCount;
+    allocatedBytes += bytes;
+
+    return buffers;
+}
+
+bool SliceBufferPool::isFree(const SliceBuffers &buffers)
+{
+    // The pool holds one reference to each matrix so any other reference means the set is in use
+    auto isUnique = [](const cv::Mat &matrix)
+    {
+        return !matrix.u || matrix.u->refcount <= 1;
+    };
+
+    for (const cv::Mat *matrix : { &buffers.primMatrix, &buffers.secdMatrix, &buffers.fatTemp, &buffers.waterTemp, &buffers.mask })
+        if (!isUnique(*matrix))
+            return false;
+
+    for (const auto *pyramid : { &buffers.primPyramid, &buffers.secdPyramid })
+        for (const cv::Mat &level : *pyramid)
+            if (!isUnique(level))
+                return false;
+
+    return true;
+}
+
+SliceBuffers SliceBufferPool::acquire()
+{
+    for (const SliceBuffers &buffers : sets)
+    {
+        if (isFree(buffers))
+        {
+            ++reuseCount;
+            return buffers;
+        }
+    }
+
+    sets.push_back(allocate());
+    return sets.back();
+}
+
+size_t SliceBufferPool::getSetCount() const
+{
+    return sets.size();
+}
+
+size_t SliceBufferPool::getAllocationCount() const
+{
+    return allocationCount;
+}
+
+size_t SliceBufferPool::getAllocatedBytes() const
+{
+    return allocatedBytes;
+}
+
+size_t SliceBufferPool::getReuseCount() const
+{
+    return reuseCount;
+}
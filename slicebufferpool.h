@@ -0,0 +1,70 @@
+#ifndef SLICEBUFFERPOOL_H
+#define SLICEBUFFERPOOL_H
+
+#include <QDebug>
+#include <vector>
+
+#include <opencv2/opencv.hpp>
+
+// Matrices that one slice job writes its output and temporaries into. The primary and secondary matrices are the output,
+// the pyramids hold the smaller levels of detail of the output (level 0 is left empty and set by the job, see
+// TiledTexture::buildPyramid) and the remaining matrices are temporaries
+struct SliceBuffers
+{
+    cv::Mat primMatrix;
+    cv::Mat secdMatrix;
+    std::vector<cv::Mat> primPyramid;
+    std::vector<cv::Mat> secdPyramid;
+
+    cv::Mat fatTemp;
+    cv::Mat waterTemp;
+    cv::Mat mask;
+};
+
+/* SliceBufferPool keeps sets of SliceBuffers so that preparing a slice does not allocate a new matrix the size of the slice
+ * each time. The sets are allocated for the size of the image in reserve, which is called when an image is loaded.
+ *
+ * A set is in use as long as any matrix of it is referenced outside of the pool. This is the case while a job is writing
+ * to it and afterwards while the result is displayed, since the tiled textures upload from the result when a tile is
+ * drawn. Usually there are two sets, one that is displayed and one that the next slice is written to. A new set is only
+ * allocated if both are in use, such as when a finished result is waiting to be displayed while the next job is running.
+ *
+ * Note: acquire and reserve must be called on the same thread, the sets are released from any thread when the last
+ * reference to their matrices is dropped.
+ */
+class SliceBufferPool
+{
+private:
+    int rows;
+    int cols;
+    bool secondary;
+
+    std::vector<SliceBuffers> sets;
+
+    // Number of sets and bytes allocated and the number of times a set was reused since the pool was created
+    size_t allocationCount;
+    size_t allocatedBytes;
+    size_t reuseCount;
+
+    SliceBuffers allocate();
+    static bool isFree(const SliceBuffers &buffers);
+
+public:
+    static constexpr int defaultSetCount = 2;
+
+    SliceBufferPool();
+
+    // Replaces the sets with ones for a slice of rows by cols. The secondary matrix and pyramid are only allocated if secondary
+    // is true. Sets that are still in use are freed once they are no longer referenced
+    void reserve(int rows, int cols, bool secondary = true, int setCount = defaultSetCount);
+
+    // Returns a set that is not in use, a new set is allocated if every set is in use
+    SliceBuffers acquire();
+
+    size_t getSetCount() const;
+    size_t getAllocationCount() const;
+    size_t getAllocatedBytes() const;
+    size_t getReuseCount() const;
+};
+
+#endif // SLICEBUFFERPOOL_H
@@ -0,0 +1,80 @@
+#include "slicescheduler.h"
+
+SliceScheduler::SliceScheduler(QObject *parent) : QObject(parent),
+    running(false), pendingJob(), discardRunning(false), result(), resultReady(false)
+{
+    connect(&watcher, SIGNAL(finished()), this, SLOT(watcher_finished()));
+}
+
+void SliceScheduler::request(Job job)
+{
+    // If a job is running, replace the pending job with this one. Any older request is stale and dropped
+    if (running)
+    {
+        pendingJob = job;
+        return;
+    }
+
+    running = true;
+    discardRunning = false;
+    watcher.setFuture(QtConcurrent::run(job));
+}
+
+void SliceScheduler::cancel()
+{
+    pendingJob = nullptr;
+    resultReady = false;
+    result = SliceResult();
+
+    if (running)
+        discardRunning = true;
+}
+
+bool SliceScheduler::isBusy() const
+{
+    return running;
+}
+
+bool SliceScheduler::takeResult(SliceResult &result)
+{
+    if (!resultReady)
+        return false;
+
+    result = this->result;
+    this->result = SliceResult();
+    resultReady = false;
+
+    return true;
+}
+
+void SliceScheduler::watcher_finished()
+{
+    running = false;
+
+    // Keep the result even if there is a newer request so that the display always converges towards the latest slice
+    if (!discardRunning)
+    {
+        result = watcher.result();
+        resultReady = true;
+    }
+
+    discardRunning = false;
+
+    // Start the latest request that came in while the job was running
+    if (pendingJob)
+    {
+        Job job = pendingJob;
+        pendingJob = nullptr;
+        request(job);
+    }
+
+    if (resultReady)
+        emit resultAvailable();
+}
+
+SliceScheduler::~SliceScheduler()
+{
+    // The jobs do not reference the scheduler but wait for them anyway so that no work is left running after the widget is gone
+    pendingJob = nullptr;
+    watcher.waitForFinished();
+}
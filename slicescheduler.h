@@ -0,0 +1,78 @@
+#ifndef SLICESCHEDULER_H
+#define SLICESCHEDULER_H
+
+#include <QObject>
+#include <QFuture>
+#include <QFutureWatcher>
+#include <QtConcurrent>
+#include <functional>
+#include <vector>
+
+#include <opencv2/opencv.hpp>
+
+// Slice that was prepared on a worker thread. The primary and secondary matrices are 32-bit floats with the brightness and
+// contrast already applied, the secondary matrix is empty if the display type only has one image.
+// The pyramids are the levels of detail of each matrix that are drawn when zoomed out, level 0 is the matrix itself
+struct SliceResult
+{
+    int slice;
+    cv::Mat primMatrix;
+    cv::Mat secdMatrix;
+
+    std::vector<cv::Mat> primPyramid;
+    std::vector<cv::Mat> secdPyramid;
+
+    SliceResult() : slice(-1), primMatrix(), secdMatrix(), primPyramid(), secdPyramid() {}
+};
+
+/* SliceScheduler prepares slices on a worker thread so that scrubbing through the slices does not block the GUI thread.
+ *
+ * Only one job runs at a time. While a job is running, only the most recently requested job is kept and any older request
+ * that has not started is dropped. The result of a finished job is always kept so that the display keeps moving towards
+ * the requested slice, and then the latest request is started.
+ *
+ * Note: The job is run on another thread so it must not access the widget. Anything it needs must be captured by value.
+ */
+class SliceScheduler : public QObject
+{
+    Q_OBJECT
+
+public:
+    typedef std::function<SliceResult()> Job;
+
+private:
+    QFutureWatcher<SliceResult> watcher;
+    bool running;
+
+    // Latest job that was requested while another job was running, this is empty if there is no job waiting
+    Job pendingJob;
+
+    // Set by cancel so that the result of the job that is currently running is thrown away
+    bool discardRunning;
+
+    SliceResult result;
+    bool resultReady;
+
+public:
+    SliceScheduler(QObject *parent = NULL);
+    ~SliceScheduler();
+
+    void request(Job job);
+
+    // Drops the pending job and any result that has not been taken. The job that is running will finish but its result is discarded
+    void cancel();
+
+    bool isBusy() const;
+
+    // Returns true and sets result if a job has finished since the last call
+    bool takeResult(SliceResult &result);
+
+signals:
+    // Emitted on the thread of the scheduler when a result is ready to be taken
+    void resultAvailable();
+
+private slots:
+    void watcher_finished();
+};
+
+#endif // SLICESCHEDULER_H
@@ -1,4 +1,5 @@
 #include "stacktrace.h"
+#include "logger.h"
 
 QString globalProgramName;
 
@@ -157,8 +158,16 @@ LONG WINAPI windowsExceptionHandler(EXCEPTION_POINTERS *exceptionInfo)
     bool walkStack = (exceptionInfo->ExceptionRecord->ExceptionCode != EXCEPTION_STACK_OVERFLOW);
     QString stackStr = windowsPrintStackTrace(exceptionInfo->ContextRecord, walkStack);
 
+    // The process is terminated after this returns so the messages in the log buffer are written now. The exception may have
+    // happened while the logger or the heap was locked, so the messages are written without locking or allocating
+    if (globalLogger)
+        globalLogger->emergencyFlush();
+
     qCritical().nospace().noquote() << "Exception: " << exceptionStr << "\nStack: \n" << stackStr;
 
+    if (globalLogger)
+        globalLogger->emergencyFlush();
+
     return EXCEPTION_EXECUTE_HANDLER;
 }
 
@@ -199,6 +208,8 @@ QString posixPrintStackTrace()
 
     if (messages)
         free(messages);
+
+    return stackStr;
 }
 
 void posixSignalHandler(int sig, siginfo_t *siginfo, void *context)
@@ -244,10 +255,18 @@ void posixSignalHandler(int sig, siginfo_t *siginfo, void *context)
         default: exceptionStr = "Unrecognized Exception"; break;
     }
 
+    // _Exit does not run any cleanup so the messages in the log buffer are written now. The signal may have been raised while
+    // the logger or the heap was locked, so the messages are written without locking or allocating before anything else is
+    // tried
+    if (globalLogger)
+        globalLogger->emergencyFlush();
+
     qCritical() << "Exception: " << qUtf8Printable(exceptionStr);
-    qCritical() << "Stack: ";
+    qCritical().nospace().noquote() << "Stack: \n" << posixPrintStackTrace();
+
+    if (globalLogger)
+        globalLogger->emergencyFlush();
 
-    posixPrintStackTrace();
     _Exit(1);
 }
 
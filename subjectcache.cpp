@@ -0,0 +1,202 @@
+#include "subjectcache.h"
+
+SubjectCache::SubjectCache() : entries(), memoryBudget(2048ULL * 1024 * 1024)
+{
+
+}
+
+std::list<SubjectCache::Entry *>::iterator SubjectCache::find(const QString &path)
+{
+    return std::find_if(std::begin(entries), std::end(entries), [&](Entry *entry) { return entry->path == path; });
+}
+
+/* insert moves the subject loaded in the given objects into the cache, the objects are left empty. filename is the SDI
+ * file the subject was opened from and modified is whether its tracing has unsaved changes.
+ */
+void SubjectCache::insert(const QString &filename, NIFTImage *fatImage, NIFTImage *waterImage, SubjectConfig *subConfig,
+                          TracingData *tracingData, QuaZip **tracingResultsZip, bool modified)
+{
+    if (!fatImage->isLoaded() || !waterImage->isLoaded())
+        return;
+
+    Entry *entry = new Entry();
+    entry->fatImage.swap(*fatImage);
+    entry->waterImage.swap(*waterImage);
+    std::swap(entry->subConfig, *subConfig);
+    std::swap(entry->tracingData, *tracingData);
+    std::swap(entry->tracingResultsZip, *tracingResultsZip);
+    entry->modified = modified;
+
+    store(entry, filename);
+}
+
+/* take moves the subject for filename out of the cache into the given objects. The subject that was loaded in the objects
+ * is moved into the cache in its place, the two are swapped so that neither of them is copied. If no subject was loaded,
+ * nothing is added to the cache.
+ *
+ * Returns:
+ *      true - Subject was cached and has been moved into the objects
+ *      false - Subject is not cached or its file was modified since it was cached
+ */
+bool SubjectCache::take(const QString &filename, const QString &currentFilename, NIFTImage *fatImage, NIFTImage *waterImage,
+                        SubjectConfig *subConfig, TracingData *tracingData, QuaZip **tracingResultsZip, bool currentModified,
+                        bool *modified)
+{
+    if (!contains(filename))
+        return false;
+
+    auto it = find(QFileInfo(filename).canonicalFilePath());
+    Entry *entry = *it;
+    entries.erase(it);
+
+    fatImage->swap(entry->fatImage);
+    waterImage->swap(entry->waterImage);
+    std::swap(*subConfig, entry->subConfig);
+    std::swap(*tracingData, entry->tracingData);
+    std::swap(*tracingResultsZip, entry->tracingResultsZip);
+
+    if (modified)
+        *modified = entry->modified;
+
+    // The entry now holds the previous subject
+    entry->modified = currentModified;
+    if (entry->fatImage.isLoaded() && entry->waterImage.isLoaded())
+        store(entry, currentFilename);
+    else
+        delete entry;
+
+    return true;
+}
+
+/* store places entry at the front of the cache since it was just used and drops the least recently used subjects if the
+ * cache is over its memory budget. This includes the entry itself if it does not fit in the budget by itself and its
+ * tracing is saved. A cached copy of the same subject is replaced.
+ */
+void SubjectCache::store(Entry *entry, const QString &filename)
+{
+    QFileInfo fileInfo(filename);
+    if (!fileInfo.exists())
+    {
+        // The subject could never be taken back out of the cache without its file
+        if (entry->modified)
+            qWarning() << "Subject image was removed, its unsaved tracing cannot be kept: " << filename;
+
+        delete entry;
+        return;
+    }
+
+    entry->path = fileInfo.canonicalFilePath();
+    entry->lastModified = fileInfo.lastModified();
+    entry->memoryUsage = entry->fatImage.memoryUsage() + entry->waterImage.memoryUsage() + memoryUsage(&entry->tracingData);
+
+    auto it = find(entry->path);
+    if (it != std::end(entries))
+    {
+        delete *it;
+        entries.erase(it);
+    }
+
+    entries.push_front(entry);
+    enforceMemoryBudget();
+}
+
+/* contains returns whether the subject for filename is cached. A cached subject whose file was modified or removed since
+ * it was cached is dropped from the cache and false is returned.
+ */
+bool SubjectCache::contains(const QString &filename)
+{
+    QFileInfo fileInfo(filename);
+    if (!fileInfo.exists())
+        return false;
+
+    auto it = find(fileInfo.canonicalFilePath());
+    if (it == std::end(entries))
+        return false;
+
+    // The images of a subject with unsaved tracing are kept, the tracing was drawn on them and would be lost otherwise
+    if ((*it)->lastModified != fileInfo.lastModified() && !(*it)->modified)
+    {
+        qDebug() << "Cached subject was modified since it was cached, dropping it: " << filename;
+        delete *it;
+        entries.erase(it);
+        return false;
+    }
+
+    return true;
+}
+
+void SubjectCache::clear()
+{
+    for (Entry *entry : entries)
+        delete entry;
+
+    entries.clear();
+}
+
+int SubjectCache::count() const
+{
+    return (int)entries.size();
+}
+
+int SubjectCache::modifiedCount() const
+{
+    return (int)std::count_if(std::begin(entries), std::end(entries), [](const Entry *entry) { return entry->modified; });
+}
+
+bool SubjectCache::isOverBudget() const
+{
+    return memoryUsage() > memoryBudget;
+}
+
+size_t SubjectCache::memoryUsage() const
+{
+    size_t total = 0;
+    for (Entry *entry : entries)
+        total += entry->memoryUsage;
+
+    return total;
+}
+
+size_t SubjectCache::getMemoryBudget() const
+{
+    return memoryBudget;
+}
+
+void SubjectCache::setMemoryBudget(size_t bytes)
+{
+    memoryBudget = bytes;
+    enforceMemoryBudget();
+}
+
+void SubjectCache::enforceMemoryBudget()
+{
+    size_t total = memoryUsage();
+
+    // Least recently used subjects are dropped first, subjects with unsaved tracing are skipped
+    for (auto it = std::end(entries); total > memoryBudget && it != std::begin(entries);)
+    {
+        --it;
+        Entry *entry = *it;
+        if (entry->modified)
+            continue;
+
+        qDebug() << "Dropping cached subject to stay within the memory budget: " << entry->path;
+        total -= entry->memoryUsage;
+        delete entry;
+        it = entries.erase(it);
+    }
+}
+
+size_t SubjectCache::memoryUsage(TracingData *tracingData)
+{
+    size_t bytes = 0;
+    for (auto &layer : tracingData->layers)
+        bytes += layer.data.total() * layer.data.elemSize() + layer.time.size() * sizeof(std::chrono::milliseconds);
+
+    return bytes;
+}
+
+SubjectCache::~SubjectCache()
+{
+    clear();
+}
@@ -0,0 +1,93 @@
+#ifndef SUBJECTCACHE_H
+#define SUBJECTCACHE_H
+
+#include <QDebug>
+#include <QString>
+#include <QDateTime>
+#include <QFileInfo>
+#include <list>
+#include <algorithm>
+
+#include "niftimage.h"
+#include "subjectconfig.h"
+#include "tracing.h"
+#include "quazip.h"
+
+/* SubjectCache keeps subjects that were recently opened so that switching back to one of them does not read and stitch
+ * the NIFTI images again. A subject is moved into the cache when another subject is opened and moved back out when it is
+ * opened again, the volumes are swapped and never copied (see NIFTImage::swap). The tracing data and the tracing results
+ * file of the subject are kept along with the images so unsaved tracing is not lost when switching subjects.
+ *
+ * Subjects are identified by the canonical path of the SDI file and its modification time, a subject whose file has been
+ * changed since it was cached is dropped. The least recently used subjects are dropped once the memory used by the cache
+ * exceeds the memory budget.
+ *
+ * A subject whose tracing was modified since it was last saved is never dropped, since the cache is the only place the
+ * tracing is kept. The cache can go over its memory budget because of these subjects until they are opened and saved, the
+ * views warn about this in the status bar (see isOverBudget).
+ */
+class SubjectCache
+{
+private:
+    struct Entry
+    {
+        QString path;
+        QDateTime lastModified;
+
+        NIFTImage fatImage;
+        NIFTImage waterImage;
+        SubjectConfig subConfig;
+        TracingData tracingData;
+        QuaZip *tracingResultsZip;
+
+        // Whether the tracing was modified since it was last saved
+        bool modified;
+
+        size_t memoryUsage;
+
+        Entry() : tracingResultsZip(NULL), modified(false), memoryUsage(0) {}
+        ~Entry() { delete tracingResultsZip; }
+    };
+
+    // Most recently used subject is first
+    std::list<Entry *> entries;
+    size_t memoryBudget;
+
+    std::list<Entry *>::iterator find(const QString &path);
+    void store(Entry *entry, const QString &filename);
+    void enforceMemoryBudget();
+
+public:
+    SubjectCache();
+    ~SubjectCache();
+
+    // Moves the loaded subject into the cache, the images and tracing data are left empty and the tracing results file
+    // is set to NULL. modified is whether the tracing has unsaved changes
+    void insert(const QString &filename, NIFTImage *fatImage, NIFTImage *waterImage, SubjectConfig *subConfig,
+                TracingData *tracingData, QuaZip **tracingResultsZip, bool modified);
+
+    // Moves the subject out of the cache into the given objects and the subject that was loaded in them, which was opened
+    // from currentFilename, into the cache. currentModified is whether the tracing of the loaded subject has unsaved changes
+    // and modified is set to whether the tracing of the subject that was taken has. Returns false if the subject is not
+    // cached, the objects are left unchanged then
+    bool take(const QString &filename, const QString &currentFilename, NIFTImage *fatImage, NIFTImage *waterImage,
+              SubjectConfig *subConfig, TracingData *tracingData, QuaZip **tracingResultsZip, bool currentModified = false,
+              bool *modified = NULL);
+
+    bool contains(const QString &filename);
+    void clear();
+
+    int count() const;
+    size_t memoryUsage() const;
+
+    // Number of cached subjects with unsaved tracing. Only these subjects are left when the cache is over its budget
+    int modifiedCount() const;
+    bool isOverBudget() const;
+
+    size_t getMemoryBudget() const;
+    void setMemoryBudget(size_t bytes);
+
+    static size_t memoryUsage(TracingData *tracingData);
+};
+
+#endif // SUBJECTCACHE_H
@@ -0,0 +1,279 @@
+#include "tiledtexture.h"
+
+TiledTexture::TiledTexture(GLint internalFormat, GLint filter, int tileSize) : internalFormat(internalFormat), filter(filter),
+    tileSize(tileSize), levelBias(0), format(GL_RED), type(GL_FLOAT)
+{
+    if (!initializeOpenGLFunctions())
+    {
+        qCritical() << "Unable to initialize OpenGL functions for TiledTexture";
+        return;
+    }
+
+    // Tiles can not be larger than the maximum size the driver supports
+    GLint maxTextureSize;
+    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTextureSize);
+    this->tileSize = std::min(tileSize, (int)maxTextureSize);
+}
+
+void TiledTexture::setImage(cv::Mat image)
+{
+    if (image.empty())
+        setImage(std::vector<cv::Mat>());
+    else
+        setImage(std::vector<cv::Mat>({ image }));
+}
+
+void TiledTexture::setImage(const std::vector<cv::Mat> &images)
+{
+    if (images.empty() || images[0].empty())
+    {
+        for (auto &level : levels)
+            level.source = cv::Mat();
+        return;
+    }
+
+    for (const auto &image : images)
+    {
+        if (image.dims != 2 || image.channels() != 1 || image.type() != images[0].type())
+        {
+            qWarning() << "Tiled texture must be a 2D image with one channel and the same type for each level: " << image.dims
+                       << "dims, " << image.channels() << "channels";
+            return;
+        }
+    }
+
+    auto dataType = NumericType::OpenCV(images[0].type());
+
+    // Every level needs to be allocated again if the format of the image changed
+    if (format != dataType->openGLFormat || type != dataType->openGLType)
+    {
+        for (auto &level : levels)
+            release(level);
+
+        format = dataType->openGLFormat;
+        type = dataType->openGLType;
+    }
+
+    // Levels that are no longer used are released
+    for (size_t i = images.size(); i < levels.size(); ++i)
+        release(levels[i]);
+    levels.resize(images.size());
+
+    for (size_t i = 0; i < images.size(); ++i)
+    {
+        Level &level = levels[i];
+        level.source = images[i];
+
+        // The tiles only need to be allocated again if the size of the level changed, otherwise the existing textures are
+        // overwritten once they are drawn
+        if (level.tiles.empty() || level.size != QSize(images[i].cols, images[i].rows))
+        {
+            release(level);
+            level.size = QSize(images[i].cols, images[i].rows);
+            allocate(level);
+        }
+
+        for (auto &tile : level.tiles)
+            tile.stale = true;
+    }
+}
+
+bool TiledTexture::isEmpty() const
+{
+    return levels.empty() || levels[0].source.empty();
+}
+
+int TiledTexture::getLevelCount() const
+{
+    return (int)levels.size();
+}
+
+int TiledTexture::getLevelBias() const
+{
+    return levelBias;
+}
+
+void TiledTexture::setLevelBias(int bias)
+{
+    levelBias = std::max(bias, 0);
+}
+
+void TiledTexture::allocate(Level &level)
+{
+    // The border of each tile overlaps the neighboring tiles by one pixel, so each tile draws two pixels less than the tile size
+    const int step = std::max(tileSize - 2, 1);
+
+    for (int y = 0; y < level.size.height(); y += step)
+    {
+        for (int x = 0; x < level.size.width(); x += step)
+        {
+            Tile tile;
+            tile.region = QRect(x, y, std::min(step, level.size.width() - x), std::min(step, level.size.height() - y));
+            tile.textureRegion = tile.region.adjusted(-1, -1, 1, 1).intersected(QRect(QPoint(0, 0), level.size));
+            tile.stale = true;
+
+            glGenTextures(1, &tile.texture);
+            glBindTexture(GL_TEXTURE_2D, tile.texture);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter);
+            // The border pixels are stored in the texture so clamping only occurs at the edge of the image
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+            // Allocate the texture without uploading anything, the data is uploaded when the tile is drawn
+            glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, tile.textureRegion.width(), tile.textureRegion.height(), 0, format, type, NULL);
+            glCheckError();
+
+            level.tiles.push_back(tile);
+        }
+    }
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void TiledTexture::release(Level &level)
+{
+    for (auto &tile : level.tiles)
+        glDeleteTextures(1, &tile.texture);
+
+    level.tiles.clear();
+    level.size = QSize(0, 0);
+}
+
+void TiledTexture::upload(Tile &tile, const cv::Mat &source)
+{
+    const QRect &region = tile.textureRegion;
+
+    // Upload the region of the image directly from the matrix, the row length tells OpenGL how far apart each row is in
+    // the matrix since it is wider than the tile
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, (GLint)(source.step[0] / source.elemSize()));
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, region.width(), region.height(), format, type, source.ptr(region.y(), region.x()));
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glCheckError();
+
+    tile.stale = false;
+}
+
+QMatrix4x4 TiledTexture::getTileMatrix(const Level &level, const Tile &tile) const
+{
+    // The unit quad covers the entire image from -1 to 1, transform it to only cover the region of the tile
+    QMatrix4x4 matrix;
+    matrix.translate(-1.0f + (tile.region.left() * 2.0f + tile.region.width()) / level.size.width(),
+                     -1.0f + (tile.region.top() * 2.0f + tile.region.height()) / level.size.height());
+    matrix.scale((float)tile.region.width() / level.size.width(), (float)tile.region.height() / level.size.height());
+
+    return matrix;
+}
+
+bool TiledTexture::isVisible(const QMatrix4x4 &mvpMatrix) const
+{
+    // Transform the corners of the quad to normalized device coordinates and check if the bounding box overlaps the viewport
+    QRectF bounds;
+    const QVector4D corners[] = { QVector4D(-1.0f, -1.0f, 0.0f, 1.0f), QVector4D(1.0f, -1.0f, 0.0f, 1.0f),
+                                  QVector4D(-1.0f, 1.0f, 0.0f, 1.0f), QVector4D(1.0f, 1.0f, 0.0f, 1.0f) };
+
+    for (int i = 0; i < 4; ++i)
+    {
+        QVector4D corner = mvpMatrix * corners[i];
+        QPointF point(corner.x() / corner.w(), corner.y() / corner.w());
+
+        bounds = (i == 0) ? QRectF(point, point) : bounds.united(QRectF(point, point));
+    }
+
+    return bounds.right() >= -1.0f && bounds.left() <= 1.0f && bounds.bottom() >= -1.0f && bounds.top() <= 1.0f;
+}
+
+int TiledTexture::selectLevel(const QMatrix4x4 &mvpMatrix)
+{
+    if (isEmpty())
+        return 0;
+
+    GLint viewport[4];
+    glGetIntegerv(GL_VIEWPORT, viewport);
+
+    // Size of the entire image on the screen in pixels. The unit quad is 2 units wide in normalized device coordinates and
+    // so is the viewport, so the transformed axes are scaled by half of the viewport size
+    QVector4D xAxis = mvpMatrix * QVector4D(1.0f, 0.0f, 0.0f, 0.0f);
+    QVector4D yAxis = mvpMatrix * QVector4D(0.0f, 1.0f, 0.0f, 0.0f);
+    float screenWidth = QVector2D(xAxis.x() * viewport[2], xAxis.y() * viewport[3]).length();
+    float screenHeight = QVector2D(yAxis.x() * viewport[2], yAxis.y() * viewport[3]).length();
+
+    // The number of image pixels that cover one screen pixel, the largest of the two axes is used so that the image is never
+    // drawn with less detail than the screen can show. Each level halves the size so the level is log2 of this ratio
+    float ratio = std::min(levels[0].size.width() / std::max(screenWidth, 1.0f), levels[0].size.height() / std::max(screenHeight, 1.0f));
+    int level = (ratio > 1.0f) ? (int)std::floor(std::log2(ratio)) : 0;
+
+    return std::min(level + levelBias, getLevelCount() - 1);
+}
+
+void TiledTexture::draw(QOpenGLShaderProgram *program, const QMatrix4x4 &mvpMatrix)
+{
+    if (isEmpty())
+        return;
+
+    Level &level = levels[selectLevel(mvpMatrix)];
+
+    glActiveTexture(GL_TEXTURE0);
+
+    for (auto &tile : level.tiles)
+    {
+        QMatrix4x4 tileMVPMatrix = mvpMatrix * getTileMatrix(level, tile);
+        if (!isVisible(tileMVPMatrix))
+            continue;
+
+        glBindTexture(GL_TEXTURE_2D, tile.texture);
+        if (tile.stale)
+            upload(tile, level.source);
+
+        // The texture coordinates of the quad are transformed to the pixels of region within the texture region. This skips
+        // the border pixels that belong to the neighboring tiles
+        const QRect &region = tile.region;
+        const QRect &textureRegion = tile.textureRegion;
+        program->setUniformValue("MVP", tileMVPMatrix);
+        program->setUniformValue("texTransform", QVector4D((float)(region.left() - textureRegion.left()) / textureRegion.width(),
+                                                           (float)(region.top() - textureRegion.top()) / textureRegion.height(),
+                                                           (float)region.width() / textureRegion.width(),
+                                                           (float)region.height() / textureRegion.height()));
+        glCheckError();
+
+        // Draw a triangle strip of 4 elements which is two triangles. The indices are unsigned shorts
+        glDrawElements(GL_TRIANGLE_STRIP, 4, GL_UNSIGNED_SHORT, 0);
+        glCheckError();
+    }
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void TiledTexture::buildPyramid(cv::Mat image, std::vector<cv::Mat> &pyramid)
+{
+    if (image.empty())
+    {
+        pyramid.clear();
+        return;
+    }
+
+    if (pyramid.empty())
+        pyramid.emplace_back();
+    pyramid[0] = image;
+
+    // pyrDown blurs the image before removing every other row and column so the smaller levels do not alias
+    size_t count = 1;
+    while ((int)count < maxLevelCount && std::min(pyramid[count - 1].cols, pyramid[count - 1].rows) >= minLevelSize * 2)
+    {
+        if (pyramid.size() <= count)
+            pyramid.emplace_back();
+
+        cv::pyrDown(pyramid[count - 1], pyramid[count]);
+        ++count;
+    }
+
+    pyramid.resize(count);
+}
+
+TiledTexture::~TiledTexture()
+{
+    for (auto &level : levels)
+        release(level);
+}
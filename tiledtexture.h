@@ -0,0 +1,114 @@
+#ifndef TILEDTEXTURE_H
+#define TILEDTEXTURE_H
+
+#include <QOpenGLFunctions_3_3_Core>
+#include <QOpenGLShaderProgram>
+#include <QMatrix4x4>
+#include <QVector2D>
+#include <QVector4D>
+#include <QRect>
+#include <QDebug>
+#include <vector>
+#include <cmath>
+
+#include <opencv2/opencv.hpp>
+
+#include "numerictype.h"
+#include "util.h"
+
+/* TiledTexture displays a 2D image that may be larger than GL_MAX_TEXTURE_SIZE by splitting it into a grid of textures
+ * (tiles). Each tile is drawn with the unit quad transformed to the region of the image that it covers.
+ *
+ * Tiles are not uploaded when the image is set. Instead, each tile is marked as stale and is uploaded the next time it is
+ * drawn and is visible. Tiles that are panned or zoomed out of the viewport are not uploaded until they are visible again.
+ *
+ * Each tile stores a one pixel border of its neighboring tiles so that linear filtering is seamless across tiles.
+ *
+ * The image can have multiple levels of detail, where each level is half the size of the previous one (see buildPyramid).
+ * The level that is drawn is chosen from the size of the image on the screen, so when zoomed out only the tiles of a small
+ * level are uploaded and sampled. The level bias is added to the chosen level to prefer lower resolution levels.
+ *
+ * Note: The shader program must have the MVP and texTransform uniforms. texTransform is the offset (xy) and scale (zw) of the
+ * texture coordinates of the quad. The image uses the same coordinate system as a single texture drawn on the unit quad.
+ *
+ * Note: The constructor, destructor and draw must be called while the OpenGL context is current.
+ */
+class TiledTexture : protected QOpenGLFunctions_3_3_Core
+{
+private:
+    struct Tile
+    {
+        GLuint texture;
+        // Pixels of the image that are drawn by this tile
+        QRect region;
+        // Pixels of the image that are stored in the texture, this is region plus a border of one pixel on each side that
+        // has a neighboring tile
+        QRect textureRegion;
+        // Set when the image changed and the tile has not been uploaded since
+        bool stale;
+    };
+
+    struct Level
+    {
+        QSize size;
+        std::vector<Tile> tiles;
+        // Image that stale tiles are uploaded from. This is a shallow copy
+        cv::Mat source;
+    };
+
+    GLint internalFormat;
+    GLint filter;
+    int tileSize;
+    int levelBias;
+
+    // OpenGL format of the allocated tiles
+    GLenum format;
+    GLenum type;
+
+    // Level 0 is the full resolution image
+    std::vector<Level> levels;
+
+    void allocate(Level &level);
+    void release(Level &level);
+    void upload(Tile &tile, const cv::Mat &source);
+
+    bool isVisible(const QMatrix4x4 &mvpMatrix) const;
+    QMatrix4x4 getTileMatrix(const Level &level, const Tile &tile) const;
+
+public:
+    // The tile size is limited to GL_MAX_TEXTURE_SIZE
+    static constexpr int defaultTileSize = 2048;
+
+    // The pyramid stops once a level would be smaller than this in either dimension
+    static constexpr int minLevelSize = 32;
+    static constexpr int maxLevelCount = 5;
+
+    TiledTexture(GLint internalFormat, GLint filter, int tileSize = defaultTileSize);
+    ~TiledTexture();
+
+    // Sets the image that is drawn. The matrix must be 2D with one channel and is not copied, so it must not be changed until
+    // setImage is called again unless the change is meant to be displayed
+    void setImage(cv::Mat image);
+    // Sets the image with multiple levels of detail, level 0 is the full resolution image
+    void setImage(const std::vector<cv::Mat> &images);
+    bool isEmpty() const;
+
+    int getLevelCount() const;
+
+    int getLevelBias() const;
+    void setLevelBias(int bias);
+
+    // Returns the level that is drawn for the MVP matrix and the current viewport
+    int selectLevel(const QMatrix4x4 &mvpMatrix);
+
+    // Draws the visible tiles with the unit quad. The quad VAO and program must be bound by the caller. Texture unit 0 is used
+    // for the tiles
+    void draw(QOpenGLShaderProgram *program, const QMatrix4x4 &mvpMatrix);
+
+    // Creates the levels of detail for image, each level is blurred and half the size of the previous level. Level 0 is a
+    // shallow copy of image. The levels are written into the matrices already in pyramid if they have the right size, so
+    // reusing the same pyramid does not allocate. This does not use OpenGL so it can be called from a worker thread
+    static void buildPyramid(cv::Mat image, std::vector<cv::Mat> &pyramid);
+};
+
+#endif // TILEDTEXTURE_H
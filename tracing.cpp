@@ -1,4 +1,11 @@
 #include "tracing.h"
+#include "opencv.h"
+#include "quazip.h"
+#include "quazipfile.h"
+
+#include <QDebug>
+#include <QDir>
+#include <QTextStream>
 
 int TracingLayerData::getXDim() const
 {
@@ -100,6 +107,223 @@ void TracingLayerData::reset(int x, int y, int z)
     data.at<unsigned char>(z, y, x) = 0;
 }
 
+void TracingLayerData::drawLine(int z, QPoint start, QPoint end, int brushWidth, BrushShape brushShape, std::vector<TracingSpan> &changed)
+{
+    if (data.empty() || z < 0 || z >= getZDim() || brushWidth < 1)
+        return;
+
+    const int xDim = getXDim();
+    const int yDim = getYDim();
+
+    // The brush covers [low, low + brushWidth - 1] relative to the center point. For even widths, the extra pixel is on the
+    // top/left side, which is the same as the eraser brush
+    const int low = -(brushWidth / 2);
+
+    // Compute the span of X offsets for each row of the brush once. A square brush covers the entire row while a round
+    // brush covers the pixels whose centers are within the circle
+    std::vector<std::pair<int, int>> brushSpans((size_t)brushWidth);
+    const float center = low + (brushWidth - 1) / 2.0f;
+    const float radiusSq = (brushWidth / 2.0f) * (brushWidth / 2.0f);
+
+    for (int i = 0; i < brushWidth; ++i)
+    {
+        if (brushShape == BrushShape::Round)
+        {
+            const float dy = (low + i) - center;
+            const float halfWidth = std::sqrt(std::max(radiusSq - dy * dy, 0.0f));
+            brushSpans[i] = std::make_pair((int)std::ceil(center - halfWidth), (int)std::floor(center + halfWidth));
+        }
+        else
+        {
+            brushSpans[i] = std::make_pair(low, low + brushWidth - 1);
+        }
+    }
+
+    // Sets every pixel in the brush centered at (x, y) by writing directly to the rows of the slice
+    auto stampBrush = [&](int x, int y) {
+        for (int i = 0; i < brushWidth; ++i)
+        {
+            const int row = y + low + i;
+            if (row < 0 || row >= yDim)
+                continue;
+
+            unsigned char *rowPtr = data.ptr<unsigned char>(z, row);
+            const int x1 = std::max(x + brushSpans[i].first, 0);
+            const int x2 = std::min(x + brushSpans[i].second, xDim - 1);
+
+            for (int col = x1; col <= x2; ++col)
+            {
+                // Skip if the point is already set, this keeps each changed pixel recorded only once
+                if (rowPtr[col] == 255)
+                    continue;
+
+                // Set the run of pixels that are not set yet and record it
+                const int runStart = col;
+                while (col <= x2 && rowPtr[col] != 255)
+                    ++col;
+
+                std::memset(rowPtr + runStart, 255, col - runStart);
+                changed.emplace_back(row, runStart, col - runStart);
+            }
+        }
+    };
+
+    // Bresenham's line algorithm for all octants
+    int x = start.x();
+    int y = start.y();
+    const int dx = std::abs(end.x() - x);
+    const int dy = -std::abs(end.y() - y);
+    const int sx = (x < end.x()) ? 1 : -1;
+    const int sy = (y < end.y()) ? 1 : -1;
+    int err = dx + dy;
+
+    while (true)
+    {
+        stampBrush(x, y);
+
+        if (x == end.x() && y == end.y())
+            break;
+
+        const int err2 = 2 * err;
+        if (err2 >= dy)
+        {
+            err += dy;
+            x += sx;
+        }
+        if (err2 <= dx)
+        {
+            err += dx;
+            y += sy;
+        }
+    }
+}
+
+void TracingLayerData::eraseLine(int z, QPoint start, QPoint end, int brushWidth, BrushShape brushShape, std::vector<TracingSpan> &cleared)
+{
+    if (data.empty() || z < 0 || z >= getZDim() || brushWidth < 1)
+        return;
+
+    const int xDim = getXDim();
+    const int yDim = getYDim();
+
+    // Tolerance used when converting the edges of the shape to pixels so that pixel centers exactly on an edge are included
+    const float epsilon = 1e-4f;
+
+    // Center of the brush relative to the point. This is the same as drawLine where for even widths, the extra pixel is on the
+    // top/left side
+    const float center = -(brushWidth / 2) + (brushWidth - 1) / 2.0f;
+    const float radius = brushWidth / 2.0f;
+    const cv::Point2f a(start.x() + center, start.y() + center);
+    const cv::Point2f b(end.x() + center, end.y() + center);
+
+    // The swept shape is convex so each row of it is a single span. The outline is built once as a convex polygon:
+    //  Square: Convex hull of the corners of the brush at the start and end points
+    //  Round: Rectangle around the segment with a width of the brush. The discs at the start and end are handled separately
+    std::vector<cv::Point2f> polygon;
+    if (brushShape == BrushShape::Square)
+    {
+        std::vector<cv::Point2f> corners;
+        for (const cv::Point2f &point : { a, b })
+        {
+            corners.push_back(point + cv::Point2f(-radius, -radius));
+            corners.push_back(point + cv::Point2f(radius, -radius));
+            corners.push_back(point + cv::Point2f(radius, radius));
+            corners.push_back(point + cv::Point2f(-radius, radius));
+        }
+
+        cv::convexHull(corners, polygon);
+    }
+    else if (a != b)
+    {
+        const cv::Point2f direction = b - a;
+        const cv::Point2f normal = cv::Point2f(-direction.y, direction.x) * (radius / (float)cv::norm(direction));
+
+        polygon = { a + normal, b + normal, b - normal, a - normal };
+    }
+
+    const int y1 = std::max((int)std::ceil(std::min(a.y, b.y) - radius - epsilon), 0);
+    const int y2 = std::min((int)std::floor(std::max(a.y, b.y) + radius + epsilon), yDim - 1);
+
+    for (int y = y1; y <= y2; ++y)
+    {
+        float spanStart = std::numeric_limits<float>::max();
+        float spanEnd = std::numeric_limits<float>::lowest();
+
+        // Intersect the row with each edge of the polygon
+        for (size_t i = 0; i < polygon.size(); ++i)
+        {
+            const cv::Point2f &p = polygon[i];
+            const cv::Point2f &q = polygon[(i + 1) % polygon.size()];
+
+            if (y < std::min(p.y, q.y) - epsilon || y > std::max(p.y, q.y) + epsilon)
+                continue;
+
+            if (std::abs(q.y - p.y) < epsilon)
+            {
+                spanStart = std::min({ spanStart, p.x, q.x });
+                spanEnd = std::max({ spanEnd, p.x, q.x });
+            }
+            else
+            {
+                const float x = p.x + (y - p.y) * (q.x - p.x) / (q.y - p.y);
+                spanStart = std::min(spanStart, x);
+                spanEnd = std::max(spanEnd, x);
+            }
+        }
+
+        // Add the discs at each end for a round brush
+        if (brushShape == BrushShape::Round)
+        {
+            for (const cv::Point2f &point : { a, b })
+            {
+                const float dy = y - point.y;
+                if (std::abs(dy) > radius + epsilon)
+                    continue;
+
+                const float halfWidth = std::sqrt(std::max(radius * radius - dy * dy, 0.0f));
+                spanStart = std::min(spanStart, point.x - halfWidth);
+                spanEnd = std::max(spanEnd, point.x + halfWidth);
+            }
+        }
+
+        const int x1 = std::max((int)std::ceil(spanStart - epsilon), 0);
+        const int x2 = std::min((int)std::floor(spanEnd + epsilon), xDim - 1);
+        if (x1 > x2)
+            continue;
+
+        // Record the runs of pixels that are set before clearing them so that the erase can be undone
+        unsigned char *rowPtr = data.ptr<unsigned char>(z, y);
+        bool hasRun = false;
+
+        for (int x = x1; x <= x2; ++x)
+        {
+            if (rowPtr[x] == 0)
+                continue;
+
+            const int runStart = x;
+            while (x <= x2 && rowPtr[x] != 0)
+                ++x;
+
+            cleared.emplace_back(y, runStart, x - runStart);
+            hasRun = true;
+        }
+
+        // Nothing is written to rows that are already clear
+        if (hasRun)
+            std::memset(rowPtr + x1, 0, x2 - x1 + 1);
+    }
+}
+
+void TracingLayerData::setSpan(int z, const TracingSpan &span)
+{
+    std::memset(data.ptr<unsigned char>(z, span.y) + span.x, 255, span.length);
+}
+
+void TracingLayerData::resetSpan(int z, const TracingSpan &span)
+{
+    std::memset(data.ptr<unsigned char>(z, span.y) + span.x, 0, span.length);
+}
+
 void TracingLayerData::load(int x, int y, int z)
 {
     data = cv::Mat({z, y, x}, CV_8UC1, cv::Scalar(0));
@@ -113,3 +337,203 @@ const NumericType *TracingLayerData::getType() const
 
     return NumericType::OpenCV(data.type());
 }
+
+/* save writes the points and drawing times of each layer as text files into zip. The zip must be opened for writing.
+ *
+ * Returns:
+ *      true - The layers were written, a layer whose file could not be created is skipped with a warning
+ */
+bool TracingData::save(QuaZip *zip)
+{
+    const QString layerFilename[(int)TracingLayer::Count] = {"EAT.txt", "IMAT.txt", "PAAT.txt", "PAT.txt", "SCAT.txt", "VAT.txt"};
+    const QString timeDir = "times";
+    QString layerTimePath[(int)TracingLayer::Count];
+
+    // Prepend timeDir to the layer filename to store the times
+    for (int i = 0; i < (int)TracingLayer::Count; ++i)
+        layerTimePath[i] = QDir(timeDir).filePath(layerFilename[i]);
+
+    for (int i = 0; i < (int)TracingLayer::Count; ++i)
+    {
+        // Begin by saving trace points
+        QuaZipFile sliceFile(zip);
+        if (!sliceFile.open(QIODevice::WriteOnly | QIODevice::Truncate, QuaZipNewInfo(layerFilename[i])))
+        {
+            qWarning() << "Error while creating tracing data file for " << layerFilename[i];
+            continue;
+        }
+
+        const int zDim = layers[i].getZDim();
+
+        QTextStream sliceStream(&sliceFile);
+        sliceStream << zDim << endl;
+        for (int z = 0; z < zDim; ++z)
+        {
+            auto &traceLayer = layers[i];
+            cv::Mat slice = traceLayer.getAxialSlice(z);
+
+            cv::Mat points;
+            opencv::findNonZero(slice, points);
+
+            // Only sort if there are points to sort
+            if (points.total() > 0)
+            {
+                // Sort based on Z, then Y, then X value.
+                std::sort(points.begin<cv::Vec2i>(), points.end<cv::Vec2i>(), [](const cv::Vec2i &a, const cv::Vec2i &b) {
+                    return !((a[0] >= b[0]) && (a[0] != b[0] || a[1] >= b[1]));
+                });
+            }
+
+            sliceStream << "#" << z << endl;
+            sliceStream << points.total() << endl;
+
+            for (size_t i = 0; i < points.total(); ++i)
+            {
+                const cv::Vec2i point = points.at<cv::Vec2i>((int)i);
+                sliceStream << forcepoint << (float)point[1] << " " << (float)point[0] << " " << (float)z << endl;
+            }
+        }
+
+        // Close slice file now that we are done with it
+        // Note: YOU CANNNOT HAVE TWO ZIP FILES OPENED AT ONCE SO BE CAREFUL
+        sliceFile.close();
+
+        // Save tracing time data next
+        QuaZipFile timeFile(zip);
+        if (!timeFile.open(QIODevice::WriteOnly | QIODevice::Truncate, QuaZipNewInfo(layerTimePath[i])))
+        {
+            qWarning() << "Error opening file to save time tracing data. Skipping layer: " << layerTimePath[i];
+            continue;
+        }
+
+        QTextStream timeStream(&timeFile);
+        timeStream << zDim << endl;
+
+        for (int z = 0; z < zDim; ++z)
+        {
+            auto &traceLayer = layers[i];
+
+            auto time = traceLayer.time[z];
+            auto h = std::chrono::duration_cast<std::chrono::hours>(time);
+            auto m = std::chrono::duration_cast<std::chrono::minutes>(time -= h);
+            auto s = std::chrono::duration_cast<std::chrono::seconds>(time -= m);
+            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(time -= s);
+            timeStream << "#" << z << " " << h.count() << "h " << m.count() << "m " << s.count() << "s " << ms.count() << "ms" << endl;
+        }
+    }
+
+    return true;
+}
+
+/* load reads the points and drawing times of each layer from the text files in zip, replacing the data of the layers. The
+ * layers must already be allocated with the dimensions of the image. The zip must be opened for reading.
+ *
+ * Returns:
+ *      true - No error occurred and the layers were loaded
+ *      false - The data does not match the dimensions of the layers
+ */
+bool TracingData::load(QuaZip *zip)
+{
+    const QString layerFilename[(int)TracingLayer::Count] = {"EAT.txt", "IMAT.txt", "PAAT.txt", "PAT.txt", "SCAT.txt", "VAT.txt"};
+    const QString timeDir = "times";
+    QString layerTimePath[(int)TracingLayer::Count];
+
+    // Prepend timeDir to the layer filename to store the times
+    for (int i = 0; i < (int)TracingLayer::Count; ++i)
+        layerTimePath[i] = QDir(timeDir).filePath(layerFilename[i]);
+
+    for (int i = 0; i < (int)TracingLayer::Count; ++i)
+    {
+        // Set current file to the current layer to load
+        zip->setCurrentFile(layerFilename[i]);
+
+        // Begin by loading trace points
+        QuaZipFile sliceFile(zip);
+        if (!sliceFile.open(QIODevice::ReadOnly))
+        {
+            qWarning() << "Error while creating tracing data file for " << layerFilename[i];
+            continue;
+        }
+
+        QTextStream sliceStream(&sliceFile);
+        int zDim;
+        sliceStream >> zDim;
+
+        auto &layer = layers[i];
+
+        if (zDim != layer.getZDim())
+        {
+            qWarning() << "Number of axial slices in the data does not match the NIFTI image loaded.";
+            return false; // Note: Return false because the other layers should be mismatched as well
+        }
+
+        // Discard previous data by setting everything to 0
+        layer.data.setTo(0);
+
+        for (int z = 0; z < zDim; ++z)
+        {
+            // Skip the #Z where Z is the axial slice
+            sliceStream.skipWhiteSpace();
+            sliceStream.readLine();
+
+            // Get the number of points on the slices
+            int numPoints = 0;
+            sliceStream >> numPoints;
+
+            float x, y, z_;
+            for (int ii = 0; ii < numPoints; ++ii)
+            {
+                sliceStream >> x >> y >> z_;
+
+                if ((z < 0 || z >= layer.getZDim()) || (y < 0 || y >= layer.getYDim()) || (x < 0 || x >= layer.getXDim()))
+                {
+                    qWarning() << "A point specified was outside the boundary of the current NIFTI image: (" << z << "," << y << "," << x << ")";
+                    return false;
+                }
+
+                layer.set(x, y, z);
+            }
+        }
+
+        // Close slice file now that we are done with it
+        // Note: YOU CANNOT HAVE TWO ZIP FILES OPENED AT ONCE SO BE CAREFUL
+        sliceFile.close();
+
+        // Load tracing time data next
+        // Set current file to the current time layer to load
+        zip->setCurrentFile(layerTimePath[i]);
+
+        QuaZipFile timeFile(zip);
+        if (!timeFile.open(QIODevice::ReadOnly))
+        {
+            qWarning() << "Error opening file to save time tracing data. Skipping layer: " << layerTimePath[i];
+            continue;
+        }
+
+        QTextStream timeStream(&timeFile);
+
+        timeStream >> zDim;
+
+        if (zDim != layer.getZDim())
+        {
+            qWarning() << "Number of axial slices in the time data does not match the NIFTI image loaded.";
+            return false; // Note: Return false because the other layers should be mismatched as well
+        }
+
+        for (int z = 0; z < zDim; ++z)
+        {
+            // Skip the #Z where Z is the axial slice
+            timeStream.skipWhiteSpace();
+
+            // Read timing
+            char dummy;
+            int z__;
+            QString str;
+            unsigned int h, m, s, ms;
+            timeStream >> dummy >> z__ >> ws >> h >> str >> ws >> m >> str >> ws >> s >> str >> ws >> ms >> str >> ws;
+            layer.time[z] = (std::chrono::hours(h) + std::chrono::minutes(m) + std::chrono::seconds(s) + std::chrono::milliseconds(ms));
+        }
+    }
+
+    return true;
+}
@@ -3,13 +3,29 @@
 
 #include <array>
 #include <QTime>
+#include <QPoint>
 #include <chrono>
+#include <cstring>
+#include <limits>
 
 #include <opencv2/opencv.hpp>
 
 #include "displayinfo.h"
 #include "numerictype.h"
 
+class QuaZip;
+
+// Run of length pixels starting at (x, y) on an axial slice
+// Note: Stored as 16-bit values to keep undo records small, this limits slices to 65535x65535
+struct TracingSpan
+{
+    unsigned short y;
+    unsigned short x;
+    unsigned short length;
+
+    TracingSpan(int y, int x, int length) : y((unsigned short)y), x((unsigned short)x), length((unsigned short)length) {}
+};
+
 class TracingLayerData
 {
 public:
@@ -32,6 +48,17 @@ public:
     void set(int x, int y, int z);
     void reset(int x, int y, int z);
 
+    // Draws a line from start to end on axial slice z using Bresenham's line algorithm, stamping the brush at each point of the line.
+    // Each run of pixels that was changed is appended to changed.
+    void drawLine(int z, QPoint start, QPoint end, int brushWidth, BrushShape brushShape, std::vector<TracingSpan> &changed);
+
+    // Clears the shape swept by the brush moving from start to end on axial slice z. The shape is cleared one row span at a time and
+    // each run of pixels that was set before clearing is appended to cleared.
+    void eraseLine(int z, QPoint start, QPoint end, int brushWidth, BrushShape brushShape, std::vector<TracingSpan> &cleared);
+
+    void setSpan(int z, const TracingSpan &span);
+    void resetSpan(int z, const TracingSpan &span);
+
     void load(int x, int y, int z);
 
     const NumericType *getType() const;
@@ -43,6 +70,10 @@ struct TracingData
 
     TracingLayerData &operator[](std::size_t layer) { return layers[layer]; }
     TracingLayerData &operator[](TracingLayer layer) { return layers[(std::size_t)layer]; }
+
+    // Reads and writes the layers as the text files of a tracing results (SDT) file
+    bool save(QuaZip *zip);
+    bool load(QuaZip *zip);
 };
 
 #endif // TRACING_H
@@ -0,0 +1,477 @@
+#include "tracingagreement.h"
+
+TracingAgreement::TracingAgreement(int xDim, int yDim, int zDim, double voxelWidth, double voxelHeight, double voxelDepth) :
+    xDim(xDim), yDim(yDim), zDim(zDim), voxelWidth(voxelWidth), voxelHeight(voxelHeight), voxelDepth(voxelDepth),
+    names(), results()
+{
+
+}
+
+/* addResults loads the tracing results file at filename as a new result set. The name is used for the set in the
+ * agreement table, such as the name of the rater.
+ *
+ * Returns:
+ *      true - No error occurred and the result set was added
+ *      false - The file could not be opened or it does not match the dimensions of the subject
+ */
+bool TracingAgreement::addResults(QString name, QString filename)
+{
+    QuaZip zip(filename);
+    if (!zip.open(QuaZip::mdUnzip))
+    {
+        qWarning() << "Unable to open SDT file at " << filename << ": " << zip.getZipError();
+        return false;
+    }
+
+    TracingData tracingData;
+    for (auto &layer : tracingData.layers)
+        layer.load(xDim, yDim, zDim);
+
+    bool success = tracingData.load(&zip);
+    zip.close();
+
+    if (!success)
+    {
+        qWarning() << "Unable to load the tracing results at " << filename;
+        return false;
+    }
+
+    names.push_back(name);
+    results.push_back(tracingData);
+    return true;
+}
+
+bool TracingAgreement::addResults(QString name, const TracingData &tracingData)
+{
+    for (auto &layer : tracingData.layers)
+    {
+        if (layer.data.empty() || layer.getXDim() != xDim || layer.getYDim() != yDim || layer.getZDim() != zDim)
+        {
+            qWarning() << "Tracing data does not match the dimensions of the subject: " << name;
+            return false;
+        }
+    }
+
+    names.push_back(name);
+    results.push_back(tracingData);
+    return true;
+}
+
+int TracingAgreement::count() const
+{
+    return (int)results.size();
+}
+
+QString TracingAgreement::getName(int index) const
+{
+    return names[index];
+}
+
+TracingData &TracingAgreement::getResults(int index)
+{
+    return results[index];
+}
+
+/* compute compares each pair of result sets for each tracing layer. For each pair and layer there is a row for the whole
+ * volume followed by a row for each axial slice that is traced in either set if perSlice is true.
+ */
+std::vector<AgreementRow> TracingAgreement::compute(bool perSlice) const
+{
+    std::vector<AgreementRow> rows;
+    std::vector<AgreementRow> sliceRows;
+
+    for (int first = 0; first < count(); ++first)
+    {
+        for (int second = first + 1; second < count(); ++second)
+        {
+            for (int layer = 0; layer < (int)TracingLayer::Count; ++layer)
+            {
+                rows.push_back(compare(first, second, (TracingLayer)layer, perSlice ? &sliceRows : NULL));
+                rows.insert(std::end(rows), std::begin(sliceRows), std::end(sliceRows));
+            }
+        }
+    }
+
+    return rows;
+}
+
+/* compare computes the agreement of one tracing layer between two result sets. The slices are counted in parallel and the
+ * Hausdorff distance is only computed for the slices that are traced in both sets but do not match exactly. The distance
+ * of the whole volume is computed in 3D afterwards.
+ *
+ * If sliceRows is not NULL, it is filled with a row for each axial slice that is traced in either set.
+ *
+ * Returns:
+ *      AgreementRow - Agreement for the whole volume
+ */
+AgreementRow TracingAgreement::compare(int first, int second, TracingLayer layer, std::vector<AgreementRow> *sliceRows) const
+{
+    const cv::Mat &firstData = results[first].layers[(int)layer].data;
+    const cv::Mat &secondData = results[second].layers[(int)layer].data;
+    const size_t sliceLength = (size_t)xDim * yDim;
+
+    std::vector<SetCounts> counts(zDim);
+    std::vector<double> distances(zDim, std::numeric_limits<double>::infinity());
+
+    cv::parallel_for_(cv::Range(0, zDim), [&](const cv::Range &range)
+    {
+        for (int z = range.start; z < range.end; ++z)
+        {
+            counts[z] = count(firstData.ptr<unsigned char>(z), secondData.ptr<unsigned char>(z), sliceLength);
+
+            if (counts[z].first == 0 && counts[z].second == 0)
+                distances[z] = 0.0;
+            else if (counts[z].intersect == counts[z].first && counts[z].intersect == counts[z].second)
+                distances[z] = 0.0;
+            else if (counts[z].first > 0 && counts[z].second > 0)
+            {
+                const cv::Range region[] = { cv::Range(z, z + 1), cv::Range::all(), cv::Range::all() };
+                distances[z] = hausdorffDistance(cv::Mat(firstData, region), cv::Mat(secondData, region), voxelWidth,
+                                                 voxelHeight, voxelDepth);
+            }
+        }
+    });
+
+    // Voxels are given in mm^3 and 1 mL is 1000 mm^3
+    const double voxelVolume = voxelWidth * voxelHeight * voxelDepth / 1000.0;
+
+    auto makeRow = [&](int slice, const SetCounts &counts, double distance)
+    {
+        AgreementRow row;
+        row.first = first;
+        row.second = second;
+        row.layer = layer;
+        row.slice = slice;
+        row.counts = counts;
+
+        const size_t unite = counts.unite();
+        row.dice = (counts.first + counts.second > 0) ? 2.0 * counts.intersect / (counts.first + counts.second) : 1.0;
+        row.jaccard = (unite > 0) ? (double)counts.intersect / unite : 1.0;
+        row.volumeDifference = ((double)counts.first - (double)counts.second) * voxelVolume;
+        row.hausdorff = distance;
+
+        return row;
+    };
+
+    if (sliceRows)
+        sliceRows->clear();
+
+    SetCounts total;
+    for (int z = 0; z < zDim; ++z)
+    {
+        total.first += counts[z].first;
+        total.second += counts[z].second;
+        total.intersect += counts[z].intersect;
+
+        if (sliceRows && (counts[z].first > 0 || counts[z].second > 0))
+            sliceRows->push_back(makeRow(z, counts[z], distances[z]));
+    }
+
+    double distance = std::numeric_limits<double>::infinity();
+    if (total.intersect == total.first && total.intersect == total.second)
+        distance = 0.0;
+    else if (total.first > 0 && total.second > 0)
+        distance = hausdorffDistance(firstData, secondData, voxelWidth, voxelHeight, voxelDepth);
+
+    return makeRow(-1, total, distance);
+}
+
+void TracingAgreement::writeTable(QTextStream &stream, const std::vector<AgreementRow> &rows) const
+{
+    stream << "First,Second,Layer,Slice,First Voxels,Second Voxels,Intersect Voxels,Union Voxels,Dice,Jaccard,"
+              "Volume Difference (mL),Hausdorff Distance (mm)" << endl;
+
+    for (const AgreementRow &row : rows)
+    {
+        stream << names[row.first] << "," << names[row.second] << "," << tracingLayerName(row.layer) << ","
+               << (row.slice < 0 ? QString("All") : QString::number(row.slice)) << ","
+               << row.counts.first << "," << row.counts.second << "," << row.counts.intersect << "," << row.counts.unite() << ","
+               << QString::number(row.dice, 'f', 4) << "," << QString::number(row.jaccard, 'f', 4) << ","
+               << QString::number(row.volumeDifference, 'f', 4) << "," << QString::number(row.hausdorff, 'f', 2) << endl;
+    }
+}
+
+/* combine stores the result of the set operation on the first and second layer in result. The result is allocated if it
+ * does not have the size of the layers and it may be one of the layers. The slices are combined in parallel, 8 voxels at
+ * a time.
+ */
+void TracingAgreement::combine(const TracingLayerData &first, const TracingLayerData &second, SetOperation op, TracingLayerData &result)
+{
+    const cv::Mat firstData = first.data;
+    const cv::Mat secondData = second.data;
+    const int zDim = firstData.size[0];
+    const size_t sliceLength = (size_t)firstData.size[1] * firstData.size[2];
+
+    // The time spent on each slice is added up since both sets of tracing are part of the result
+    std::vector<std::chrono::milliseconds> time(zDim, std::chrono::milliseconds(0));
+    for (int z = 0; z < zDim; ++z)
+    {
+        if (z < (int)first.time.size())
+            time[z] += first.time[z];
+
+        if (z < (int)second.time.size())
+            time[z] += second.time[z];
+    }
+
+    result.time = time;
+
+    if (result.data.size != firstData.size || result.data.type() != firstData.type())
+        result.data = cv::Mat(firstData.dims, firstData.size.p, firstData.type());
+
+    cv::Mat resultData = result.data;
+    cv::parallel_for_(cv::Range(0, zDim), [&](const cv::Range &range)
+    {
+        for (int z = range.start; z < range.end; ++z)
+        {
+            const unsigned char *a = firstData.ptr<unsigned char>(z);
+            const unsigned char *b = secondData.ptr<unsigned char>(z);
+            unsigned char *r = resultData.ptr<unsigned char>(z);
+
+            size_t i = 0;
+            for (; i + sizeof(uint64_t) <= sliceLength; i += sizeof(uint64_t))
+            {
+                uint64_t wordA, wordB, wordR;
+                std::memcpy(&wordA, a + i, sizeof(uint64_t));
+                std::memcpy(&wordB, b + i, sizeof(uint64_t));
+
+                switch (op)
+                {
+                    case SetOperation::Union: wordR = wordA | wordB; break;
+                    case SetOperation::Intersect: wordR = wordA & wordB; break;
+                    case SetOperation::Xor: wordR = wordA ^ wordB; break;
+                    case SetOperation::Difference: default: wordR = wordA & ~wordB; break;
+                }
+
+                std::memcpy(r + i, &wordR, sizeof(uint64_t));
+            }
+
+            for (; i < sliceLength; ++i)
+            {
+                switch (op)
+                {
+                    case SetOperation::Union: r[i] = a[i] | b[i]; break;
+                    case SetOperation::Intersect: r[i] = a[i] & b[i]; break;
+                    case SetOperation::Xor: r[i] = a[i] ^ b[i]; break;
+                    case SetOperation::Difference: default: r[i] = a[i] & ~b[i]; break;
+                }
+            }
+        }
+    });
+}
+
+void TracingAgreement::combine(TracingData &first, TracingData &second, SetOperation op, TracingData &result)
+{
+    for (int i = 0; i < (int)TracingLayer::Count; ++i)
+        combine(first[i], second[i], op, result[i]);
+}
+
+/* count returns the number of voxels set in the first and second buffer and in both of them. Set voxels must be 255 so
+ * that the number of set bits of a 64-bit word is 8 times the number of set voxels in it.
+ */
+SetCounts TracingAgreement::count(const unsigned char *first, const unsigned char *second, size_t length)
+{
+    size_t firstBits = 0;
+    size_t secondBits = 0;
+    size_t intersectBits = 0;
+
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t))
+    {
+        uint64_t wordA, wordB;
+        std::memcpy(&wordA, first + i, sizeof(uint64_t));
+        std::memcpy(&wordB, second + i, sizeof(uint64_t));
+
+        // Most of a slice is not traced, so empty words are skipped before counting
+        if ((wordA | wordB) == 0)
+            continue;
+
+        firstBits += std::bitset<64>(wordA).count();
+        secondBits += std::bitset<64>(wordB).count();
+        intersectBits += std::bitset<64>(wordA & wordB).count();
+    }
+
+    for (; i < length; ++i)
+    {
+        firstBits += std::bitset<8>(first[i]).count();
+        secondBits += std::bitset<8>(second[i]).count();
+        intersectBits += std::bitset<8>(first[i] & second[i]).count();
+    }
+
+    SetCounts counts;
+    counts.first = firstBits / 8;
+    counts.second = secondBits / 8;
+    counts.intersect = intersectBits / 8;
+
+    return counts;
+}
+
+/* hausdorffDistance returns the largest distance in mm from a voxel of one mask to the closest voxel of the other mask. The
+ * masks are ordered {z, y, x} and may be a single axial slice, in which case the distance is measured in its plane. The
+ * distance is infinite if only one of the masks has a voxel set.
+ */
+double TracingAgreement::hausdorffDistance(const cv::Mat &first, const cv::Mat &second, double voxelWidth, double voxelHeight,
+                                           double voxelDepth)
+{
+    const int zDim = first.size[0];
+    const int yDim = first.size[1];
+    const int xDim = first.size[2];
+
+    // Largest distance of the voxels set in mask to the closest voxel of the other mask, each slice is searched in parallel
+    auto directedDistance = [&](const cv::Mat &mask, const cv::Mat &distance)
+    {
+        std::vector<float> sliceMax(zDim, 0.0f);
+        cv::parallel_for_(cv::Range(0, zDim), [&](const cv::Range &range)
+        {
+            for (int z = range.start; z < range.end; ++z)
+            {
+                for (int y = 0; y < yDim; ++y)
+                {
+                    const unsigned char *m = mask.ptr<unsigned char>(z, y);
+                    const float *d = distance.ptr<float>(z, y);
+
+                    for (int x = 0; x < xDim; ++x)
+                    {
+                        if (m[x])
+                            sliceMax[z] = std::max(sliceMax[z], d[x]);
+                    }
+                }
+            }
+        });
+
+        return *std::max_element(std::begin(sliceMax), std::end(sliceMax));
+    };
+
+    // The transforms hold the squared distance, so the root is taken of the largest one. The first transform is released
+    // before the second is computed since each is 4 bytes per voxel
+    float firstToSecond = directedDistance(first, distanceTransform(second, voxelWidth, voxelHeight, voxelDepth));
+    float secondToFirst = directedDistance(second, distanceTransform(first, voxelWidth, voxelHeight, voxelDepth));
+
+    return std::sqrt((double)std::max(firstToSecond, secondToFirst));
+}
+
+/* distanceTransform returns the squared distance in mm^2 from each voxel to the closest voxel that is set in mask as a float
+ * matrix ordered {z, y, x}. The exact Euclidean distance is computed with one pass of lower parabola envelopes along each
+ * axis (Felzenszwalb and Huttenlocher), where each axis is scaled by its voxel size. Every voxel is infinite if no voxel
+ * of mask is set.
+ */
+cv::Mat TracingAgreement::distanceTransform(const cv::Mat &mask, double voxelWidth, double voxelHeight, double voxelDepth)
+{
+    const int zDim = mask.size[0];
+    const int yDim = mask.size[1];
+    const int xDim = mask.size[2];
+    const float infinity = std::numeric_limits<float>::infinity();
+
+    const int dims[] = { zDim, yDim, xDim };
+    cv::Mat distance(3, dims, CV_32F);
+    float *data = distance.ptr<float>();
+
+    // Transforms the n values of line that are stride apart, the voxels are spacing mm apart along the line. A line with no
+    // finite values is left infinite
+    auto pass = [infinity](float *line, int n, size_t stride, double spacing, std::vector<float> &values,
+                           std::vector<int> &vertices, std::vector<double> &bounds)
+    {
+        const double spacing2 = spacing * spacing;
+        int k = -1;
+
+        for (int q = 0; q < n; ++q)
+        {
+            values[q] = line[q * stride];
+            if (values[q] == infinity)
+                continue;
+
+            // Parabolas of the envelope that are hidden by the parabola at q are removed
+            double s = -infinity;
+            while (k >= 0)
+            {
+                const int p = vertices[k];
+                s = ((values[q] + spacing2 * q * q) - (values[p] + spacing2 * p * p)) / (2.0 * spacing2 * (q - p));
+                if (s > bounds[k])
+                    break;
+
+                --k;
+            }
+
+            ++k;
+            vertices[k] = q;
+            bounds[k] = (k == 0) ? -infinity : s;
+            bounds[k + 1] = infinity;
+        }
+
+        if (k < 0)
+            return;
+
+        for (int q = 0, j = 0; q < n; ++q)
+        {
+            while (bounds[j + 1] < q)
+                ++j;
+
+            const double offset = spacing * (q - vertices[j]);
+            line[q * stride] = (float)(offset * offset + values[vertices[j]]);
+        }
+    };
+
+    // Each pass runs over the lines of one axis in parallel and every thread has its own buffers for the envelope
+    auto runPass = [&](int lines, int n, size_t stride, double spacing, std::function<float *(int)> lineStart)
+    {
+        cv::parallel_for_(cv::Range(0, lines), [&](const cv::Range &range)
+        {
+            std::vector<float> values(n);
+            std::vector<int> vertices(n);
+            std::vector<double> bounds(n + 1);
+
+            for (int i = range.start; i < range.end; ++i)
+                pass(lineStart(i), n, stride, spacing, values, vertices, bounds);
+        });
+    };
+
+    cv::parallel_for_(cv::Range(0, zDim), [&](const cv::Range &range)
+    {
+        for (int z = range.start; z < range.end; ++z)
+        {
+            for (int y = 0; y < yDim; ++y)
+            {
+                const unsigned char *m = mask.ptr<unsigned char>(z, y);
+                float *d = distance.ptr<float>(z, y);
+
+                for (int x = 0; x < xDim; ++x)
+                    d[x] = m[x] ? 0.0f : infinity;
+            }
+        }
+    });
+
+    const size_t sliceLength = (size_t)xDim * yDim;
+
+    runPass(zDim * yDim, xDim, 1, voxelWidth, [&](int i) { return data + (size_t)i * xDim; });
+    runPass(zDim * xDim, yDim, xDim, voxelHeight, [&](int i) { return data + (i / xDim) * sliceLength + (i % xDim); });
+    if (zDim > 1)
+        runPass(yDim * xDim, zDim, sliceLength, voxelDepth, [&](int i) { return data + i; });
+
+    return distance;
+}
+
+QString TracingAgreement::operationName(SetOperation op)
+{
+    switch (op)
+    {
+        case SetOperation::Union: return "union";
+        case SetOperation::Intersect: return "intersect";
+        case SetOperation::Xor: return "xor";
+        case SetOperation::Difference: return "difference";
+    }
+
+    return QString();
+}
+
+bool TracingAgreement::operationFromName(QString name, SetOperation &op)
+{
+    for (SetOperation value : { SetOperation::Union, SetOperation::Intersect, SetOperation::Xor, SetOperation::Difference })
+    {
+        if (name.compare(operationName(value), Qt::CaseInsensitive) == 0)
+        {
+            op = value;
+            return true;
+        }
+    }
+
+    return false;
+}
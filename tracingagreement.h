@@ -0,0 +1,117 @@
+#ifndef TRACINGAGREEMENT_H
+#define TRACINGAGREEMENT_H
+
+#include <QDebug>
+#include <QString>
+#include <QFileInfo>
+#include <QTextStream>
+#include <vector>
+#include <bitset>
+#include <cstring>
+#include <cstdint>
+#include <limits>
+#include <algorithm>
+#include <functional>
+#include <cmath>
+
+#include <opencv2/opencv.hpp>
+
+#include "displayinfo.h"
+#include "tracing.h"
+#include "quazip.h"
+
+enum class SetOperation : int
+{
+    Union = 0,
+    Intersect,
+    Xor,
+    Difference  // Voxels of the first set that are not in the second set
+};
+
+// Number of voxels set in two layers and in both of them for one axial slice or for the whole volume
+struct SetCounts
+{
+    size_t first;
+    size_t second;
+    size_t intersect;
+
+    SetCounts() : first(0), second(0), intersect(0) {}
+
+    size_t unite() const { return first + second - intersect; }
+};
+
+// Agreement of one tracing layer between two result sets. The slice is -1 for the row of the whole volume
+struct AgreementRow
+{
+    int first;
+    int second;
+    TracingLayer layer;
+    int slice;
+
+    SetCounts counts;
+
+    double dice;
+    double jaccard;
+    // Volume of the first set minus the volume of the second set in mL
+    double volumeDifference;
+    // Hausdorff distance in mm, measured in 3D for the row of the whole volume. It is infinite if only one set is traced
+    double hausdorff;
+};
+
+/* TracingAgreement compares the tracing results of two or more raters, or of one rater at different times, for the same
+ * subject. Each pair of result sets is compared for each tracing layer and each axial slice with the Dice and Jaccard
+ * coefficients, the difference in volume and the Hausdorff distance.
+ *
+ * The layers store 255 for each voxel that is set, so the layers are processed 8 voxels at a time as 64-bit words and
+ * the number of set voxels is the number of set bits divided by 8. The slices are processed in parallel.
+ *
+ * Note: The Hausdorff distance of a slice is measured in the plane of the slice, and the distance of the whole volume is
+ * measured in 3D so that the tracing of one set is matched to the closest tracing of the other set on any slice. The
+ * distances are scaled by the voxel size of each axis. If only one of the sets is traced, the distance is infinite.
+ */
+class TracingAgreement
+{
+private:
+    int xDim;
+    int yDim;
+    int zDim;
+
+    // Size of a voxel in mm
+    double voxelWidth;
+    double voxelHeight;
+    double voxelDepth;
+
+    std::vector<QString> names;
+    std::vector<TracingData> results;
+
+public:
+    TracingAgreement(int xDim, int yDim, int zDim, double voxelWidth = 1.0, double voxelHeight = 1.0, double voxelDepth = 1.0);
+
+    // Loads the tracing results file at filename. Returns false if it does not match the dimensions of the subject
+    bool addResults(QString name, QString filename);
+    // The layers are not copied, so the tracing data must not be changed while the agreement is computed
+    bool addResults(QString name, const TracingData &tracingData);
+
+    int count() const;
+    QString getName(int index) const;
+    TracingData &getResults(int index);
+
+    // Compares each pair of result sets. If perSlice is false, only the rows for the whole volume are computed
+    std::vector<AgreementRow> compute(bool perSlice = true) const;
+    AgreementRow compare(int first, int second, TracingLayer layer, std::vector<AgreementRow> *sliceRows = NULL) const;
+
+    // Writes the rows as comma-separated values with a header line
+    void writeTable(QTextStream &stream, const std::vector<AgreementRow> &rows) const;
+
+    static void combine(const TracingLayerData &first, const TracingLayerData &second, SetOperation op, TracingLayerData &result);
+    static void combine(TracingData &first, TracingData &second, SetOperation op, TracingData &result);
+    static SetCounts count(const unsigned char *first, const unsigned char *second, size_t length);
+    static double hausdorffDistance(const cv::Mat &first, const cv::Mat &second, double voxelWidth, double voxelHeight,
+                                    double voxelDepth);
+    static cv::Mat distanceTransform(const cv::Mat &mask, double voxelWidth, double voxelHeight, double voxelDepth);
+
+    static QString operationName(SetOperation op);
+    static bool operationFromName(QString name, SetOperation &op);
+};
+
+#endif // TRACINGAGREEMENT_H
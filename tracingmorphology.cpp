@@ -0,0 +1,487 @@
+#include "tracingmorphology.h"
+
+constexpr int TracingMorphology::maxRadius;
+
+// Bit-packed copy of a range of axial slices with one bit per voxel. Bit b of word w of a row is voxel x = w * 64 + b
+class BitVolume
+{
+public:
+    int zDim;
+    int yDim;
+    int xDim;
+    int words;
+
+    // Bits of the last word of a row that are inside the volume
+    uint64_t lastMask;
+
+    std::vector<uint64_t> bits;
+
+    BitVolume(int zDim, int yDim, int xDim) : zDim(zDim), yDim(yDim), xDim(xDim), words((xDim + 63) / 64),
+        lastMask((xDim % 64) ? ((uint64_t)1 << (xDim % 64)) - 1 : ~(uint64_t)0), bits((size_t)zDim * yDim * words, 0) {}
+
+    size_t sliceWords() const { return (size_t)yDim * words; }
+    uint64_t *row(int z, int y) { return &bits[((size_t)z * yDim + y) * words]; }
+};
+
+// Packs axial slices zStart to zEnd (exclusive) of volume
+static BitVolume pack(const cv::Mat &volume, int zStart, int zEnd)
+{
+    BitVolume packed(zEnd - zStart, volume.size[1], volume.size[2]);
+
+    cv::parallel_for_(cv::Range(0, packed.zDim), [&](const cv::Range &range)
+    {
+        for (int z = range.start; z < range.end; ++z)
+        {
+            for (int y = 0; y < packed.yDim; ++y)
+            {
+                const unsigned char *src = volume.ptr<unsigned char>(zStart + z, y);
+                uint64_t *dst = packed.row(z, y);
+
+                for (int w = 0; w < packed.words; ++w)
+                {
+                    const unsigned char *voxels = src + w * 64;
+                    const int count = std::min(64, packed.xDim - w * 64);
+                    uint64_t word = 0;
+
+                    for (int b = 0; b < count; ++b)
+                        word |= (uint64_t)(voxels[b] != 0) << b;
+
+                    dst[w] = word;
+                }
+            }
+        }
+    });
+
+    return packed;
+}
+
+// Unpacks the slices of packed starting at zOffset into slab as 0 or 255
+static void unpack(BitVolume &packed, int zOffset, cv::Mat &slab)
+{
+    cv::parallel_for_(cv::Range(0, slab.size[0]), [&](const cv::Range &range)
+    {
+        for (int z = range.start; z < range.end; ++z)
+        {
+            for (int y = 0; y < packed.yDim; ++y)
+            {
+                const uint64_t *src = packed.row(zOffset + z, y);
+                unsigned char *dst = slab.ptr<unsigned char>(z, y);
+
+                for (int x = 0; x < packed.xDim; ++x)
+                    dst[x] = ((src[x >> 6] >> (x & 63)) & 1) ? 255 : 0;
+            }
+        }
+    });
+}
+
+static inline uint64_t combineWords(uint64_t a, uint64_t b, bool dilate)
+{
+    return dilate ? (a | b) : (a & b);
+}
+
+/* morphRow dilates or erodes one packed row along X. Voxel x is combined with voxels x - s and x + s for s = 1 to radius,
+ * which are the row shifted up and down by s bits with the bits carried in from the neighboring words.
+ */
+static void morphRow(uint64_t *row, uint64_t *buffer, int words, uint64_t lastMask, int radius, bool dilate)
+{
+    std::copy(row, row + words, buffer);
+
+    // The bits past the end of the row count as outside of the volume
+    const uint64_t outside = dilate ? 0 : ~(uint64_t)0;
+    buffer[words - 1] = (buffer[words - 1] & lastMask) | (outside & ~lastMask);
+
+    for (int w = 0; w < words; ++w)
+    {
+        const uint64_t current = buffer[w];
+        const uint64_t previous = (w > 0) ? buffer[w - 1] : outside;
+        const uint64_t next = (w + 1 < words) ? buffer[w + 1] : outside;
+
+        uint64_t result = current;
+        for (int s = 1; s <= radius; ++s)
+        {
+            const uint64_t fromLower = (current << s) | (previous >> (64 - s));
+            const uint64_t fromUpper = (current >> s) | (next << (64 - s));
+
+            result = combineWords(result, combineWords(fromLower, fromUpper, dilate), dilate);
+        }
+
+        row[w] = result;
+    }
+
+    row[words - 1] &= lastMask;
+}
+
+/* morph dilates or erodes the packed volume with a box of 2 * radius + 1 voxels. The box is separable, so the volume is
+ * processed along X, then Y, then Z. Along Y and Z, whole rows and slices are combined word by word.
+ */
+static void morph(BitVolume &volume, int radius, bool threeD, bool dilate)
+{
+    if (radius <= 0)
+        return;
+
+    const int words = volume.words;
+    const size_t sliceWords = volume.sliceWords();
+
+    cv::parallel_for_(cv::Range(0, volume.zDim), [&](const cv::Range &range)
+    {
+        std::vector<uint64_t> rowBuffer(words);
+        std::vector<uint64_t> sliceBuffer(sliceWords);
+
+        for (int z = range.start; z < range.end; ++z)
+        {
+            for (int y = 0; y < volume.yDim; ++y)
+                morphRow(volume.row(z, y), rowBuffer.data(), words, volume.lastMask, radius, dilate);
+
+            uint64_t *slice = volume.row(z, 0);
+            std::copy(slice, slice + sliceWords, std::begin(sliceBuffer));
+
+            for (int y = 0; y < volume.yDim; ++y)
+            {
+                uint64_t *dst = slice + (size_t)y * words;
+                const int yEnd = std::min(y + radius, volume.yDim - 1);
+
+                // Rows outside of the volume are left out, which counts as background when dilating and traced when eroding
+                for (int other = std::max(y - radius, 0); other <= yEnd; ++other)
+                {
+                    const uint64_t *src = &sliceBuffer[(size_t)other * words];
+
+                    for (int w = 0; w < words; ++w)
+                        dst[w] = combineWords(dst[w], src[w], dilate);
+                }
+            }
+        }
+    });
+
+    if (!threeD)
+        return;
+
+    std::vector<uint64_t> result(volume.bits.size());
+
+    cv::parallel_for_(cv::Range(0, volume.zDim), [&](const cv::Range &range)
+    {
+        for (int z = range.start; z < range.end; ++z)
+        {
+            uint64_t *dst = &result[z * sliceWords];
+            std::copy(volume.row(z, 0), volume.row(z, 0) + sliceWords, dst);
+
+            const int zEnd = std::min(z + radius, volume.zDim - 1);
+            for (int other = std::max(z - radius, 0); other <= zEnd; ++other)
+            {
+                const uint64_t *src = volume.row(other, 0);
+
+                for (size_t i = 0; i < sliceWords; ++i)
+                    dst[i] = combineWords(dst[i], src[i], dilate);
+            }
+        }
+    });
+
+    volume.bits.swap(result);
+}
+
+/* apply computes the operation on the slab of layer and compares the result with the layer. The slices are compared in
+ * parallel and each row that changed is split into runs of voxels that were set and runs that were cleared.
+ *
+ * Returns:
+ *      std::vector<MorphologySliceSpans> - Runs of voxels that change on each slice of the slab that changes
+ */
+std::vector<MorphologySliceSpans> TracingMorphology::apply(TracingLayerData &layer, const MorphologyOptions &options)
+{
+    const cv::Mat slab = compute(layer, options);
+    if (slab.empty())
+        return std::vector<MorphologySliceSpans>();
+
+    const int zStart = std::max(options.zStart, 0);
+    const int yDim = slab.size[1];
+    const int xDim = slab.size[2];
+
+    std::vector<MorphologySliceSpans> slices(slab.size[0]);
+
+    cv::parallel_for_(cv::Range(0, slab.size[0]), [&](const cv::Range &range)
+    {
+        for (int z = range.start; z < range.end; ++z)
+        {
+            MorphologySliceSpans &spans = slices[z];
+            spans.z = zStart + z;
+
+            for (int y = 0; y < yDim; ++y)
+            {
+                const unsigned char *oldRow = layer.data.ptr<unsigned char>(zStart + z, y);
+                const unsigned char *newRow = slab.ptr<unsigned char>(z, y);
+
+                if (std::memcmp(oldRow, newRow, xDim) == 0)
+                    continue;
+
+                int x = 0;
+                while (x < xDim)
+                {
+                    if (oldRow[x] == newRow[x])
+                    {
+                        ++x;
+                        continue;
+                    }
+
+                    const int start = x;
+                    const bool set = (newRow[x] != 0);
+
+                    while (x < xDim && oldRow[x] != newRow[x] && (newRow[x] != 0) == set)
+                        ++x;
+
+                    (set ? spans.set : spans.cleared).emplace_back(y, start, x - start);
+                }
+            }
+        }
+    });
+
+    slices.erase(std::remove_if(std::begin(slices), std::end(slices), [](const MorphologySliceSpans &spans) {
+        return spans.set.empty() && spans.cleared.empty();
+    }), std::end(slices));
+
+    return slices;
+}
+
+/* compute applies the operation to the slab of the layer without changing the layer. For dilation and erosion along Z,
+ * the slices around the slab are read as well so that the slices at the edges of the slab are correct.
+ *
+ * Returns:
+ *      cv::Mat - Slab after the operation of zEnd - zStart slices. Empty if the slab has no slices
+ */
+cv::Mat TracingMorphology::compute(TracingLayerData &layer, const MorphologyOptions &options)
+{
+    const int zDim = layer.getZDim();
+    const int zStart = std::max(options.zStart, 0);
+    const int zEnd = std::min(options.zEnd, zDim);
+    const int radius = std::min(std::max(options.radius, 0), maxRadius);
+
+    if (zStart >= zEnd)
+        return cv::Mat();
+
+    switch (options.operation)
+    {
+        case MorphologyOperation::Dilate:
+        case MorphologyOperation::Erode:
+        case MorphologyOperation::Open:
+        case MorphologyOperation::Close:
+        {
+            const bool twoPasses = (options.operation == MorphologyOperation::Open || options.operation == MorphologyOperation::Close);
+            const int margin = options.threeD ? radius * (twoPasses ? 2 : 1) : 0;
+            const int packStart = std::max(zStart - margin, 0);
+            const int packEnd = std::min(zEnd + margin, zDim);
+
+            BitVolume packed = pack(layer.data, packStart, packEnd);
+
+            switch (options.operation)
+            {
+                case MorphologyOperation::Dilate: morph(packed, radius, options.threeD, true); break;
+                case MorphologyOperation::Erode: morph(packed, radius, options.threeD, false); break;
+                case MorphologyOperation::Open:
+                    morph(packed, radius, options.threeD, false);
+                    morph(packed, radius, options.threeD, true);
+                    break;
+                case MorphologyOperation::Close:
+                    morph(packed, radius, options.threeD, true);
+                    morph(packed, radius, options.threeD, false);
+                    break;
+                default: break;
+            }
+
+            cv::Mat slab({zEnd - zStart, layer.getYDim(), layer.getXDim()}, CV_8UC1);
+            unpack(packed, zStart - packStart, slab);
+            return slab;
+        }
+
+        case MorphologyOperation::FillHoles:
+        case MorphologyOperation::RemoveSmallComponents:
+        {
+            cv::Mat slab = layer.getRegion({cv::Range(zStart, zEnd), cv::Range::all(), cv::Range::all()}, true);
+
+            if (options.operation == MorphologyOperation::FillHoles)
+                fillHoles(slab, options.threeD);
+            else
+                removeSmallComponents(slab, options.minComponentSize, options.threeD);
+
+            return slab;
+        }
+
+        default:
+            return cv::Mat();
+    }
+}
+
+// Run of background voxels xStart to xEnd (exclusive) on row y of axial slice z that has been reached by the 3D fill
+struct BackgroundRun
+{
+    int z;
+    int y;
+    int xStart;
+    int xEnd;
+};
+
+/* fillHoles sets the background voxels of the slab that cannot be reached from the edge of the slab without crossing a
+ * traced voxel. The background is connected along the axes (4-connected on a slice, 6-connected in 3D).
+ *
+ * In 3D, each slice is first filled from its own edges in parallel, and the first and last slices are reached everywhere
+ * since they are faces of the slab. The background that a slice reached and that touches unreached background on the
+ * slice above or below is then spread with a scanline fill that keeps a stack of runs rather than single voxels.
+ */
+void TracingMorphology::fillHoles(cv::Mat &slab, bool threeD)
+{
+    const int zDim = slab.size[0];
+    const int yDim = slab.size[1];
+    const int xDim = slab.size[2];
+
+    // The background that is reached from the edges of each slice is marked with 128
+    cv::parallel_for_(cv::Range(0, zDim), [&](const cv::Range &range)
+    {
+        const int dims[] = { yDim, xDim };
+        cv::Mat padded(yDim + 2, xDim + 2, CV_8UC1);
+
+        for (int z = range.start; z < range.end; ++z)
+        {
+            const cv::Range region[] = { cv::Range(z, z + 1), cv::Range::all(), cv::Range::all() };
+            cv::Mat slice = cv::Mat(slab, region).reshape(0, 2, dims);
+
+            if (threeD && (z == 0 || z == zDim - 1))
+            {
+                slice.setTo(128, slice == 0);
+                continue;
+            }
+
+            // The border of one pixel around the slice connects all of the background at the edges of the slice
+            padded.setTo(0);
+            slice.copyTo(padded(cv::Rect(1, 1, xDim, yDim)));
+            cv::floodFill(padded, cv::Point(0, 0), cv::Scalar(128));
+
+            slice.setTo(128, padded(cv::Rect(1, 1, xDim, yDim)) == 128);
+        }
+    });
+
+    if (threeD)
+    {
+        const size_t sliceSize = (size_t)yDim * xDim;
+        unsigned char *data = slab.ptr<unsigned char>();
+
+        // Runs of reached background on each slice that touch unreached background on the slice above or below
+        std::vector<std::vector<BackgroundRun>> seeds(zDim);
+
+        cv::parallel_for_(cv::Range(0, zDim), [&](const cv::Range &range)
+        {
+            for (int z = range.start; z < range.end; ++z)
+            {
+                for (int y = 0; y < yDim; ++y)
+                {
+                    const unsigned char *row = data + z * sliceSize + (size_t)y * xDim;
+                    const unsigned char *below = (z > 0) ? row - sliceSize : NULL;
+                    const unsigned char *above = (z < zDim - 1) ? row + sliceSize : NULL;
+
+                    int x = 0;
+                    while (x < xDim)
+                    {
+                        if (row[x] != 128)
+                        {
+                            ++x;
+                            continue;
+                        }
+
+                        const int start = x;
+                        bool touches = false;
+
+                        for (; x < xDim && row[x] == 128; ++x)
+                            touches = touches || (below && below[x] == 0) || (above && above[x] == 0);
+
+                        if (touches)
+                            seeds[z].push_back({z, y, start, x});
+                    }
+                }
+            }
+        });
+
+        std::vector<BackgroundRun> stack;
+        for (std::vector<BackgroundRun> &runs : seeds)
+        {
+            stack.insert(std::end(stack), std::begin(runs), std::end(runs));
+            std::vector<BackgroundRun>().swap(runs);
+        }
+
+        // Marks each run of unreached background on row y of slice z that overlaps xStart to xEnd and pushes it
+        auto scan = [&](int z, int y, int xStart, int xEnd)
+        {
+            unsigned char *row = data + z * sliceSize + (size_t)y * xDim;
+
+            int x = xStart;
+            while (x < xEnd)
+            {
+                if (row[x] != 0)
+                {
+                    ++x;
+                    continue;
+                }
+
+                int start = x;
+                while (start > 0 && row[start - 1] == 0)
+                    --start;
+
+                while (x < xDim && row[x] == 0)
+                    ++x;
+
+                std::memset(row + start, 128, x - start);
+                stack.push_back({z, y, start, x});
+            }
+        };
+
+        while (!stack.empty())
+        {
+            const BackgroundRun run = stack.back();
+            stack.pop_back();
+
+            if (run.y > 0) scan(run.z, run.y - 1, run.xStart, run.xEnd);
+            if (run.y < yDim - 1) scan(run.z, run.y + 1, run.xStart, run.xEnd);
+            if (run.z > 0) scan(run.z - 1, run.y, run.xStart, run.xEnd);
+            if (run.z < zDim - 1) scan(run.z + 1, run.y, run.xStart, run.xEnd);
+        }
+    }
+
+    // Background that was not reached is a hole
+    cv::parallel_for_(cv::Range(0, zDim), [&](const cv::Range &range)
+    {
+        for (int z = range.start; z < range.end; ++z)
+        {
+            for (int y = 0; y < yDim; ++y)
+            {
+                unsigned char *row = slab.ptr<unsigned char>(z, y);
+
+                for (int x = 0; x < xDim; ++x)
+                    row[x] = (row[x] == 128) ? 0 : 255;
+            }
+        }
+    });
+}
+
+/* removeSmallComponents clears the traced components of the slab with fewer than minSize voxels. In 3D, the components are
+ * connected across slices (see ConnectedComponents), otherwise each slice is on its own. Only the voxels within the slab
+ * are counted.
+ */
+void TracingMorphology::removeSmallComponents(cv::Mat &slab, int minSize, bool threeD)
+{
+    ConnectedComponents components;
+    components.compute(slab, threeD);
+
+    std::vector<unsigned char> remove(components.count());
+    for (int i = 0; i < components.count(); ++i)
+        remove[i] = (components.at(i).size < (size_t)minSize);
+
+    components.removeComponents(slab, remove);
+}
+
+QString TracingMorphology::operationName(MorphologyOperation op)
+{
+    switch (op)
+    {
+        case MorphologyOperation::Dilate: return "Dilate";
+        case MorphologyOperation::Erode: return "Erode";
+        case MorphologyOperation::Open: return "Open";
+        case MorphologyOperation::Close: return "Close";
+        case MorphologyOperation::FillHoles: return "Fill Holes";
+        case MorphologyOperation::RemoveSmallComponents: return "Remove Small Components";
+        default: return QString();
+    }
+}
@@ -0,0 +1,83 @@
+#ifndef TRACINGMORPHOLOGY_H
+#define TRACINGMORPHOLOGY_H
+
+#include <QDebug>
+#include <QString>
+#include <vector>
+#include <cstdint>
+
+#include <opencv2/opencv.hpp>
+
+#include "displayinfo.h"
+#include "tracing.h"
+#include "connectedcomponents.h"
+
+enum class MorphologyOperation : int
+{
+    Dilate = 0,
+    Erode,
+    Open,
+    Close,
+    FillHoles,
+    RemoveSmallComponents,
+    Count
+};
+
+struct MorphologyOptions
+{
+    MorphologyOperation operation;
+
+    // The structuring element is a box of 2 * radius + 1 voxels along X and Y, and along Z if threeD is true. For filling
+    // holes and removing components, threeD selects whether they are found in 3D or on each axial slice
+    int radius;
+    bool threeD;
+
+    // Axial slices zStart to zEnd (exclusive) that are changed. Slices outside of the slab are read but not changed
+    int zStart;
+    int zEnd;
+
+    // Components with fewer voxels than this are removed
+    int minComponentSize;
+
+    MorphologyOptions() : operation(MorphologyOperation::Close), radius(1), threeD(false), zStart(0), zEnd(0),
+        minComponentSize(10) {}
+};
+
+// Runs of voxels on axial slice z that an operation sets and clears
+struct MorphologySliceSpans
+{
+    int z;
+    std::vector<TracingSpan> set;
+    std::vector<TracingSpan> cleared;
+};
+
+/* TracingMorphology cleans up a tracing layer with morphological operations over a slab of axial slices or the whole
+ * volume.
+ *
+ * Dilation and erosion are done on a bit-packed copy of the slab with one bit per voxel and 64 voxels per word. The box
+ * structuring element is separable, so each pass combines shifted copies of the rows along X, whole rows along Y and
+ * whole slices along Z with OR (dilate) or AND (erode). Outside of the volume counts as background when dilating and as
+ * traced when eroding, so erosion does not eat into the edges of the volume. Slices are processed in parallel.
+ *
+ * The result is not written to the layer. Instead, the runs of voxels that change on each slice are returned so that the
+ * change can be pushed as one undo command.
+ */
+class TracingMorphology
+{
+public:
+    // Maximum radius of the structuring element, the X pass shifts within neighboring words
+    static constexpr int maxRadius = 63;
+
+    // Returns the runs of voxels that the operation changes in the slab of layer. Slices that do not change are left out
+    static std::vector<MorphologySliceSpans> apply(TracingLayerData &layer, const MorphologyOptions &options);
+
+    // Returns the slab after the operation is applied as zEnd - zStart slices of 0 or 255
+    static cv::Mat compute(TracingLayerData &layer, const MorphologyOptions &options);
+
+    static void fillHoles(cv::Mat &slab, bool threeD);
+    static void removeSmallComponents(cv::Mat &slab, int minSize, bool threeD);
+
+    static QString operationName(MorphologyOperation op);
+};
+
+#endif // TRACINGMORPHOLOGY_H
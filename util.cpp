@@ -164,4 +164,37 @@ QString execCommand(QString cmd)
     return execCommand(cmd.toStdString().c_str());
 }
 
+bool replaceWidget(QWidget *placeholder, QWidget *widget)
+{
+    QWidget *parent = placeholder->parentWidget();
+    if (!parent || !parent->layout())
+    {
+        qWarning() << "Unable to replace widget " << placeholder->objectName() << " because it is not in a layout";
+        return false;
+    }
+
+    widget->setSizePolicy(placeholder->sizePolicy());
+    widget->setMinimumSize(placeholder->minimumSize());
+    widget->setMaximumSize(placeholder->maximumSize());
+    widget->setMouseTracking(placeholder->hasMouseTracking());
+    widget->setFocusPolicy(placeholder->focusPolicy());
+    widget->setToolTip(placeholder->toolTip());
+    widget->setWhatsThis(placeholder->whatsThis());
+
+    // The layout item is searched for recursively so the placeholder may be in a nested layout. Once replaced, the placeholder
+    // is no longer managed by the layout and can be deleted
+    QLayoutItem *item = parent->layout()->replaceWidget(placeholder, widget);
+    if (!item)
+    {
+        qWarning() << "Unable to replace widget " << placeholder->objectName() << " because it is not in a layout";
+        return false;
+    }
+
+    delete item;
+    delete placeholder;
+
+    widget->show();
+    return true;
+}
+
 }
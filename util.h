@@ -11,6 +11,8 @@
 #include <QRectF>
 #include <QOpenGLFunctions_3_3_Core>
 #include <QKeySequence>
+#include <QWidget>
+#include <QLayout>
 #include <QDebug>
 
 // Checks if there was an OpenGL error
@@ -49,6 +51,11 @@ QPoint lerp(QPoint start, QPoint end, float percent);
 QString execCommand(const char *cmd);
 QString execCommand(QString cmd);
 
+/* Puts widget in the place of placeholder within the layout of placeholder and deletes placeholder. The size policy, tooltip
+ * and other layout related properties are copied from placeholder so that widget looks the same as the one designed in the UI
+ * file. Returns false if placeholder is not in a layout */
+bool replaceWidget(QWidget *placeholder, QWidget *widget);
+
 }
 
 #endif // UTIL_H
@@ -23,6 +23,11 @@
 #include "niftimage.h"
 #include "util.h"
 #include "tracing.h"
+#include "tracingagreement.h"
+#include "labelvolume.h"
+#include "depotstatisticspanel.h"
+#include "morphologydialog.h"
+#include "layerqapanel.h"
 #include "exception.h"
 #include "subjectconfig.h"
 #include "quazip.h"
@@ -47,9 +52,13 @@ private:
     TracingData *tracingData;
 
     QUndoView *undoView;
+    DepotStatisticsPanel *depotStatisticsPanel;
+    LayerQAPanel *layerQAPanel;
     QUndoStack *undoStack;
+    TracingHistory *tracingHistory;
 
     QLabel *lblStatusLocation;
+    QLabel *lblStatusRender;
 
     // Home Tab Shortcuts
     QShortcut *upShortcut;
@@ -84,6 +93,7 @@ private:
 
     QShortcut *drawPointsModeShortcut;
     QShortcut *erasePointsModeShortcut;
+    QShortcut *liveWireModeShortcut;
 
 public:
     explicit viewAxialCoronalHiRes(QWidget *parent, NIFTImage *fatImage, NIFTImage *waterImage, SubjectConfig *subConfig, TracingData *tracingData);
@@ -92,8 +102,15 @@ public:
     MainWindow *parentMain();
 
     bool loadImage(QuaZip *zip);
+    // Performs actions when a subject is loaded, either from its file or from the subject cache
+    void subjectLoaded(QuaZip *zip);
+    // Opens the subject at index of the worklist, the tracing data of the current subject is saved first
+    bool openWorklistItem(int index);
+    // Warns in the status bar if the subject cache is over its memory budget because of subjects with unsaved tracing
+    void warnSubjectCacheOverBudget();
     void setEnableSettings(bool enable);
-    void setupDefaults();
+    // If resetLocation is false, the current location of the slice widgets is kept
+    void setupDefaults(bool resetLocation = true);
 
     void readSettings();
     void writeSettings();
@@ -113,11 +130,25 @@ private slots:
     void actionSaveAs_triggered();
 
     void actionImportTracingData_triggered();
+    void actionCompareTracingResults_triggered();
+    void actionExportLabelVolume_triggered();
+    void actionImportLabelVolume_triggered();
+
+    void actionOpenWorklist_triggered();
+    void actionNextSubject_triggered();
+    void actionPreviousSubject_triggered();
+    void worklist_saveFinished(QString path, bool success);
 
     void actionShow_History_triggered();
+    void actionShowDepotStatistics_triggered();
+    void actionMorphology_triggered();
+    void actionShowLayerQA_triggered();
+    void layerQAPanel_locationRequested(QVector4D location);
     void actionUndo_triggered();
     void actionRedo_triggered();
 
+    void actionRecordViewHistory_toggled(bool checked);
+
     void upShortcut_triggered();
     void downShortcut_triggered();
     void leftShortcut_triggered();
@@ -140,6 +171,8 @@ private slots:
     void on_contrastSlider_valueChanged(int value);
     void on_contrastSpinBox_valueChanged(int value);
 
+    void on_windowModeComboBox_currentIndexChanged(int index);
+
     void on_primColorMapComboBox_currentIndexChanged(int index);
     void on_secdColorMapComboBox_currentIndexChanged(int index);
 
@@ -174,11 +207,21 @@ private slots:
 
     void on_drawPointsBtn_toggled(bool checked);
     void on_eraserBtn_toggled(bool checked);
+    void on_liveWireBtn_toggled(bool checked);
+
+    void on_drawBrushWidthComboBox_currentIndexChanged(int index);
+    void on_drawBrushShapeComboBox_currentIndexChanged(int index);
 
     void on_eraserBrushWidthComboBox_currentIndexChanged(int index);
+    void on_eraserBrushShapeComboBox_currentIndexChanged(int index);
+
+    void on_liveWireImageComboBox_currentIndexChanged(int index);
 
     void undoStack_canUndoChanged(bool canUndo);
     void undoStack_canRedoChanged(bool canRedo);
+    void undoStack_indexChanged(int idx);
+
+    void glWidgetAxial_frameStatsUpdated();
 };
 
 #endif // VIEW_AXIALCORONALHIRES_H
@@ -8,8 +8,9 @@ viewAxialCoronalLoRes::viewAxialCoronalLoRes(QWidget *parent, NIFTImage *fatImag
     QWidget(parent),
     ui(new Ui::viewAxialCoronalLoRes),
     fatImage(fatImage), waterImage(waterImage), subConfig(subConfig), tracingData(tracingData),
-    undoView(NULL), undoStack(new QUndoStack(this)),
-    lblStatusLocation(new QLabel(this)),
+    undoView(NULL), depotStatisticsPanel(NULL), layerQAPanel(NULL), undoStack(new QUndoStack(this)),
+    tracingHistory(new TracingHistory()),
+    lblStatusLocation(new QLabel(this)), lblStatusRender(new QLabel(this)),
 
     // Home Tab Shortcuts
     upShortcut(new QShortcut(QKeySequence("up"), this)), downShortcut(new QShortcut(QKeySequence("down"), this)),
@@ -34,28 +35,65 @@ viewAxialCoronalLoRes::viewAxialCoronalLoRes(QWidget *parent, NIFTImage *fatImag
     SCATCheckBoxShortcut(new QShortcut(QKeySequence("Ctrl+5"), this)), VATCheckBoxShortcut(new QShortcut(QKeySequence("Ctrl+6"), this)),
 
     drawPointsModeShortcut(new QShortcut(QKeySequence("z"), this)),
-    erasePointsModeShortcut(new QShortcut(QKeySequence("x"), this))
+    erasePointsModeShortcut(new QShortcut(QKeySequence("x"), this)),
+    liveWireModeShortcut(new QShortcut(QKeySequence("c"), this))
 {
     this->ui->setupUi(this);
 
+    // The slice widgets are kept by the main window and moved into each new view so that the uploaded textures, the location and
+    // the zoom are kept when switching views. The first view that is created supplies the widgets
+    MainWindow *mainWindow = this->parentMain();
+    if (mainWindow->axialWidget && mainWindow->coronalWidget)
+    {
+        util::replaceWidget(this->ui->glWidgetAxial, mainWindow->axialWidget);
+        util::replaceWidget(this->ui->glWidgetCoronal, mainWindow->coronalWidget);
+        this->ui->glWidgetAxial = mainWindow->axialWidget;
+        this->ui->glWidgetCoronal = mainWindow->coronalWidget;
+    }
+    else
+    {
+        this->ui->glWidgetAxial->setup(fatImage, waterImage, tracingData);
+        this->ui->glWidgetCoronal->setup(fatImage, waterImage, tracingData);
+        readSettings();
+
+        // Edits on the axial slice are uploaded to the trace volume of the coronal widget one row at a time
+        connect(this->ui->glWidgetAxial, SIGNAL(traceRowsChanged(int, int, int)), this->ui->glWidgetCoronal, SLOT(queueTraceRows(int, int, int)));
+        connect(this->ui->glWidgetAxial, SIGNAL(tracesReset()), this->ui->glWidgetCoronal, SLOT(queueTraceVolume()));
+
+        // The coronal view only draws the layers that are visible in the axial view, the settings were read by the axial widget
+        connect(this->ui->glWidgetAxial, SIGNAL(tracingLayerVisibleChanged(int, bool)), this->ui->glWidgetCoronal, SLOT(setTracingLayerVisible(int, bool)));
+        for (int i = 0; i < (int)TracingLayer::Count; ++i)
+            this->ui->glWidgetCoronal->setTracingLayerVisible(i, this->ui->glWidgetAxial->getTracingLayerVisible((TracingLayer)i));
+
+        mainWindow->axialWidget = this->ui->glWidgetAxial;
+        mainWindow->coronalWidget = this->ui->glWidgetCoronal;
+    }
+
     connect(undoStack, SIGNAL(canUndoChanged(bool)), this, SLOT(undoStack_canUndoChanged(bool)));
     connect(undoStack, SIGNAL(canRedoChanged(bool)), this, SLOT(undoStack_canRedoChanged(bool)));
+    connect(undoStack, SIGNAL(indexChanged(int)), this, SLOT(undoStack_indexChanged(int)));
     this->ui->glWidgetAxial->setUndoStack(undoStack);
+    this->ui->glWidgetAxial->setTracingHistory(tracingHistory);
     this->ui->glWidgetCoronal->setUndoStack(undoStack);
 
-    this->ui->glWidgetAxial->setup(fatImage, waterImage, tracingData);
-    this->ui->glWidgetCoronal->setup(fatImage, waterImage);
+    // The slice widgets are smaller in this layout so the slices are drawn from a lower resolution level of detail
+    this->ui->glWidgetAxial->setLevelBias(1);
+    this->ui->glWidgetCoronal->setLevelBias(1);
 
     this->parentMain()->ui->statusBar->addPermanentWidget(this->lblStatusLocation);
     this->ui->glWidgetAxial->setLocationLabel(this->lblStatusLocation);
 
+    this->parentMain()->ui->statusBar->addPermanentWidget(this->lblStatusRender);
+    connect(this->ui->glWidgetAxial, SIGNAL(frameStatsUpdated()), this, SLOT(glWidgetAxial_frameStatsUpdated()));
+
     // Set current tab to zero in case I am on a different tab in designer.
     this->ui->settingsWidget->setCurrentIndex(0);
 
+    // If an image is loaded, the view was switched and the slice widgets already have a location so it is not reset
     if (fatImage->isLoaded() && waterImage->isLoaded())
     {
         setEnableSettings(true);
-        setupDefaults();
+        setupDefaults(false);
     }
     else
         setEnableSettings(false);
@@ -93,15 +131,29 @@ viewAxialCoronalLoRes::viewAxialCoronalLoRes(QWidget *parent, NIFTImage *fatImag
 
     connect(drawPointsModeShortcut, SIGNAL(activated()), ui->drawPointsBtn, SLOT(click()));
     connect(erasePointsModeShortcut, SIGNAL(activated()), ui->eraserBtn, SLOT(click()));
+    connect(liveWireModeShortcut, SIGNAL(activated()), ui->liveWireBtn, SLOT(click()));
 
     // Actions
     connect(parentMain()->ui->actionOpen, SIGNAL(triggered()), this, SLOT(actionOpen_triggered()));
     connect(parentMain()->ui->actionSave, SIGNAL(triggered()), this, SLOT(actionSave_triggered()));
     connect(parentMain()->ui->actionSaveAs, SIGNAL(triggered()), this, SLOT(actionSaveAs_triggered()));
     connect(parentMain()->ui->actionImportTracingData, SIGNAL(triggered()), this, SLOT(actionImportTracingData_triggered()));
+    connect(parentMain()->ui->actionCompareTracingResults, SIGNAL(triggered()), this, SLOT(actionCompareTracingResults_triggered()));
+    connect(parentMain()->ui->actionExportLabelVolume, SIGNAL(triggered()), this, SLOT(actionExportLabelVolume_triggered()));
+    connect(parentMain()->ui->actionImportLabelVolume, SIGNAL(triggered()), this, SLOT(actionImportLabelVolume_triggered()));
+    connect(parentMain()->ui->actionOpenWorklist, SIGNAL(triggered()), this, SLOT(actionOpenWorklist_triggered()));
+    connect(parentMain()->ui->actionNextSubject, SIGNAL(triggered()), this, SLOT(actionNextSubject_triggered()));
+    connect(parentMain()->ui->actionPreviousSubject, SIGNAL(triggered()), this, SLOT(actionPreviousSubject_triggered()));
+    connect(parentMain()->worklist, SIGNAL(saveFinished(QString, bool)), this, SLOT(worklist_saveFinished(QString, bool)));
     connect(parentMain()->ui->actionShow_History, SIGNAL(triggered()), this, SLOT(actionShow_History_triggered()));
+    connect(parentMain()->ui->actionShowDepotStatistics, SIGNAL(triggered()), this, SLOT(actionShowDepotStatistics_triggered()));
+    connect(parentMain()->ui->actionMorphology, SIGNAL(triggered()), this, SLOT(actionMorphology_triggered()));
+    connect(parentMain()->ui->actionShowLayerQA, SIGNAL(triggered()), this, SLOT(actionShowLayerQA_triggered()));
     connect(parentMain()->ui->actionUndo, SIGNAL(triggered()), this, SLOT(actionUndo_triggered()));
     connect(parentMain()->ui->actionRedo, SIGNAL(triggered()), this, SLOT(actionRedo_triggered()));
+    connect(parentMain()->ui->actionRecordViewHistory, SIGNAL(toggled(bool)), this, SLOT(actionRecordViewHistory_toggled(bool)));
+
+    actionRecordViewHistory_toggled(parentMain()->ui->actionRecordViewHistory->isChecked());
 }
 
 MainWindow *viewAxialCoronalLoRes::parentMain()
@@ -165,21 +217,12 @@ bool viewAxialCoronalLoRes::loadImage(QuaZip *zip)
         if (!fatImage->compatible(waterImage))
             EXCEPTION("Fat and water image are incompatible", "The fat and water image are incompatible in some way. Please check the NIFTI file format of the files and try again.");
 
-        parentMain()->setWindowTitle(QCoreApplication::applicationName() + " - " + zip->getZipName());
-
-        // The settings box is disabled to prevent moving stuff before anything is loaded
-        setEnableSettings(true);
-
         // Initialize the tracing data to be the same size as the image and all zeros (no traces)
         // Also initialize each layer of time to be the same size as Z dim (one for each slice)
         for (auto &layer : tracingData->layers)
             layer.load(fatImage->getXDim(), fatImage->getYDim(), fatImage->getZDim());
 
-        ui->glWidgetAxial->imageLoaded();
-        ui->glWidgetCoronal->imageLoaded();
-
-        // Setup the default controls in the GUI
-        setupDefaults();
+        subjectLoaded(zip);
 
         return true;
     }
@@ -206,6 +249,42 @@ bool viewAxialCoronalLoRes::loadImage(QuaZip *zip)
     return false;
 }
 
+void viewAxialCoronalLoRes::subjectLoaded(QuaZip *zip)
+{
+    parentMain()->setWindowTitle(QCoreApplication::applicationName() + " - " + zip->getZipName());
+
+    // The settings box is disabled to prevent moving stuff before anything is loaded
+    setEnableSettings(true);
+
+    // The tracing commands in the history apply to the previous subject
+    undoStack->clear();
+
+    ui->glWidgetAxial->imageLoaded();
+    ui->glWidgetCoronal->imageLoaded();
+
+    if (depotStatisticsPanel)
+        depotStatisticsPanel->tracesReset();
+
+    if (layerQAPanel)
+        layerQAPanel->refresh();
+
+    // Setup the default controls in the GUI
+    setupDefaults();
+}
+
+void viewAxialCoronalLoRes::warnSubjectCacheOverBudget()
+{
+    // Subjects with unsaved tracing are never dropped from the cache, so the memory is only freed once they are opened and saved
+    SubjectCache *subjectCache = parentMain()->subjectCache;
+    if (!subjectCache->isOverBudget())
+        return;
+
+    parentMain()->ui->statusBar->showMessage(QObject::tr("Subject cache is using %1 MB of its %2 MB budget, %3 cached subjects have unsaved tracing")
+                                             .arg(subjectCache->memoryUsage() / (1024 * 1024))
+                                             .arg(subjectCache->getMemoryBudget() / (1024 * 1024))
+                                             .arg(subjectCache->modifiedCount()), 10000);
+}
+
 void viewAxialCoronalLoRes::setEnableSettings(bool enable)
 {
     ui->settingsWidget->setEnabled(enable);
@@ -243,16 +322,27 @@ void viewAxialCoronalLoRes::setEnableSettings(bool enable)
 
     drawPointsModeShortcut->setEnabled(enable);
     erasePointsModeShortcut->setEnabled(enable);
+    liveWireModeShortcut->setEnabled(enable);
 }
 
-void viewAxialCoronalLoRes::setupDefaults()
+void viewAxialCoronalLoRes::setupDefaults(bool resetLocation)
 {
-    // The default slice that it will go to is half of the zDim
-    QVector4D defaultLocation = QVector4D(Location::NoChange, floor(fatImage->getYDim() / 2), floor(fatImage->getZDim() / 2), Location::NoChange);
+    QVector4D defaultLocation;
 
-    // In the OpenGL widget, set the default location
-    ui->glWidgetAxial->setLocation(defaultLocation);
-    ui->glWidgetCoronal->setLocation(defaultLocation);
+    if (resetLocation)
+    {
+        // The default slice that it will go to is half of the zDim
+        defaultLocation = QVector4D(Location::NoChange, floor(fatImage->getYDim() / 2), floor(fatImage->getZDim() / 2), Location::NoChange);
+
+        // In the OpenGL widget, set the default location
+        ui->glWidgetAxial->setLocation(defaultLocation);
+        ui->glWidgetCoronal->setLocation(defaultLocation);
+    }
+    else
+    {
+        // Keep the current location of the OpenGL widget, the controls are set to match it below
+        defaultLocation = ui->glWidgetAxial->getLocation();
+    }
 
     // -------------------------------------------- Setup Home Tab --------------------------------------------
     // Set the range of the slice spin box to be 0 to the height of the fatImage (this is upper + lower z-height)
@@ -292,6 +382,10 @@ void viewAxialCoronalLoRes::setupDefaults()
     // Set the contrast spin box value to the default contrast
     ui->contrastSpinBox->setValue(int(ui->glWidgetAxial->getContrast() * 100.0f));
 
+    // Set the window mode combo box to the current window mode, the coronal slice uses the same window mode
+    ui->windowModeComboBox->setCurrentIndex((int)ui->glWidgetAxial->getWindowMode());
+    ui->glWidgetCoronal->setWindowMode(ui->glWidgetAxial->getWindowMode());
+
     // Set the primary colormap value to the current color map and set the opacity
     ui->primColorMapComboBox->setCurrentIndex((int)ui->glWidgetAxial->getPrimColorMap());
     ui->primOpacitySlider->setValue(int(ui->glWidgetAxial->getPrimOpacity() * 100.0f));
@@ -340,10 +434,24 @@ void viewAxialCoronalLoRes::setupDefaults()
     {
         case DrawMode::Points: ui->drawPointsBtn->setChecked(true); break;
         case DrawMode::Erase: ui->eraserBtn->setChecked(true); break;
+        case DrawMode::LiveWire: ui->liveWireBtn->setChecked(true); break;
     }
 
     ui->drawModeStackedWidget->setCurrentIndex((int)ui->glWidgetAxial->getDrawMode());
 
+    switch (ui->glWidgetAxial->getDrawBrushWidth())
+    {
+        case 1: ui->drawBrushWidthComboBox->setCurrentIndex(0); break; // 1px
+        case 2: ui->drawBrushWidthComboBox->setCurrentIndex(1); break; // 2px
+        case 4: ui->drawBrushWidthComboBox->setCurrentIndex(2); break; // 4px
+        case 6: ui->drawBrushWidthComboBox->setCurrentIndex(3); break; // 6px
+        case 8: ui->drawBrushWidthComboBox->setCurrentIndex(4); break; // 8px
+        default:
+            qWarning() << "Unknown draw brush width combo selected: " << ui->glWidgetAxial->getDrawBrushWidth();
+    }
+
+    ui->drawBrushShapeComboBox->setCurrentIndex((int)ui->glWidgetAxial->getDrawBrushShape());
+
     switch (ui->glWidgetAxial->getEraserBrushWidth())
     {
         case 1: ui->eraserBrushWidthComboBox->setCurrentIndex(0); break; // 1px
@@ -354,6 +462,10 @@ void viewAxialCoronalLoRes::setupDefaults()
         default:
             qWarning() << "Unknown eraser brush width combo selected: " << ui->glWidgetAxial->getEraserBrushWidth();
     }
+
+    ui->eraserBrushShapeComboBox->setCurrentIndex((int)ui->glWidgetAxial->getEraserBrushShape());
+
+    ui->liveWireImageComboBox->setCurrentIndex((int)ui->glWidgetAxial->getLiveWireImage());
 }
 
 void viewAxialCoronalLoRes::actionOpen_triggered()
@@ -381,7 +493,43 @@ void viewAxialCoronalLoRes::actionOpen_triggered()
         return;
     }
 
-    if (loadImage(imageZip))
+    // A subject that was opened before is moved out of the subject cache instead of being loaded again and the current
+    // subject is moved into the cache in its place. Opening the current subject again loads it from the file
+    QString currentFilename = parentMain()->imageZip ? parentMain()->imageZip->getZipName() : QString();
+    bool reopen = !currentFilename.isNull() && QFileInfo(currentFilename) == fileInfo;
+
+    // The undo history is cleared when a subject is loaded, so whether the tracing has unsaved changes is kept in the cache
+    const bool currentModified = !undoStack->isClean();
+    bool modified = false;
+
+    bool loaded = false;
+    if (!reopen && parentMain()->subjectCache->take(filename, currentFilename, fatImage, waterImage, subConfig, tracingData,
+                                                    &parentMain()->tracingResultsZip, currentModified, &modified))
+    {
+        subjectLoaded(imageZip);
+        loaded = true;
+
+        // A clean stack means the tracing is saved, so the stack is left unclean until the tracing is saved again
+        if (modified)
+            undoStack->resetClean();
+    }
+    else if (!reopen && parentMain()->imageZip)
+    {
+        parentMain()->subjectCache->insert(currentFilename, fatImage, waterImage, subConfig, tracingData,
+                                           &parentMain()->tracingResultsZip, currentModified);
+        loaded = loadImage(imageZip);
+
+        // Move the previous subject back if the new subject could not be loaded, the widgets still display it
+        if (!loaded)
+            parentMain()->subjectCache->take(currentFilename, QString(), fatImage, waterImage, subConfig, tracingData,
+                                             &parentMain()->tracingResultsZip);
+    }
+    else
+    {
+        loaded = loadImage(imageZip);
+    }
+
+    if (loaded)
     {
         // Since the NIFTI files were successfully opened, the default path in the FileChooser dialog next time will be this path
         parentMain()->defaultOpenPath = fileInfo.absolutePath();
@@ -393,6 +541,10 @@ void viewAxialCoronalLoRes::actionOpen_triggered()
 
         parentMain()->imageZip = imageZip;
         parentMain()->ui->statusBar->showMessage(QObject::tr("Successfully loaded file in %1").arg(imageZip->getZipName()), 4000);
+        warnSubjectCacheOverBudget();
+
+        // The subject is not part of the worklist, so its tracing is not saved to a worklist file when moving on
+        parentMain()->worklist->setIndex(-1);
 
         imageZip->close();
     }
@@ -461,6 +613,10 @@ void viewAxialCoronalLoRes::actionSaveAs_triggered()
         parentMain()->tracingResultsZip = tracingResultsZip;
         parentMain()->ui->statusBar->showMessage(QObject::tr("Successfully saved file at %1").arg(tracingResultsZip->getZipName()), 4000);
 
+        // The components are checked again after each save so that stray islands are noticed
+        if (layerQAPanel)
+            layerQAPanel->refresh();
+
         tracingResultsZip->close();
     }
     else
@@ -514,14 +670,281 @@ void viewAxialCoronalLoRes::actionImportTracingData_triggered()
         delete tracingResultsZip;
 }
 
+void viewAxialCoronalLoRes::actionCompareTracingResults_triggered()
+{
+    if (!fatImage->isLoaded())
+    {
+        qWarning() << "Tracing results can only be compared once the subject image they were traced on is loaded.";
+        return;
+    }
+
+    // If only one file is selected, it is compared against the tracing data that is loaded
+    QStringList filenames = QFileDialog::getOpenFileNames(this, "Compare Tracing Results", parentMain()->defaultSavePath, "Tracing Results (*.sdt)");
+    if (filenames.isEmpty())
+        return; // If they hit cancel, do nothing
+
+    const nifti_image *image = fatImage->getUpperImage();
+    TracingAgreement agreement(fatImage->getXDim(), fatImage->getYDim(), fatImage->getZDim(), image->dx, image->dy, image->dz);
+
+    if (filenames.size() == 1 && !agreement.addResults("Current", *tracingData))
+        return;
+
+    for (const QString &filename : filenames)
+    {
+        if (!agreement.addResults(QFileInfo(filename).completeBaseName(), filename))
+            return;
+    }
+
+    QString tableFilename = QFileDialog::getSaveFileName(this, "Save Agreement Table", parentMain()->defaultSavePath, "Comma-Separated Values (*.csv)");
+    if (tableFilename.isNull())
+        return;
+
+    QFile file(tableFilename);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text))
+    {
+        qWarning() << "Unable to open agreement table file: " << tableFilename;
+        return;
+    }
+
+    QTextStream stream(&file);
+    agreement.writeTable(stream, agreement.compute());
+
+    parentMain()->ui->statusBar->showMessage(QObject::tr("Successfully saved agreement table at %1").arg(tableFilename), 4000);
+}
+
+void viewAxialCoronalLoRes::actionExportLabelVolume_triggered()
+{
+    if (!fatImage->isLoaded())
+    {
+        qWarning() << "Tracing data can only be exported once a subject image is loaded.";
+        return;
+    }
+
+    const QString labelsFilter = "Multi-Label Volume (*.nii.gz *.nii)";
+    const QString layersFilter = "One Volume per Layer (*.nii.gz *.nii)";
+
+    QString selectedFilter = labelsFilter;
+    QString filename = QFileDialog::getSaveFileName(this, "Export Label Volume", parentMain()->defaultSavePath,
+                                                    labelsFilter + ";;" + layersFilter, &selectedFilter);
+    if (filename.isNull())
+        return; // If they hit cancel, do nothing
+
+    if (!filename.endsWith(".nii", Qt::CaseInsensitive) && !filename.endsWith(".nii.gz", Qt::CaseInsensitive))
+        filename += ".nii.gz";
+
+    bool success;
+    if (selectedFilter == layersFilter)
+        success = LabelVolume::exportLayers(filename, *tracingData, fatImage);
+    else
+        success = LabelVolume::exportLabels(filename, *tracingData, fatImage);
+
+    if (success)
+        parentMain()->ui->statusBar->showMessage(QObject::tr("Successfully exported tracing data at %1").arg(filename), 4000);
+    else
+        qWarning() << "Unable to export tracing data in path: " << filename;
+}
+
+void viewAxialCoronalLoRes::actionImportLabelVolume_triggered()
+{
+    if (!fatImage->isLoaded())
+    {
+        qWarning() << "Tracing data cannot be imported until the correct NIFTI image is loaded first.";
+        return;
+    }
+
+    // Several layer volumes can be selected to import each of them into its layer
+    QStringList filenames = QFileDialog::getOpenFileNames(this, "Import Label Volume", parentMain()->defaultSavePath, "NIFTI Label Volume (*.nii.gz *.nii)");
+    if (filenames.isEmpty())
+        return; // If they hit cancel, do nothing
+
+    if (!ui->glWidgetAxial->confirmReplaceTracingData())
+        return;
+
+    int imported = 0;
+    for (const QString &filename : filenames)
+    {
+        if (LabelVolume::importVolume(filename, *tracingData))
+            ++imported;
+    }
+
+    if (imported == 0)
+        return;
+
+    ui->glWidgetAxial->tracingDataReplaced();
+    parentMain()->ui->statusBar->showMessage(QObject::tr("Successfully imported %1 of %2 label volumes").arg(imported).arg(filenames.size()), 4000);
+}
+
+bool viewAxialCoronalLoRes::openWorklistItem(int index)
+{
+    Worklist *worklist = parentMain()->worklist;
+    if (index < 0 || index >= worklist->count())
+        return false;
+
+    const WorklistItem item = worklist->at(index);
+    const int currentIndex = worklist->getIndex();
+
+    // The tracing data of the subject that is left is saved on a worker thread while the next subject is shown
+    if (currentIndex >= 0 && fatImage->isLoaded())
+    {
+        worklist->saveAsync(worklist->at(currentIndex).tracingPath, tracingData);
+    }
+
+    QString currentFilename = parentMain()->imageZip ? parentMain()->imageZip->getZipName() : QString();
+
+    // The tracing of a worklist subject was just saved, other subjects keep whether their tracing has unsaved changes in
+    // the cache since the undo history is cleared
+    const bool currentModified = (currentIndex < 0) && !undoStack->isClean();
+    bool modified = false;
+
+    // A subject that was opened before is taken from the subject cache since it has the tracing that has not been saved
+    // yet. Otherwise the subject that was prefetched is used or the subject is prepared now if it was not prefetched
+    if (!parentMain()->subjectCache->take(item.imagePath, currentFilename, fatImage, waterImage, subConfig, tracingData,
+                                          &parentMain()->tracingResultsZip, currentModified, &modified))
+    {
+        std::shared_ptr<PreparedSubject> subject = worklist->takePrepared(index);
+        if (!subject)
+        {
+            // The tracing results file may be the one that is being saved
+            worklist->waitForSaves();
+            subject = Worklist::prepare(item);
+        }
+
+        if (!subject->loaded)
+        {
+            qWarning() << "Unable to open subject " << (index + 1) << " of the worklist: " << item.imagePath;
+            return false;
+        }
+
+        if (parentMain()->imageZip)
+        {
+            parentMain()->subjectCache->insert(currentFilename, fatImage, waterImage, subConfig, tracingData,
+                                               &parentMain()->tracingResultsZip, currentModified);
+        }
+
+        fatImage->swap(subject->fatImage);
+        waterImage->swap(subject->waterImage);
+        std::swap(*subConfig, subject->subConfig);
+        std::swap(*tracingData, subject->tracingData);
+    }
+
+    // The tracing results of the subject are saved to the file given in the worklist
+    if (parentMain()->tracingResultsZip)
+        delete parentMain()->tracingResultsZip;
+
+    parentMain()->tracingResultsZip = new QuaZip(item.tracingPath);
+
+    if (parentMain()->imageZip)
+        delete parentMain()->imageZip;
+
+    parentMain()->imageZip = new QuaZip(item.imagePath);
+
+    worklist->setIndex(index);
+    subjectLoaded(parentMain()->imageZip);
+
+    if (modified)
+        undoStack->resetClean();
+
+    parentMain()->ui->statusBar->showMessage(QObject::tr("Opened subject %1 of %2 in %3").arg(index + 1).arg(worklist->count()).arg(item.imagePath), 4000);
+    warnSubjectCacheOverBudget();
+
+    // Start preparing the subject after this one while this one is traced
+    worklist->prefetch(index + 1);
+
+    return true;
+}
+
+void viewAxialCoronalLoRes::actionOpenWorklist_triggered()
+{
+    // Start dialog to select location to load the worklist
+    QString filename = QFileDialog::getOpenFileName(this, "Open Worklist", parentMain()->defaultOpenPath, "Worklist (*.txt *.tsv)");
+    if (filename.isNull())
+        return; // If they hit cancel, do nothing
+
+    Worklist *worklist = parentMain()->worklist;
+    if (!worklist->load(filename))
+        return;
+
+    parentMain()->defaultOpenPath = QFileInfo(filename).absolutePath();
+
+    openWorklistItem(0);
+}
+
+void viewAxialCoronalLoRes::actionNextSubject_triggered()
+{
+    Worklist *worklist = parentMain()->worklist;
+    if (worklist->count() == 0)
+    {
+        parentMain()->ui->statusBar->showMessage(QObject::tr("No worklist is open"), 4000);
+        return;
+    }
+
+    if (worklist->getIndex() + 1 >= worklist->count())
+    {
+        parentMain()->ui->statusBar->showMessage(QObject::tr("Last subject of the worklist is open"), 4000);
+        return;
+    }
+
+    openWorklistItem(worklist->getIndex() + 1);
+}
+
+void viewAxialCoronalLoRes::actionPreviousSubject_triggered()
+{
+    Worklist *worklist = parentMain()->worklist;
+    if (worklist->count() == 0)
+    {
+        parentMain()->ui->statusBar->showMessage(QObject::tr("No worklist is open"), 4000);
+        return;
+    }
+
+    if (worklist->getIndex() <= 0)
+    {
+        parentMain()->ui->statusBar->showMessage(QObject::tr("First subject of the worklist is open"), 4000);
+        return;
+    }
+
+    openWorklistItem(worklist->getIndex() - 1);
+}
+
+void viewAxialCoronalLoRes::worklist_saveFinished(QString path, bool success)
+{
+    if (success)
+        parentMain()->ui->statusBar->showMessage(QObject::tr("Successfully saved file at %1").arg(path), 4000);
+    else
+        qWarning() << "Unable to save the tracing results of the worklist subject at " << path;
+}
+
 void viewAxialCoronalLoRes::actionUndo_triggered()
 {
+    // Push any zoom gesture that is waiting on its timer so that it is the command being undone
+    ui->glWidgetAxial->finishZoomGesture();
+    ui->glWidgetCoronal->finishZoomGesture();
+
+    // Expired tracing commands are deleted by the undo stack when they are reached. They are skipped here so that one undo always
+    // changes something
+    bool dropped = false;
+    while (undoStack->canUndo() && undoStack->command(undoStack->index() - 1)->isObsolete())
+    {
+        undoStack->undo();
+        dropped = true;
+    }
+
+    if (!undoStack->canUndo())
+    {
+        if (dropped)
+            parentMain()->ui->statusBar->showMessage(QObject::tr("Older tracing history was dropped to stay within the undo memory budget"), 4000);
+        return;
+    }
+
     parentMain()->ui->statusBar->showMessage(QObject::tr("Undid \"%1\"").arg(undoStack->undoText()), 4000);
     undoStack->undo();
 }
 
 void viewAxialCoronalLoRes::actionRedo_triggered()
 {
+    // A zoom gesture that is pushed after this would remove the redo history, so it is pushed first
+    ui->glWidgetAxial->finishZoomGesture();
+    ui->glWidgetCoronal->finishZoomGesture();
+
     parentMain()->ui->statusBar->showMessage(QObject::tr("Redid \"%1\"").arg(undoStack->redoText()), 4000);
     undoStack->redo();
 }
@@ -542,13 +965,92 @@ void viewAxialCoronalLoRes::actionShow_History_triggered()
         undoView = new QUndoView(undoStack, this);
         undoView->setWindowFlags(Qt::Tool);
 
-        undoView->setWindowTitle(tr("History"));
+        undoStack_indexChanged(undoStack->index());
         undoView->setWindowModality(Qt::NonModal);
         undoView->show();
         undoView->setAttribute(Qt::WA_QuitOnClose, false);
     }
 }
 
+void viewAxialCoronalLoRes::actionShowDepotStatistics_triggered()
+{
+    if (!depotStatisticsPanel)
+    {
+        depotStatisticsPanel = new DepotStatisticsPanel(this);
+        depotStatisticsPanel->setWindowFlags(Qt::Tool);
+        depotStatisticsPanel->setAttribute(Qt::WA_QuitOnClose, false);
+        depotStatisticsPanel->setup(fatImage, waterImage, tracingData);
+        depotStatisticsPanel->setSlice((int)ui->glWidgetAxial->getLocation().z());
+
+        // The statistics of the slices are updated as they are edited and the slice columns follow the axial slice
+        connect(ui->glWidgetAxial, SIGNAL(traceRowsChanged(int, int, int)), depotStatisticsPanel, SLOT(traceRowsChanged(int, int, int)));
+        connect(ui->glWidgetAxial, SIGNAL(tracesReset()), depotStatisticsPanel, SLOT(tracesReset()));
+        connect(ui->glWidgetAxial, SIGNAL(axialSliceChanged(int)), depotStatisticsPanel, SLOT(setSlice(int)));
+    }
+
+    depotStatisticsPanel->show();
+    depotStatisticsPanel->raise();
+}
+
+void viewAxialCoronalLoRes::actionMorphology_triggered()
+{
+    if (!fatImage->isLoaded())
+        return;
+
+    MorphologyDialog dialog(fatImage->getZDim(), ui->axialSliceSpinBox->value(), this);
+    if (dialog.exec() != QDialog::Accepted)
+        return;
+
+    const MorphologyOptions options = dialog.getOptions();
+    const TracingLayer layer = ui->glWidgetAxial->getTracingLayer();
+
+    std::vector<MorphologySliceSpans> changes = TracingMorphology::apply(ui->glWidgetAxial->getTraceSlices(layer), options);
+    if (changes.empty())
+    {
+        parentMain()->ui->statusBar->showMessage(QObject::tr("%1 did not change the layer").arg(TracingMorphology::operationName(options.operation)), 4000);
+        return;
+    }
+
+    // The whole operation is one command, the change is applied when it is pushed
+    undoStack->push(new TracingMorphologyCommand(ui->glWidgetAxial, layer, options.operation, changes));
+    tracingHistory->enforceMemoryBudget();
+}
+
+void viewAxialCoronalLoRes::actionShowLayerQA_triggered()
+{
+    if (!layerQAPanel)
+    {
+        layerQAPanel = new LayerQAPanel(this);
+        layerQAPanel->setWindowFlags(Qt::Tool);
+        layerQAPanel->setAttribute(Qt::WA_QuitOnClose, false);
+        layerQAPanel->setup(fatImage, tracingData);
+
+        connect(ui->glWidgetAxial, SIGNAL(tracesReset()), layerQAPanel, SLOT(refresh()));
+        connect(layerQAPanel, SIGNAL(locationRequested(QVector4D)), this, SLOT(layerQAPanel_locationRequested(QVector4D)));
+    }
+
+    layerQAPanel->setLayer(ui->glWidgetAxial->getTracingLayer());
+    layerQAPanel->show();
+    layerQAPanel->raise();
+}
+
+void viewAxialCoronalLoRes::layerQAPanel_locationRequested(QVector4D location)
+{
+    if (!fatImage->isLoaded())
+        return;
+
+    // Moving to a component is added to the history like any other change of location
+    undoStack->push(new LocationChangeCommand(location, ui->glWidgetAxial, ui->glWidgetCoronal,
+                                              ui->axialSliceSlider, ui->axialSliceSpinBox, ui->coronalSliceSlider,
+                                              ui->coronalSliceSpinBox, ui->saggitalSliceSlider, ui->saggitalSliceSpinBox));
+}
+
+void viewAxialCoronalLoRes::actionRecordViewHistory_toggled(bool checked)
+{
+    ui->glWidgetAxial->setRecordViewHistory(checked);
+    ui->glWidgetCoronal->setRecordViewHistory(checked);
+}
+
 void viewAxialCoronalLoRes::upShortcut_triggered()
 {
     const int value = ui->glWidgetAxial->getLocation().y() + 1;
@@ -719,6 +1221,12 @@ void viewAxialCoronalLoRes::on_contrastSpinBox_valueChanged(int value)
     undoStack->push(new ContrastChangeCommand(value / 100.0f, ui->glWidgetAxial, ui->contrastSlider, ui->contrastSpinBox));
 }
 
+void viewAxialCoronalLoRes::on_windowModeComboBox_currentIndexChanged(int index)
+{
+    ui->glWidgetAxial->setWindowMode((WindowMode)index);
+    ui->glWidgetCoronal->setWindowMode((WindowMode)index);
+}
+
 void viewAxialCoronalLoRes::on_primColorMapComboBox_currentIndexChanged(int index)
 {
     // If the index is out of the acceptable bounds for the ColorMap, then do nothing
@@ -851,7 +1359,19 @@ void viewAxialCoronalLoRes::on_waterFatRadioBtn_toggled(bool checked)
 
 void viewAxialCoronalLoRes::on_resetViewBtn_clicked()
 {
-    undoStack->push(new ResetViewCommand(ui->glWidgetAxial, ui->glWidgetCoronal));
+    // Finish any zoom gesture first so that it is recorded before the reset
+    ui->glWidgetAxial->finishZoomGesture();
+    ui->glWidgetCoronal->finishZoomGesture();
+
+    if (parentMain()->ui->actionRecordViewHistory->isChecked())
+    {
+        undoStack->push(new ResetViewCommand(ui->glWidgetAxial, ui->glWidgetCoronal));
+    }
+    else
+    {
+        ui->glWidgetAxial->resetView();
+        ui->glWidgetCoronal->resetView();
+    }
 }
 
 void viewAxialCoronalLoRes::changeTracingLayer(TracingLayer newLayer)
@@ -968,6 +1488,7 @@ void viewAxialCoronalLoRes::changeDrawMode(DrawMode newMode)
     {
         case DrawMode::Points: newBtn = ui->drawPointsBtn; newModeStr = "Draw Points"; break;
         case DrawMode::Erase: newBtn = ui->eraserBtn; newModeStr = "Erase"; break;
+        case DrawMode::LiveWire: newBtn = ui->liveWireBtn; newModeStr = "Live Wire"; break;
     }
 
     QPushButton *oldBtn = NULL;
@@ -975,6 +1496,7 @@ void viewAxialCoronalLoRes::changeDrawMode(DrawMode newMode)
     {
         case DrawMode::Points: oldBtn = ui->drawPointsBtn; break;
         case DrawMode::Erase: oldBtn = ui->eraserBtn; break;
+        case DrawMode::LiveWire: oldBtn = ui->liveWireBtn; break;
     }
 
     parentMain()->ui->statusBar->showMessage(QObject::tr("Change draw mode to %1").arg(newModeStr), 4000);
@@ -993,6 +1515,30 @@ void viewAxialCoronalLoRes::on_eraserBtn_toggled(bool checked)
         changeDrawMode(DrawMode::Erase);
 }
 
+void viewAxialCoronalLoRes::on_liveWireBtn_toggled(bool checked)
+{
+    if (checked)
+        changeDrawMode(DrawMode::LiveWire);
+}
+
+void viewAxialCoronalLoRes::on_drawBrushWidthComboBox_currentIndexChanged(int index)
+{
+    switch (index)
+    {
+        case 0: ui->glWidgetAxial->setDrawBrushWidth(1); break; // 1px
+        case 1: ui->glWidgetAxial->setDrawBrushWidth(2); break; // 2px
+        case 2: ui->glWidgetAxial->setDrawBrushWidth(4); break; // 4px
+        case 3: ui->glWidgetAxial->setDrawBrushWidth(6); break; // 6px
+        case 4: ui->glWidgetAxial->setDrawBrushWidth(8); break; // 8px
+        default: break;
+    }
+}
+
+void viewAxialCoronalLoRes::on_drawBrushShapeComboBox_currentIndexChanged(int index)
+{
+    ui->glWidgetAxial->setDrawBrushShape((BrushShape)index);
+}
+
 void viewAxialCoronalLoRes::on_eraserBrushWidthComboBox_currentIndexChanged(int index)
 {
     switch (index)
@@ -1006,6 +1552,16 @@ void viewAxialCoronalLoRes::on_eraserBrushWidthComboBox_currentIndexChanged(int
     }
 }
 
+void viewAxialCoronalLoRes::on_eraserBrushShapeComboBox_currentIndexChanged(int index)
+{
+    ui->glWidgetAxial->setEraserBrushShape((BrushShape)index);
+}
+
+void viewAxialCoronalLoRes::on_liveWireImageComboBox_currentIndexChanged(int index)
+{
+    ui->glWidgetAxial->setLiveWireImage((LiveWireImage)index);
+}
+
 void viewAxialCoronalLoRes::undoStack_canUndoChanged(bool canUndo)
 {
     parentMain()->ui->actionUndo->setEnabled(canUndo);
@@ -1016,6 +1572,33 @@ void viewAxialCoronalLoRes::undoStack_canRedoChanged(bool canRedo)
     parentMain()->ui->actionRedo->setEnabled(canRedo);
 }
 
+void viewAxialCoronalLoRes::undoStack_indexChanged(int idx)
+{
+    // Parameter not used
+    (void)idx;
+
+    // Show how much memory the tracing undo records are using in the title of the history window
+    if (undoView)
+    {
+        const double megabytes = tracingHistory->totalMemoryUsage() / (1024.0 * 1024.0);
+        undoView->setWindowTitle(tr("History (Tracing Undo Memory: %1 MB)").arg(megabytes, 0, 'f', 1));
+    }
+}
+
+void viewAxialCoronalLoRes::glWidgetAxial_frameStatsUpdated()
+{
+    // Show the frame rate of the axial view and the slice buffers of both views. Once an image is loaded, the buffers should only
+    // be reused and the number allocated should stay the same
+    const SliceBufferPool &axialPool = ui->glWidgetAxial->getBufferPool();
+    const SliceBufferPool &coronalPool = ui->glWidgetCoronal->getBufferPool();
+
+    lblStatusRender->setText(tr("%1 FPS | Slice buffers: %2 allocated (%3 MB), %4 reused")
+                             .arg(ui->glWidgetAxial->getFPS(), 0, 'f', 1)
+                             .arg((qulonglong)(axialPool.getAllocationCount() + coronalPool.getAllocationCount()))
+                             .arg((axialPool.getAllocatedBytes() + coronalPool.getAllocatedBytes()) / (1024.0 * 1024.0), 0, 'f', 1)
+                             .arg((qulonglong)(axialPool.getReuseCount() + coronalPool.getReuseCount())));
+}
+
 viewAxialCoronalLoRes::~viewAxialCoronalLoRes()
 {
     // Save current window settings for next time
@@ -1025,16 +1608,28 @@ viewAxialCoronalLoRes::~viewAxialCoronalLoRes()
     // Note: If the user exits the application, then the ui will be nullptr for parent and so
     // we need to not try and remove the widget
     if (parentMain()->ui)
+    {
         parentMain()->ui->statusBar->removeWidget(lblStatusLocation);
+        parentMain()->ui->statusBar->removeWidget(lblStatusRender);
+    }
 
     if (undoView)
         delete undoView;
 
+    if (depotStatisticsPanel)
+        delete depotStatisticsPanel;
+
+    if (layerQAPanel)
+        delete layerQAPanel;
+
     // Block signals in undoStack b/c on destruction, undo/redo changed is emitted
     // and this causes an attempt to enable/disable the QAction which causes seg fault
     undoStack->blockSignals(true);
     delete undoStack;
 
+    // The tracing commands remove themselves from the history when the undo stack deletes them
+    delete tracingHistory;
+
     // Home Tab Shortcuts
     delete upShortcut;
     delete downShortcut;
@@ -1068,6 +1663,7 @@ viewAxialCoronalLoRes::~viewAxialCoronalLoRes()
 
     delete drawPointsModeShortcut;
     delete erasePointsModeShortcut;
+    delete liveWireModeShortcut;
 
     delete ui;
 }
@@ -0,0 +1,309 @@
+#include "worklist.h"
+
+Worklist::Worklist(QObject *parent) : QObject(parent), filename(), items(), index(-1), threadPool(), prefetchIndex(-1),
+    prefetchFuture(), saveWatchers()
+{
+    // One thread prepares the next subject while the other saves the subject that was left
+    threadPool.setMaxThreadCount(2);
+}
+
+/* load reads the subjects of the worklist file at filename, see the Worklist class for the format of the file. The
+ * previous subjects are replaced and no subject of the worklist is loaded in the window afterwards.
+ *
+ * Returns:
+ *      true - No error occurred and at least one subject was read
+ *      false - The file could not be read or it has no subjects
+ */
+bool Worklist::load(QString filename)
+{
+    QFile file(filename);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
+    {
+        qWarning() << "Unable to open worklist file: " << filename;
+        return false;
+    }
+
+    QDir dir = QFileInfo(filename).absoluteDir();
+    std::vector<WorklistItem> newItems;
+
+    QTextStream stream(&file);
+    while (!stream.atEnd())
+    {
+        QString line = stream.readLine().trimmed();
+        if (line.isEmpty() || line.startsWith('#'))
+            continue;
+
+        QStringList columns = line.split('\t', QString::SkipEmptyParts);
+
+        WorklistItem item;
+        item.imagePath = QDir::cleanPath(dir.absoluteFilePath(columns[0].trimmed()));
+
+        if (columns.size() > 1)
+        {
+            item.tracingPath = QDir::cleanPath(dir.absoluteFilePath(columns[1].trimmed()));
+        }
+        else
+        {
+            QFileInfo imageInfo(item.imagePath);
+            item.tracingPath = imageInfo.absoluteDir().filePath(imageInfo.completeBaseName() + ".sdt");
+        }
+
+        newItems.push_back(item);
+    }
+
+    if (newItems.empty())
+    {
+        qWarning() << "Worklist file does not contain any subjects: " << filename;
+        return false;
+    }
+
+    clear();
+    this->filename = filename;
+    items = std::move(newItems);
+
+    return true;
+}
+
+void Worklist::clear()
+{
+    // A subject that is still being prepared is dropped once it is finished
+    prefetchFuture = QFuture<std::shared_ptr<PreparedSubject>>();
+    prefetchIndex = -1;
+
+    filename.clear();
+    items.clear();
+    index = -1;
+}
+
+QString Worklist::getFilename() const
+{
+    return filename;
+}
+
+int Worklist::count() const
+{
+    return (int)items.size();
+}
+
+const WorklistItem &Worklist::at(int index) const
+{
+    return items[index];
+}
+
+int Worklist::getIndex() const
+{
+    return index;
+}
+
+void Worklist::setIndex(int index)
+{
+    this->index = index;
+}
+
+void Worklist::prefetch(int index)
+{
+    if (index < 0 || index >= count() || index == prefetchIndex)
+        return;
+
+    // The tracing results file may still be written by a save, the job reads it once the save is finished
+    QList<QFuture<bool>> saves;
+    for (auto watcher : saveWatchers)
+        if (watcher->property("path").toString() == items[index].tracingPath)
+            saves.append(watcher->future());
+
+    prefetchIndex = index;
+    prefetchFuture = QtConcurrent::run(&threadPool, [saves](WorklistItem item)
+    {
+        for (QFuture<bool> save : saves)
+            save.waitForFinished();
+
+        // Preparing the next subject should not slow down the subject that is being traced. The thread is reused for
+        // saving afterwards, so its priority is restored
+        QThread *thread = QThread::currentThread();
+        const QThread::Priority priority = thread->priority();
+        thread->setPriority(QThread::LowestPriority);
+
+        std::shared_ptr<PreparedSubject> subject = prepare(item);
+
+        thread->setPriority((priority == QThread::InheritPriority) ? QThread::NormalPriority : priority);
+        return subject;
+    }, items[index]);
+}
+
+std::shared_ptr<PreparedSubject> Worklist::takePrepared(int index)
+{
+    if (index != prefetchIndex || prefetchFuture.isCanceled())
+        return nullptr;
+
+    prefetchFuture.waitForFinished();
+    std::shared_ptr<PreparedSubject> subject = prefetchFuture.result();
+
+    // The result store of the future holds a reference to the subject until it is reset
+    prefetchFuture = QFuture<std::shared_ptr<PreparedSubject>>();
+    prefetchIndex = -1;
+
+    return subject;
+}
+
+/* saveAsync saves the tracing data to path on a worker thread. The layers are copied first so the tracing data can be
+ * changed or released as soon as this returns.
+ */
+void Worklist::saveAsync(QString path, TracingData *tracingData)
+{
+    // A subject that was prefetched from this file has the tracing from before this save, so it is dropped
+    if (prefetchIndex >= 0 && items[prefetchIndex].tracingPath == path)
+    {
+        prefetchFuture = QFuture<std::shared_ptr<PreparedSubject>>();
+        prefetchIndex = -1;
+    }
+
+    TracingData copy;
+    for (int i = 0; i < (int)TracingLayer::Count; ++i)
+    {
+        copy[i].data = (*tracingData)[i].data.clone();
+        copy[i].time = (*tracingData)[i].time;
+    }
+
+    QFutureWatcher<bool> *watcher = new QFutureWatcher<bool>(this);
+    watcher->setProperty("path", path);
+    connect(watcher, SIGNAL(finished()), this, SLOT(saveWatcher_finished()));
+
+    watcher->setFuture(QtConcurrent::run(&threadPool, &Worklist::save, path, copy));
+    saveWatchers.push_back(watcher);
+}
+
+void Worklist::saveWatcher_finished()
+{
+    QFutureWatcher<bool> *watcher = static_cast<QFutureWatcher<bool> *>(sender());
+    saveWatchers.erase(std::remove(std::begin(saveWatchers), std::end(saveWatchers), watcher), std::end(saveWatchers));
+
+    emit saveFinished(watcher->property("path").toString(), watcher->result());
+    watcher->deleteLater();
+}
+
+void Worklist::waitForSaves()
+{
+    for (auto watcher : saveWatchers)
+        watcher->waitForFinished();
+}
+
+/* prepare reads the subject image of item and stitches the fat and water images. The tracing data is loaded from the
+ * tracing results file if it exists, otherwise the layers are left empty. This is run on a worker thread of the worklist
+ * when prefetching but it can be called on any thread.
+ *
+ * Returns:
+ *      std::shared_ptr<PreparedSubject> - Prepared subject, the loaded field is false if an error occurred
+ */
+std::shared_ptr<PreparedSubject> Worklist::prepare(WorklistItem item)
+{
+    std::shared_ptr<PreparedSubject> subject = std::make_shared<PreparedSubject>();
+    subject->imagePath = item.imagePath;
+
+    QuaZip zip(item.imagePath);
+    if (!zip.open(QuaZip::mdUnzip))
+    {
+        qWarning() << "Unable to open SDI file at " << item.imagePath << ": " << zip.getZipError();
+        return subject;
+    }
+
+    nifti_image *fatUpperImage = nifti_image_read_qt(&zip, "fatUpper.nii");
+    nifti_image *fatLowerImage = nifti_image_read_qt(&zip, "fatLower.nii");
+    nifti_image *waterUpperImage = nifti_image_read_qt(&zip, "waterUpper.nii");
+    nifti_image *waterLowerImage = nifti_image_read_qt(&zip, "waterLower.nii");
+
+    if (!fatUpperImage || !fatLowerImage || !waterUpperImage || !waterLowerImage)
+    {
+        qWarning() << "Unable to load SDI image, one of the NIFTI images is missing: " << item.imagePath;
+        if (fatUpperImage) nifti_image_free(fatUpperImage);
+        if (fatLowerImage) nifti_image_free(fatLowerImage);
+        if (waterUpperImage) nifti_image_free(waterUpperImage);
+        if (waterLowerImage) nifti_image_free(waterLowerImage);
+        return subject;
+    }
+
+    QuaZipFile configFile(&zip);
+    if (!zip.setCurrentFile("config.xml") || !configFile.open(QIODevice::ReadOnly) || !subject->subConfig.load(&configFile))
+    {
+        qWarning() << "Unable to load SDI image, the config file is missing or invalid: " << item.imagePath;
+        nifti_image_free(fatUpperImage);
+        nifti_image_free(fatLowerImage);
+        nifti_image_free(waterUpperImage);
+        nifti_image_free(waterLowerImage);
+        return subject;
+    }
+    configFile.close();
+    zip.close();
+
+    // The images take ownership of the NIFTI images once they are given to them
+    bool fatSet = subject->fatImage.setImage(fatUpperImage, fatLowerImage, &subject->subConfig);
+    bool waterSet = subject->waterImage.setImage(waterUpperImage, waterLowerImage, &subject->subConfig);
+
+    if (!fatSet || !waterSet || !subject->fatImage.compatible(&subject->waterImage))
+    {
+        qWarning() << "Unable to merge the upper and lower images or the fat and water images are incompatible: " << item.imagePath;
+        return subject;
+    }
+
+    for (auto &layer : subject->tracingData.layers)
+        layer.load(subject->fatImage.getXDim(), subject->fatImage.getYDim(), subject->fatImage.getZDim());
+
+    if (QFileInfo::exists(item.tracingPath))
+    {
+        QuaZip tracingZip(item.tracingPath);
+        if (!tracingZip.open(QuaZip::mdUnzip) || !subject->tracingData.load(&tracingZip))
+        {
+            qWarning() << "Unable to load tracing results, the subject is opened without tracing data: " << item.tracingPath;
+            for (auto &layer : subject->tracingData.layers)
+                layer.data.setTo(0);
+        }
+    }
+
+    subject->loaded = true;
+    return subject;
+}
+
+/* save writes the tracing data to a new tracing results file at path, replacing the file if it exists. The file is written
+ * to a temporary file next to it first, which then replaces the file. A failed save leaves the previous file intact and
+ * the file is never seen partially written.
+ *
+ * Returns:
+ *      true - No error occurred and the file was written
+ *      false - The file could not be created or replaced
+ */
+bool Worklist::save(QString path, TracingData tracingData)
+{
+    const QString tempPath = path + ".tmp";
+
+    QuaZip zip(tempPath);
+    if (!zip.open(QuaZip::mdCreate))
+    {
+        qWarning() << "Unable to create SDT file at " << tempPath << ": " << zip.getZipError();
+        return false;
+    }
+
+    bool success = tracingData.save(&zip);
+    zip.close();
+
+    if (!success || zip.getZipError() != UNZ_OK)
+    {
+        qWarning() << "Unable to write SDT file at " << tempPath;
+        QFile::remove(tempPath);
+        return false;
+    }
+
+    // QFile::rename does not overwrite an existing file
+    if ((QFile::exists(path) && !QFile::remove(path)) || !QFile::rename(tempPath, path))
+    {
+        qWarning() << "Unable to replace SDT file at " << path << ", the tracing results were saved to " << tempPath;
+        return false;
+    }
+
+    return true;
+}
+
+Worklist::~Worklist()
+{
+    // Tracing data that is still being saved would be lost otherwise
+    waitForSaves();
+    threadPool.waitForDone();
+}
@@ -0,0 +1,114 @@
+#ifndef WORKLIST_H
+#define WORKLIST_H
+
+#include <QObject>
+#include <QDebug>
+#include <QString>
+#include <QFile>
+#include <QFileInfo>
+#include <QDir>
+#include <QTextStream>
+#include <QThread>
+#include <QThreadPool>
+#include <QFuture>
+#include <QFutureWatcher>
+#include <QtConcurrent>
+#include <memory>
+#include <algorithm>
+#include <vector>
+
+#include <nifti1.h>
+#include <nifti1_io.h>
+#include <libnifti.h>
+
+#include "niftimage.h"
+#include "subjectconfig.h"
+#include "tracing.h"
+#include "quazip.h"
+#include "quazipfile.h"
+
+struct WorklistItem
+{
+    // Subject image (SDI) to trace and the tracing results (SDT) file it is saved to
+    QString imagePath;
+    QString tracingPath;
+};
+
+// Subject that was read and stitched by Worklist::prepare, ready to be swapped into the objects of the window
+struct PreparedSubject
+{
+    QString imagePath;
+
+    NIFTImage fatImage;
+    NIFTImage waterImage;
+    SubjectConfig subConfig;
+    TracingData tracingData;
+
+    bool loaded;
+
+    PreparedSubject() : loaded(false) {}
+};
+
+/* Worklist is a list of subjects that are traced one after another. While a subject is traced, the next subject is prepared
+ * on a low priority worker thread (see prefetch) so that moving to it only swaps the prepared images into the window. The
+ * tracing of the subject that is left is saved on a worker thread as well.
+ *
+ * The worklist file is a text file with one subject per line. Each line is the path of the subject image followed by a tab
+ * and the path of the tracing results file. If the tracing results path is left out, the image path with an .sdt suffix is
+ * used. Relative paths are relative to the worklist file, and empty lines and lines starting with # are skipped.
+ */
+class Worklist : public QObject
+{
+    Q_OBJECT
+
+private:
+    QString filename;
+    std::vector<WorklistItem> items;
+    int index;
+
+    // Prefetching and saving have their own threads so they do not delay the slices that are prepared on the global pool
+    QThreadPool threadPool;
+
+    int prefetchIndex;
+    QFuture<std::shared_ptr<PreparedSubject>> prefetchFuture;
+
+    std::vector<QFutureWatcher<bool> *> saveWatchers;
+
+public:
+    Worklist(QObject *parent = NULL);
+    ~Worklist();
+
+    bool load(QString filename);
+    void clear();
+
+    QString getFilename() const;
+    int count() const;
+    const WorklistItem &at(int index) const;
+
+    // Index of the subject that is loaded in the window, -1 if the subject loaded is not from the worklist
+    int getIndex() const;
+    void setIndex(int index);
+
+    // Starts preparing the subject at index on a worker thread. Nothing is done if it is already being prepared
+    void prefetch(int index);
+
+    // Returns the prepared subject at index, waiting for it if it is still being prepared. If a different subject was
+    // prefetched, NULL is returned
+    std::shared_ptr<PreparedSubject> takePrepared(int index);
+
+    // Saves a copy of the tracing data to path on a worker thread, saveFinished is emitted once it is done. A prefetch of a
+    // subject that reads path waits for the save to finish
+    void saveAsync(QString path, TracingData *tracingData);
+    void waitForSaves();
+
+    static std::shared_ptr<PreparedSubject> prepare(WorklistItem item);
+    static bool save(QString path, TracingData tracingData);
+
+signals:
+    void saveFinished(QString path, bool success);
+
+private slots:
+    void saveWatcher_finished();
+};
+
+#endif // WORKLIST_H